@@ -18,6 +18,8 @@
  */
 
 #include <stdio.h>
+#include <stdarg.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
@@ -109,9 +111,14 @@ void clock_gettime(void *clk_id, struct timespec *t) {
 		(u8)((x)*255.0);                			\
 	})
 
-typedef void (*madd_t)(uint8_t *, const uint8_t *, uint8_t, size_t);
+struct thread_args;
+struct thread_state;
+
+typedef void (*encode_t)(struct thread_args *, uint8_t *,
+				struct coding_buffer *, struct thread_state *);
 
 struct args {
+	int op;
 	int count;
 	int maxsize;
 	int random;
@@ -120,13 +127,16 @@ struct args {
 } args;
 
 struct thread_args {
-	madd_t	madd;
-	uint8_t	mask;
+	const struct moepgf_algorithm *alg;
+	const struct moepgf *gf;
+	encode_t	encode;
+	uint8_t		mask;
 	double	gbps;
 	int	length;
 	int	rep;
 	int	random;
 	int	count;
+	int	rows;
 };
 
 struct thread_info {
@@ -135,6 +145,28 @@ struct thread_info {
 	struct thread_args 	args;
 };
 
+/* Number of failed checks of the selftest */
+static int failures;
+
+static void
+fail(const char *fmt, ...)
+{
+	va_list ap;
+
+	failures++;
+	va_start(ap, fmt);
+	vfprintf(stderr, fmt, ap);
+	va_end(ap);
+}
+
+/* Prints the verdict of a selftest that started with the given number of
+ * failures */
+static void
+verdict(int before)
+{
+	fprintf(stderr, failures == before ? "\tPASS\n" : "\tFAIL\n");
+}
+
 static void
 fill_random(struct coding_buffer *cb)
 {
@@ -146,23 +178,419 @@ fill_random(struct coding_buffer *cb)
 	}
 }
 
+/* State of the generator used to fill the test buffers. rand() takes most of
+ * the time of the selftest otherwise, in particular under emulation. */
+static uint32_t test_seed = 1;
+
 static void
 init_test_buffers(uint8_t *test1, uint8_t *test2, uint8_t *test3, int size)
 {
 	int i;
 	for (i=0; i<size; i++) {
-		test1[i] = rand();
+		test1[i] = moepgf_rand(&test_seed);
 		test2[i] = test1[i];
-		test3[i] = rand();
+		test3[i] = moepgf_rand(&test_seed);
+	}
+}
+
+/* Number and size of destination regions used to test maddrc_fanout. The count
+ * is chosen such that groups of 8 and 4 destinations as well as a single
+ * remaining destination are processed. Each algorithm is tested with
+ * FANOUT_SIZE plus its granularity, which is not a multiple of the widest
+ * vectors unless the algorithm uses them. Regions are FANOUT_STRIDE bytes
+ * apart and the bytes in between must not be written. */
+#define FANOUT_COUNT	13
+#define FANOUT_SIZE	2048
+#define FANOUT_STRIDE	(FANOUT_SIZE + 64)
+
+/* Number and size of source regions used to test maddrc_multi with many
+ * sources, e.g., parity over a whole generation. The count exceeds the batch
+ * size of the multi-input xor used by GF(2) and is odd. */
+#define MULTI_COUNT	41
+#define MULTI_SIZE	512
+
+/* Number of offset/length combinations used to test the unaligned kernels.
+ * Lengths start with every value below the largest vector width. */
+#define UNALIGNED_TESTS	96
+
+/* Dimensions used to test moepgf_matmul(). The length spans multiple tiles
+ * including a partial one. */
+#define MATMUL_K	7
+#define MATMUL_M	3
+#define MATMUL_SIZE	(9*1024)
+
+static void
+selftest_matmul(enum MOEPGF_TYPE type)
+{
+	int i,j,before;
+	uint8_t *buf, *in[MATMUL_K], *out1[MATMUL_M], *out2[MATMUL_M];
+	uint8_t coef[MATMUL_M*MATMUL_K];
+	struct moepgf ref, gf;
+
+	moepgf_init(&ref, type, MOEPGF_SELFTEST);
+	moepgf_init(&gf, type, MOEPGF_ALGORITHM_BEST);
+
+	if (posix_memalign((void *)&buf, 64,
+			(MATMUL_K+2*MATMUL_M)*MATMUL_SIZE))
+		exit(-1);
+
+	for (i=0; i<(MATMUL_K+2*MATMUL_M)*MATMUL_SIZE; i++)
+		buf[i] = rand();
+	for (i=0; i<MATMUL_K; i++)
+		in[i] = buf + i*MATMUL_SIZE;
+	for (i=0; i<MATMUL_M; i++) {
+		out1[i] = buf + (MATMUL_K+i)*MATMUL_SIZE;
+		out2[i] = buf + (MATMUL_K+MATMUL_M+i)*MATMUL_SIZE;
+	}
+	for (i=0; i<MATMUL_M*MATMUL_K; i++)
+		coef[i] = rand() & gf.mask;
+
+	for (i=0; i<MATMUL_M; i++) {
+		memset(out1[i], 0, MATMUL_SIZE);
+		for (j=0; j<MATMUL_K; j++) {
+			ref.maddrc(out1[i], in[j], coef[i*MATMUL_K+j],
+								MATMUL_SIZE);
+		}
+	}
+
+	fprintf(stderr, "- selftest (matmul)    ");
+	before = failures;
+	moepgf_matmul(&gf, out2, (const uint8_t **)in, coef, MATMUL_M,
+						MATMUL_K, MATMUL_SIZE);
+
+	for (i=0; i<MATMUL_M; i++) {
+		if (memcmp(out1[i], out2[i], MATMUL_SIZE))
+			fail("FAIL: results differ, row = %d\n", i);
 	}
+	verdict(before);
+
+	free(buf);
+}
+
+/* Odd length such that moepgf_alloc() has to pad the region. */
+#define INIT_SIZE	1024
+#define ALLOC_SIZE	1000
+
+static void
+selftest_alloc(enum MOEPGF_TYPE type)
+{
+	int i, before;
+	size_t size;
+	uint8_t *r1, *r2, *r3;
+	uint8_t c;
+	struct moepgf ref, gf;
+
+	moepgf_init(&ref, type, MOEPGF_SELFTEST);
+	moepgf_init(&gf, type, MOEPGF_ALGORITHM_BEST);
+
+	fprintf(stderr, "- selftest (alloc)    ");
+	before = failures;
+	if (!(r1 = moepgf_alloc(&gf, ALLOC_SIZE)))
+		exit(-1);
+	if (!(r2 = moepgf_alloc(&gf, ALLOC_SIZE)))
+		exit(-1);
+	if (!(r3 = moepgf_alloc(&ref, ALLOC_SIZE)))
+		exit(-1);
+
+	size = (ALLOC_SIZE + gf.granularity - 1) & ~(gf.granularity - 1);
+	if (gf.alignment > MOEPGF_MAX_ALIGNMENT
+	 || gf.granularity > MOEPGF_MAX_ALIGNMENT
+	 || (uintptr_t)r1 % gf.alignment || (uintptr_t)r2 % gf.alignment)
+		fail("FAIL: alignment = %zu, granularity = %zu\n",
+						gf.alignment, gf.granularity);
+	for (i=ALLOC_SIZE; i<size; i++) {
+		if (r1[i] || r2[i]) {
+			fail("FAIL: padding not zeroed\n");
+			break;
+		}
+	}
+
+	for (i=0; i<ALLOC_SIZE; i++) {
+		r2[i] = rand();
+		r1[i] = r3[i] = rand();
+	}
+	c = (rand() & gf.mask) | 2;
+
+	gf.maddrc(r1, r2, c, ALLOC_SIZE);
+	ref.maddrc(r3, r2, c, ALLOC_SIZE);
+
+	if (memcmp(r1, r3, ALLOC_SIZE))
+		fail("FAIL: results differ\n");
+	verdict(before);
+
+	moepgf_free(r1);
+	moepgf_free(r2);
+	moepgf_free(r3);
+}
+
+static void
+selftest_autotune(enum MOEPGF_TYPE type)
+{
+	char path[64];
+	int i, len, before;
+	uint8_t *r1, *r2, *r3;
+	struct moepgf ref, gf1, gf2;
+
+	/* Use a private profile that is created by the first and loaded by
+	 * the second initialization. */
+	snprintf(path, sizeof(path), "/tmp/moepgfbench-%d.profile",
+							(int)getpid());
+	setenv("MOEPGF_PROFILE", path, 1);
+
+	fprintf(stderr, "- selftest (autotune)    ");
+	before = failures;
+	moepgf_init(&ref, type, MOEPGF_SELFTEST);
+	if (moepgf_init(&gf1, type, MOEPGF_ALGORITHM_AUTOTUNE)
+	 || moepgf_init(&gf2, type, MOEPGF_ALGORITHM_AUTOTUNE))
+		fail("FAIL: initialization failed\n");
+	unlink(path);
+	unsetenv("MOEPGF_PROFILE");
+
+	if (memcmp(&gf1, &gf2, sizeof(gf1)))
+		fail("FAIL: profile not reproduced\n");
+
+	if (!(r1 = moepgf_alloc(&gf1, ALLOC_SIZE)))
+		exit(-1);
+	if (!(r2 = moepgf_alloc(&gf1, ALLOC_SIZE)))
+		exit(-1);
+	if (!(r3 = moepgf_alloc(&gf1, ALLOC_SIZE)))
+		exit(-1);
+
+	/* Lengths cover several size classes of the bucketed kernels */
+	for (len=1; len<=ALLOC_SIZE; len=2*len+37) {
+		for (i=0; i<ALLOC_SIZE; i++) {
+			r2[i] = rand();
+			r1[i] = r3[i] = rand();
+		}
+
+		gf1.maddrc(r1, r2, gf1.mask, len);
+		ref.maddrc(r3, r2, gf1.mask, len);
+		if (memcmp(r1, r3, len)) {
+			fail("FAIL: maddrc results differ, "
+						"len = %d\n", len);
+		}
+
+		gf1.mulrc(r1, gf1.mask, len);
+		ref.mulrc(r3, gf1.mask, len);
+		if (memcmp(r1, r3, len)) {
+			fail("FAIL: mulrc results differ, "
+						"len = %d\n", len);
+		}
+	}
+
+	for (i=0; i<ALLOC_SIZE; i++) {
+		r2[i] = rand();
+		r1[i] = r3[i] = rand();
+	}
+
+	gf1.mulrc_copy(r1, r2, gf1.mask, ALLOC_SIZE);
+	ref.mulrc_copy(r3, r2, gf1.mask, ALLOC_SIZE);
+	if (memcmp(r1, r3, ALLOC_SIZE))
+		fail("FAIL: mulrc_copy results differ\n");
+	verdict(before);
+
+	moepgf_free(r1);
+	moepgf_free(r2);
+	moepgf_free(r3);
+}
+
+static void
+selftest_init(enum MOEPGF_TYPE type)
+{
+	static const char *vars[MOEPGF_COUNT] = {
+		[MOEPGF2]	= "MOEPGF2_ALGORITHM",
+		[MOEPGF4]	= "MOEPGF4_ALGORITHM",
+		[MOEPGF16]	= "MOEPGF16_ALGORITHM",
+		[MOEPGF256]	= "MOEPGF256_ALGORITHM",
+	};
+	int i, c, fset, before;
+	char width[8];
+	uint8_t *r1, *r2, *r3;
+	struct moepgf ref, gf;
+	struct moepgf_algorithm **algs;
+
+	fprintf(stderr, "- selftest (init)        ");
+	before = failures;
+	fset = moepgf_check_available_simd_extensions();
+	moepgf_init(&ref, type, MOEPGF_SELFTEST);
+	algs = moepgf_get_algs(type);
+
+	if (posix_memalign((void *)&r1, MOEPGF_MAX_ALIGNMENT, INIT_SIZE))
+		exit(-1);
+	if (posix_memalign((void *)&r2, MOEPGF_MAX_ALIGNMENT, INIT_SIZE))
+		exit(-1);
+	if (posix_memalign((void *)&r3, MOEPGF_MAX_ALIGNMENT, INIT_SIZE))
+		exit(-1);
+
+	for (i=MOEPGF_SELFTEST+1; i<MOEPGF_ALGORITHM_BEST; i++) {
+		if (!algs[i] || !(fset & (1 << algs[i]->hwcaps))) {
+			if (!moepgf_init(&gf, type, i))
+				fail("FAIL: %s initialized\n",
+							moepgf_a2name(i));
+			continue;
+		}
+
+		if (moepgf_init(&gf, type, i)) {
+			fail("FAIL: %s not initialized\n",
+							moepgf_a2name(i));
+			continue;
+		}
+
+		if (gf.maddrc != algs[i]->maddrc || !gf.mulrc || !gf.inv)
+			fail("FAIL: %s incomplete\n", moepgf_a2name(i));
+
+		for (c=0; c<gf.size; c++) {
+			if (ref.inv(c) != gf.inv(c))
+				fail("FAIL: %s inv differs\n",
+							moepgf_a2name(i));
+		}
+
+		for (c=0; c<INIT_SIZE; c++) {
+			r1[c] = rand();
+			r2[c] = r3[c] = rand();
+		}
+
+		c = rand() & gf.mask;
+		gf.mulrc(r2, gf.mask, INIT_SIZE);
+		ref.mulrc(r3, gf.mask, INIT_SIZE);
+		gf.maddrc(r2, r1, c, INIT_SIZE);
+		ref.maddrc(r3, r1, c, INIT_SIZE);
+		if (memcmp(r2, r3, INIT_SIZE))
+			fail("FAIL: %s results differ\n",
+							moepgf_a2name(i));
+
+		/* The environment overrides MOEPGF_ALGORITHM_BEST */
+		setenv(vars[type], moepgf_a2name(i), 1);
+		if (moepgf_init(&gf, type, MOEPGF_ALGORITHM_BEST)
+					|| gf.maddrc != algs[i]->maddrc)
+			fail("FAIL: %s not forced\n",
+							moepgf_a2name(i));
+		unsetenv(vars[type]);
+	}
+
+	setenv(vars[type], "unknown", 1);
+	if (!moepgf_init(&gf, type, MOEPGF_ALGORITHM_BEST))
+		fail("FAIL: unknown algorithm initialized\n");
+	unsetenv(vars[type]);
+
+	/* The best kernels respect the vector width cap */
+	for (i=64; i<=512; i*=2) {
+		snprintf(width, sizeof(width), "%d", i);
+		setenv("MOEPGF_MAX_VECTOR_WIDTH", width, 1);
+		if (moepgf_init(&gf, type, MOEPGF_ALGORITHM_BEST)) {
+			fail("FAIL: width %d not initialized\n", i);
+			continue;
+		}
+		if (gf.granularity*8 > (size_t)i)
+			fail("FAIL: width %d exceeded\n", i);
+
+		for (c=0; c<INIT_SIZE; c++) {
+			r1[c] = rand();
+			r2[c] = r3[c] = rand();
+		}
+
+		c = rand() & gf.mask;
+		gf.maddrc(r2, r1, c, INIT_SIZE);
+		ref.maddrc(r3, r1, c, INIT_SIZE);
+		if (memcmp(r2, r3, INIT_SIZE))
+			fail("FAIL: width %d results differ\n", i);
+	}
+	setenv("MOEPGF_MAX_VECTOR_WIDTH", "32", 1);
+	if (!moepgf_init(&gf, type, MOEPGF_ALGORITHM_BEST))
+		fail("FAIL: invalid width initialized\n");
+	unsetenv("MOEPGF_MAX_VECTOR_WIDTH");
+	verdict(before);
+
+	free(r1);
+	free(r2);
+	free(r3);
+	moepgf_free_algs(algs);
+}
+
+static const struct {
+	maddrc_t	maddrc;
+	mulrc_t		mulrc;
+	mulrc_copy_t	mulrc_copy;
+	maddrc3_t	maddrc3;
+} direct[MOEPGF_COUNT] = {
+	[MOEPGF2]	= { moepgf2_maddrc, moepgf2_mulrc,
+				moepgf2_mulrc_copy, moepgf2_maddrc3 },
+	[MOEPGF4]	= { moepgf4_maddrc, moepgf4_mulrc,
+				moepgf4_mulrc_copy, moepgf4_maddrc3 },
+	[MOEPGF16]	= { moepgf16_maddrc, moepgf16_mulrc,
+				moepgf16_mulrc_copy, moepgf16_maddrc3 },
+	[MOEPGF256]	= { moepgf256_maddrc, moepgf256_mulrc,
+				moepgf256_mulrc_copy, moepgf256_maddrc3 },
+};
+
+static void
+selftest_direct(enum MOEPGF_TYPE type)
+{
+	int i, before;
+	uint8_t *r1, *r2, *r3, *r4;
+	struct moepgf ref, gf;
+
+	fprintf(stderr, "- selftest (direct)      ");
+	before = failures;
+	moepgf_init(&ref, type, MOEPGF_SELFTEST);
+	moepgf_init(&gf, type, MOEPGF_ALGORITHM_BEST);
+
+	if (!(r1 = moepgf_alloc(&gf, ALLOC_SIZE)))
+		exit(-1);
+	if (!(r2 = moepgf_alloc(&gf, ALLOC_SIZE)))
+		exit(-1);
+	if (!(r3 = moepgf_alloc(&gf, ALLOC_SIZE)))
+		exit(-1);
+	if (!(r4 = moepgf_alloc(&gf, ALLOC_SIZE)))
+		exit(-1);
+
+	for (i=0; i<ALLOC_SIZE; i++) {
+		r2[i] = rand();
+		r4[i] = rand();
+		r1[i] = r3[i] = rand();
+	}
+
+	direct[type].maddrc(r1, r2, gf.mask, ALLOC_SIZE);
+	ref.maddrc(r3, r2, gf.mask, ALLOC_SIZE);
+	if (memcmp(r1, r3, ALLOC_SIZE))
+		fail("FAIL: maddrc results differ\n");
+
+	direct[type].mulrc(r1, gf.mask, ALLOC_SIZE);
+	ref.mulrc(r3, gf.mask, ALLOC_SIZE);
+	if (memcmp(r1, r3, ALLOC_SIZE))
+		fail("FAIL: mulrc results differ\n");
+
+	direct[type].maddrc3(r1, r2, r4, gf.mask, ALLOC_SIZE);
+	ref.maddrc3(r3, r2, r4, gf.mask, ALLOC_SIZE);
+	if (memcmp(r1, r3, ALLOC_SIZE))
+		fail("FAIL: maddrc3 results differ\n");
+
+	direct[type].mulrc_copy(r1, r2, gf.mask, ALLOC_SIZE);
+	ref.mulrc_copy(r3, r2, gf.mask, ALLOC_SIZE);
+	if (memcmp(r1, r3, ALLOC_SIZE))
+		fail("FAIL: mulrc_copy results differ\n");
+	verdict(before);
+
+	moepgf_free(r1);
+	moepgf_free(r2);
+	moepgf_free(r3);
+	moepgf_free(r4);
 }
 
 static void
 selftest()
 {
-	int i,j,k,fset;
+	int i,j,k,l,fset,before;
+	int o1, o2, len;
+	uint8_t c;
 	int tlen = (1 << 15);
 	uint8_t	*test1, *test2, *test3;
+	uint8_t *srcs[4];
+	uint8_t coefs[4];
+	uint8_t *dst1[FANOUT_COUNT], *dst2[FANOUT_COUNT];
+	uint8_t fcoefs[FANOUT_COUNT];
+	uint8_t *msrcs[MULTI_COUNT];
+	uint8_t mcoefs[MULTI_COUNT];
 	struct moepgf_algorithm **algs;
 	struct moepgf gf;
 
@@ -190,8 +618,18 @@ selftest()
 		fprintf(stderr, "AVX512BW ");
 	if (fset & (1 << MOEPGF_HWCAPS_SIMD_AVX512GFNI))
 		fprintf(stderr, "AVX512GFNI ");
+	if (fset & (1 << MOEPGF_HWCAPS_SIMD_GFNI))
+		fprintf(stderr, "GFNI ");
+	if (fset & (1 << MOEPGF_HWCAPS_SIMD_AVX512VL))
+		fprintf(stderr, "AVX512VL ");
+	if (fset & (1 << MOEPGF_HWCAPS_SIMD_AVX512VBMI))
+		fprintf(stderr, "AVX512VBMI ");
 	if (fset & (1 << MOEPGF_HWCAPS_SIMD_NEON))
 		fprintf(stderr, "NEON ");
+	if (fset & (1 << MOEPGF_HWCAPS_SIMD_NEON_SHA3))
+		fprintf(stderr, "NEON_SHA3 ");
+	if (fset & (1 << MOEPGF_HWCAPS_SIMD_VECTOR))
+		fprintf(stderr, "VECTOR ");
 	fprintf(stderr, "\n\n");
 
 	if (posix_memalign((void *)&test1, 64, tlen))
@@ -212,6 +650,7 @@ selftest()
 
 			fprintf(stderr, "- selftest (%s)    ",
 						moepgf_a2name(algs[j]->type));
+			before = failures;
 			if (!(fset & (1 << algs[j]->hwcaps))) {
 				fprintf(stderr, "\tNecessary SIMD "
 						"instructions not supported\n");
@@ -225,11 +664,291 @@ selftest()
 				algs[j]->maddrc(test2, test3, k, tlen);
 
 				if (memcmp(test1, test2, tlen)){
-					fprintf(stderr,"FAIL: results differ, c = %d\n", k);
+					fail("FAIL: results differ, c = %d\n", k);
 				}
 			}
-			fprintf(stderr, "\tPASS\n");
+
+			for (k=0; k<4; k++)
+				srcs[k] = test3 + k*(tlen/4);
+			for (k=gf.size-1; k>=0 && algs[j]->maddrc_multi; k--) {
+				init_test_buffers(test1, test2, test3, tlen/4);
+				coefs[0] = k;
+				coefs[1] = (k * 7 + 1) & gf.mask;
+				coefs[2] = 0;
+				coefs[3] = (k * 3) & gf.mask;
+
+				gf.maddrc_multi(test1, (const uint8_t **)srcs,
+							coefs, 4, tlen/4);
+				algs[j]->maddrc_multi(test2,
+						(const uint8_t **)srcs,
+						coefs, 4, tlen/4);
+
+				if (memcmp(test1, test2, tlen/4)){
+					fail("FAIL: maddrc_multi results "
+							"differ, c = %d\n", k);
+				}
+			}
+
+			for (k=0; k<MULTI_COUNT; k++)
+				msrcs[k] = test3 + k*MULTI_SIZE;
+			for (k=gf.size-1; k>=0 && algs[j]->maddrc_multi; k--) {
+				init_test_buffers(test1, test2, test3, tlen);
+				for (l=0; l<MULTI_COUNT; l++)
+					mcoefs[l] = (k + l * 3) & gf.mask;
+
+				gf.maddrc_multi(test1, (const uint8_t **)msrcs,
+						mcoefs, MULTI_COUNT, MULTI_SIZE);
+				algs[j]->maddrc_multi(test2,
+						(const uint8_t **)msrcs,
+						mcoefs, MULTI_COUNT, MULTI_SIZE);
+
+				if (memcmp(test1, test2, MULTI_SIZE)){
+					fail("FAIL: maddrc_multi results "
+						"differ for %d sources, c = %d\n",
+						MULTI_COUNT, k);
+				}
+			}
+
+			for (k=0; k<FANOUT_COUNT; k++) {
+				dst1[k] = test1 + k*FANOUT_STRIDE;
+				dst2[k] = test2 + k*FANOUT_STRIDE;
+			}
+			len = FANOUT_SIZE + algs[j]->granularity;
+			for (k=gf.size-1; k>=0 && algs[j]->maddrc_fanout; k--) {
+				init_test_buffers(test1, test2, test3, tlen);
+				for (l=0; l<FANOUT_COUNT; l++)
+					fcoefs[l] = (k + l * 5) & gf.mask;
+
+				gf.maddrc_fanout(dst1, test3, fcoefs, FANOUT_COUNT,
+									len);
+				algs[j]->maddrc_fanout(dst2, test3, fcoefs,
+							FANOUT_COUNT, len);
+
+				for (l=0; l<FANOUT_COUNT; l++) {
+					if (memcmp(dst1[l], dst2[l], len)) {
+						fail("FAIL: maddrc_fanout "
+							"results differ, "
+							"c = %d\n", k);
+						break;
+					}
+					if (memcmp(dst1[l] + len, dst2[l] + len,
+							FANOUT_STRIDE - len)) {
+						fail("FAIL: maddrc_fanout "
+							"writes beyond %d "
+							"bytes, c = %d\n",
+							len, k);
+						break;
+					}
+				}
+			}
+
+			for (k=gf.size-1; k>=0 && algs[j]->maddrc3; k--) {
+				init_test_buffers(test1, test2, test3, tlen);
+
+				gf.maddrc3(test1, test3, test3 + tlen/2, k,
+								tlen/2);
+				algs[j]->maddrc3(test2, test3, test3 + tlen/2,
+								k, tlen/2);
+
+				if (memcmp(test1, test2, tlen/2)){
+					fail("FAIL: maddrc3 results "
+							"differ, c = %d\n", k);
+				}
+
+				/* Destination may alias the first source */
+				memcpy(test2, test3, tlen/2);
+				algs[j]->maddrc3(test2, test2, test3 + tlen/2,
+								k, tlen/2);
+
+				if (memcmp(test1, test2, tlen/2)){
+					fail("FAIL: in-place maddrc3 "
+						"results differ, c = %d\n", k);
+				}
+			}
+
+			for (k=gf.size-1; k>=0 && algs[j]->mulrc; k--) {
+				init_test_buffers(test1, test2, test3, tlen);
+
+				gf.mulrc(test1, k, tlen);
+				algs[j]->mulrc(test2, k, tlen);
+
+				if (memcmp(test1, test2, tlen)){
+					fail("FAIL: mulrc results "
+							"differ, c = %d\n", k);
+				}
+			}
+
+			/* Odd number of vectors to test the remainder of
+			 * unrolled kernels. */
+			len = 5 * algs[j]->granularity;
+			for (k=gf.size-1; k>=0 && algs[j]->mulrc; k--) {
+				init_test_buffers(test1, test2, test3, tlen);
+
+				gf.maddrc(test1, test3, k, len);
+				algs[j]->maddrc(test2, test3, k, len);
+				gf.mulrc(test1, k, len);
+				algs[j]->mulrc(test2, k, len);
+
+				if (memcmp(test1, test2, tlen)){
+					fail("FAIL: results differ for "
+						"len = %d, c = %d\n", len, k);
+				}
+			}
+
+			/* Prefetches run past the end of the regions */
+			len = tlen - algs[j]->granularity;
+			for (k=gf.size-1; k>=0 && algs[j]->maddrc_prefetch; k--) {
+				init_test_buffers(test1, test2, test3, tlen);
+
+				gf.maddrc(test1, test3, k, len);
+				algs[j]->maddrc_prefetch(test2, test3, k, len,
+									1024);
+
+				if (memcmp(test1, test2, tlen)){
+					fail("FAIL: maddrc_prefetch "
+						"results differ, c = %d\n", k);
+				}
+			}
+
+			for (k=gf.size-1; k>=0 && algs[j]->mulrc_prefetch; k--) {
+				init_test_buffers(test1, test2, test3, tlen);
+
+				gf.mulrc(test1, k, len);
+				algs[j]->mulrc_prefetch(test2, k, len, 1024);
+
+				if (memcmp(test1, test2, tlen)){
+					fail("FAIL: mulrc_prefetch "
+						"results differ, c = %d\n", k);
+				}
+			}
+
+			for (k=gf.size-1; k>=0 && algs[j]->mulrc_copy; k--) {
+				init_test_buffers(test1, test2, test3, tlen);
+
+				gf.mulrc_copy(test1, test3, k, tlen);
+				algs[j]->mulrc_copy(test2, test3, k, tlen);
+
+				if (memcmp(test1, test2, tlen)){
+					fail("FAIL: mulrc_copy results "
+							"differ, c = %d\n", k);
+				}
+
+				memcpy(test2, test3, tlen);
+				algs[j]->mulrc_copy(test2, test2, k, tlen);
+
+				if (memcmp(test1, test2, tlen)){
+					fail("FAIL: in-place mulrc_copy "
+						"results differ, c = %d\n", k);
+				}
+			}
+
+			for (k=gf.size-1; k>=0 && algs[j]->mulrc_copy_nt; k--) {
+				init_test_buffers(test1, test2, test3, tlen);
+
+				gf.mulrc_copy(test1, test3, k, tlen);
+				algs[j]->mulrc_copy_nt(test2, test3, k, tlen);
+
+				if (memcmp(test1, test2, tlen)){
+					fail("FAIL: mulrc_copy_nt results "
+							"differ, c = %d\n", k);
+				}
+			}
+
+			for (k=gf.size-1; k>=0 && algs[j]->maddrc3_nt; k--) {
+				init_test_buffers(test1, test2, test3, tlen);
+
+				gf.maddrc3(test1, test3, test3 + tlen/2, k,
+								tlen/2);
+				algs[j]->maddrc3_nt(test2, test3, test3 + tlen/2,
+								k, tlen/2);
+
+				if (memcmp(test1, test2, tlen/2)){
+					fail("FAIL: maddrc3_nt results "
+							"differ, c = %d\n", k);
+				}
+			}
+
+			if (algs[j]->mulrr) {
+				init_test_buffers(test1, test2, test3, tlen);
+
+				gf.mulrr(test1, test3, tlen);
+				algs[j]->mulrr(test2, test3, tlen);
+
+				if (memcmp(test1, test2, tlen))
+					fail("FAIL: mulrr results differ\n");
+			}
+
+			if (algs[j]->maddrr) {
+				init_test_buffers(test1, test2, test3, tlen);
+
+				gf.maddrr(test1, test3, test3 + tlen/2, tlen/2);
+				algs[j]->maddrr(test2, test3, test3 + tlen/2, tlen/2);
+
+				if (memcmp(test1, test2, tlen/2))
+					fail("FAIL: maddrr results differ\n");
+			}
+
+			if (algs[j]->invr) {
+				init_test_buffers(test1, test2, test3, tlen);
+
+				gf.invr(test1, tlen);
+				algs[j]->invr(test2, tlen);
+
+				if (memcmp(test1, test2, tlen))
+					fail("FAIL: invr results differ\n");
+			}
+
+			if (algs[j]->divr) {
+				init_test_buffers(test1, test2, test3, tlen);
+
+				gf.divr(test1, test3, tlen);
+				algs[j]->divr(test2, test3, tlen);
+
+				if (memcmp(test1, test2, tlen))
+					fail("FAIL: divr results differ\n");
+			}
+
+			for (k=0; k<UNALIGNED_TESTS; k++) {
+				o1 = k % 13;
+				o2 = (k * 7) % 17;
+				len = k < 64 ? k : (k * k * 13 + k) % 4099;
+				c = (k * 29 + 1) & gf.mask;
+
+				if (algs[j]->maddrc_unaligned) {
+					init_test_buffers(test1, test2, test3, tlen);
+
+					gf.maddrc_unaligned(test1 + o1, test3 + o2,
+									c, len);
+					algs[j]->maddrc_unaligned(test2 + o1,
+							test3 + o2, c, len);
+
+					if (memcmp(test1, test2, tlen)) {
+						fail("FAIL: maddrc_unaligned "
+							"results differ, len = %d\n",
+									len);
+					}
+				}
+
+				if (algs[j]->mulrc_unaligned) {
+					init_test_buffers(test1, test2, test3, tlen);
+
+					gf.mulrc_unaligned(test1 + o1, c, len);
+					algs[j]->mulrc_unaligned(test2 + o1, c, len);
+
+					if (memcmp(test1, test2, tlen)) {
+						fail("FAIL: mulrc_unaligned "
+							"results differ, len = %d\n",
+									len);
+					}
+				}
+			}
+			verdict(before);
 		}
+		selftest_matmul(gf.type);
+		selftest_alloc(gf.type);
+		selftest_autotune(gf.type);
+		selftest_direct(gf.type);
+		selftest_init(gf.type);
 		fprintf(stderr, "\n");
 		moepgf_free_algs(algs);
 	}
@@ -242,33 +961,448 @@ selftest()
 struct thread_state {
 	unsigned int 	rseed;
 	int		pos;
+	uint8_t		*coefs;
+	struct coding_buffer out;
 };
 
 static void
-encode_random(madd_t madd, int mask, uint8_t *dst, struct coding_buffer *cb,
+next_coefs(struct thread_args *ta, struct thread_state *state, int count)
+{
+	int i;
+
+	if (ta->random) {
+		for (i=0; i<count; i++)
+			state->coefs[i] = moepgf_rand(&state->rseed) & ta->mask;
+		return;
+	}
+
+	for (i=0; i<count; i++, state->pos++)
+		state->coefs[i] = _rval[state->pos & (RVAL_COUNT-1)] & ta->mask;
+}
+
+static void
+encode_maddrc(struct thread_args *ta, uint8_t *frame, struct coding_buffer *cb,
+						struct thread_state *state)
+{
+	int i;
+
+	next_coefs(ta, state, cb->scount);
+	for (i=0; i<cb->scount; i++)
+		ta->alg->maddrc(frame, cb->slot[i], state->coefs[i], cb->ssize);
+}
+
+static void
+encode_maddrc_unaligned(struct thread_args *ta, uint8_t *frame,
+			struct coding_buffer *cb, struct thread_state *state)
+{
+	int i;
+
+	next_coefs(ta, state, cb->scount);
+	for (i=0; i<cb->scount; i++) {
+		ta->alg->maddrc_unaligned(frame, cb->slot[i], state->coefs[i],
+								cb->ssize);
+	}
+}
+
+static void
+encode_multi(struct thread_args *ta, uint8_t *frame, struct coding_buffer *cb,
+						struct thread_state *state)
+{
+	next_coefs(ta, state, cb->scount);
+	ta->alg->maddrc_multi(frame, (const uint8_t **)cb->slot, state->coefs,
+							cb->scount, cb->ssize);
+}
+
+static void
+encode_prefetch(struct thread_args *ta, uint8_t *frame, struct coding_buffer *cb,
+				struct thread_state *state, size_t distance)
+{
+	int i;
+
+	next_coefs(ta, state, cb->scount);
+	for (i=0; i<cb->scount; i++) {
+		ta->alg->maddrc_prefetch(frame, cb->slot[i], state->coefs[i],
+							cb->ssize, distance);
+	}
+}
+
+static void
+encode_prefetch256(struct thread_args *ta, uint8_t *frame,
+			struct coding_buffer *cb, struct thread_state *state)
+{
+	encode_prefetch(ta, frame, cb, state, 256);
+}
+
+static void
+encode_prefetch1024(struct thread_args *ta, uint8_t *frame,
+			struct coding_buffer *cb, struct thread_state *state)
+{
+	encode_prefetch(ta, frame, cb, state, 1024);
+}
+
+static void
+encode_prefetch4096(struct thread_args *ta, uint8_t *frame,
+			struct coding_buffer *cb, struct thread_state *state)
+{
+	encode_prefetch(ta, frame, cb, state, 4096);
+}
+
+static void
+encode_fanout_loop(struct thread_args *ta, uint8_t *frame,
+			struct coding_buffer *cb, struct thread_state *state)
+{
+	int i;
+
+	next_coefs(ta, state, cb->scount);
+	for (i=0; i<cb->scount; i++)
+		ta->alg->maddrc(cb->slot[i], frame, state->coefs[i], cb->ssize);
+}
+
+static void
+encode_fanout(struct thread_args *ta, uint8_t *frame, struct coding_buffer *cb,
+						struct thread_state *state)
+{
+	next_coefs(ta, state, cb->scount);
+	ta->alg->maddrc_fanout(cb->slot, frame, state->coefs, cb->scount,
+								cb->ssize);
+}
+
+static void
+encode_copy(struct thread_args *ta, uint8_t *frame, struct coding_buffer *cb,
+						struct thread_state *state)
+{
+	int i;
+
+	next_coefs(ta, state, cb->scount);
+	for (i=0; i<cb->scount; i++) {
+		memcpy(frame, cb->slot[i], cb->ssize);
+		ta->alg->maddrc(frame, cb->slot[(i+1) % cb->scount],
+						state->coefs[i], cb->ssize);
+	}
+}
+
+static void
+encode_maddrc3(struct thread_args *ta, uint8_t *frame, struct coding_buffer *cb,
+						struct thread_state *state)
+{
+	int i;
+
+	next_coefs(ta, state, cb->scount);
+	for (i=0; i<cb->scount; i++) {
+		ta->alg->maddrc3(frame, cb->slot[i],
+					cb->slot[(i+1) % cb->scount],
+					state->coefs[i], cb->ssize);
+	}
+}
+
+static void
+encode_mulrc(struct thread_args *ta, uint8_t *frame, struct coding_buffer *cb,
+						struct thread_state *state)
+{
+	(void) frame;
+	int i;
+
+	next_coefs(ta, state, cb->scount);
+	for (i=0; i<cb->scount; i++)
+		ta->alg->mulrc(cb->slot[i], state->coefs[i], cb->ssize);
+}
+
+static void
+encode_mulrc_inplace(struct thread_args *ta, uint8_t *frame,
+			struct coding_buffer *cb, struct thread_state *state)
+{
+	int i;
+
+	next_coefs(ta, state, cb->scount);
+	for (i=0; i<cb->scount; i++) {
+		memcpy(frame, cb->slot[i], cb->ssize);
+		ta->alg->mulrc_copy(frame, frame, state->coefs[i], cb->ssize);
+	}
+}
+
+static void
+encode_mulrc_copy(struct thread_args *ta, uint8_t *frame,
+			struct coding_buffer *cb, struct thread_state *state)
+{
+	int i;
+
+	next_coefs(ta, state, cb->scount);
+	for (i=0; i<cb->scount; i++) {
+		ta->alg->mulrc_copy(frame, cb->slot[i], state->coefs[i],
+								cb->ssize);
+	}
+}
+
+static void
+encode_mulrc_copy_nt(struct thread_args *ta, uint8_t *frame,
+			struct coding_buffer *cb, struct thread_state *state)
+{
+	int i;
+
+	next_coefs(ta, state, cb->scount);
+	for (i=0; i<cb->scount; i++) {
+		ta->alg->mulrc_copy_nt(frame, cb->slot[i], state->coefs[i],
+								cb->ssize);
+	}
+}
+
+static void
+encode_maddrc3_nt(struct thread_args *ta, uint8_t *frame,
+			struct coding_buffer *cb, struct thread_state *state)
+{
+	int i;
+
+	next_coefs(ta, state, cb->scount);
+	for (i=0; i<cb->scount; i++) {
+		ta->alg->maddrc3_nt(frame, cb->slot[i],
+					cb->slot[(i+1) % cb->scount],
+					state->coefs[i], cb->ssize);
+	}
+}
+
+static void
+encode_mulrr(struct thread_args *ta, uint8_t *frame, struct coding_buffer *cb,
+						struct thread_state *state)
+{
+	(void) state;
+	int i;
+
+	for (i=0; i<cb->scount; i++)
+		ta->alg->mulrr(frame, cb->slot[i], cb->ssize);
+}
+
+static void
+encode_maddrr(struct thread_args *ta, uint8_t *frame, struct coding_buffer *cb,
 						struct thread_state *state)
 {
-	int i,c;
+	(void) state;
+	int i;
 
 	for (i=0; i<cb->scount; i++) {
-		c = moepgf_rand(&state->rseed) & mask;
-		madd(dst, cb->slot[i], c, cb->ssize);
+		ta->alg->maddrr(frame, cb->slot[i],
+				cb->slot[(i+1) % cb->scount], cb->ssize);
 	}
 }
 
 static void
-encode_permutation(madd_t madd, int mask, uint8_t *dst, struct coding_buffer *cb,
+encode_invr(struct thread_args *ta, uint8_t *frame, struct coding_buffer *cb,
 						struct thread_state *state)
 {
+	(void) frame;
 	(void) state;
-	int i,c;
+	int i;
 
-	for (i=0; i<cb->scount; i++, state->pos++) {
-		c = _rval[state->pos & (RVAL_COUNT-1)] & mask;
-		madd(dst, cb->slot[i], c, cb->ssize);
+	for (i=0; i<cb->scount; i++)
+		ta->alg->invr(cb->slot[i], cb->ssize);
+}
+
+static void
+encode_divr(struct thread_args *ta, uint8_t *frame, struct coding_buffer *cb,
+						struct thread_state *state)
+{
+	(void) state;
+	int i;
+
+	for (i=0; i<cb->scount; i++)
+		ta->alg->divr(frame, cb->slot[i], cb->ssize);
+}
+
+static void
+encode_matmul_loop(struct thread_args *ta, uint8_t *frame,
+			struct coding_buffer *cb, struct thread_state *state)
+{
+	(void) frame;
+	int i,j;
+
+	next_coefs(ta, state, ta->rows*cb->scount);
+	for (i=0; i<ta->rows; i++) {
+		memset(state->out.slot[i], 0, cb->ssize);
+		for (j=0; j<cb->scount; j++) {
+			ta->gf->maddrc(state->out.slot[i], cb->slot[j],
+				state->coefs[i*cb->scount+j], cb->ssize);
+		}
 	}
 }
 
+static void
+encode_matmul(struct thread_args *ta, uint8_t *frame,
+			struct coding_buffer *cb, struct thread_state *state)
+{
+	(void) frame;
+
+	next_coefs(ta, state, ta->rows*cb->scount);
+	moepgf_matmul(ta->gf, state->out.slot, (const uint8_t **)cb->slot,
+				state->coefs, ta->rows, cb->scount, cb->ssize);
+}
+
+/*
+ * Benchmarked operations. Each operation is measured in one or more columns
+ * per algorithm, e.g., a fused kernel and the equivalent loop over maddrc.
+ * A column is only available if the algorithm implements the function pointer
+ * at offset fn in struct moepgf_algorithm.
+ */
+#define BENCH_MAX_COLUMNS	4
+
+static void benchmark(struct args *args);
+static void benchmark_matmul(struct args *args);
+
+static const struct bench_op {
+	const char *name;
+	const char *help;
+	void (*run)(struct args *args);
+	struct {
+		const char	*suffix;
+		encode_t	encode;
+		size_t		fn;
+	} col[BENCH_MAX_COLUMNS];
+} ops[] = {
+	{
+		.name	= "maddrc",
+		.help	= "one maddrc per source packet (default)",
+		.run	= benchmark,
+		.col	= {
+			{ "", encode_maddrc,
+				offsetof(struct moepgf_algorithm, maddrc) },
+		},
+	},
+	{
+		.name	= "mulrc",
+		.help	= "one in-place mulrc per source packet",
+		.run	= benchmark,
+		.col	= {
+			{ "", encode_mulrc,
+				offsetof(struct moepgf_algorithm, mulrc) },
+		},
+	},
+	{
+		.name	= "unaligned",
+		.help	= "maddrc vs. exact-length maddrc_unaligned on "
+							"aligned data",
+		.run	= benchmark,
+		.col	= {
+			{ ":maddrc", encode_maddrc,
+				offsetof(struct moepgf_algorithm, maddrc_unaligned) },
+			{ ":unaligned", encode_maddrc_unaligned,
+				offsetof(struct moepgf_algorithm, maddrc_unaligned) },
+		},
+	},
+	{
+		.name	= "prefetch",
+		.help	= "maddrc vs. maddrc_prefetch with distances of 256, "
+						"1024 and 4096 bytes",
+		.run	= benchmark,
+		.col	= {
+			{ ":maddrc", encode_maddrc,
+				offsetof(struct moepgf_algorithm, maddrc_prefetch) },
+			{ ":pf256", encode_prefetch256,
+				offsetof(struct moepgf_algorithm, maddrc_prefetch) },
+			{ ":pf1024", encode_prefetch1024,
+				offsetof(struct moepgf_algorithm, maddrc_prefetch) },
+			{ ":pf4096", encode_prefetch4096,
+				offsetof(struct moepgf_algorithm, maddrc_prefetch) },
+		},
+	},
+	{
+		.name	= "maddrc_multi",
+		.help	= "per-source maddrc loop vs. fused maddrc_multi",
+		.run	= benchmark,
+		.col	= {
+			{ ":loop", encode_maddrc,
+				offsetof(struct moepgf_algorithm, maddrc) },
+			{ ":multi", encode_multi,
+				offsetof(struct moepgf_algorithm, maddrc_multi) },
+		},
+	},
+	{
+		.name	= "maddrc_fanout",
+		.help	= "per-destination maddrc loop vs. fused "
+							"maddrc_fanout",
+		.run	= benchmark,
+		.col	= {
+			{ ":loop", encode_fanout_loop,
+				offsetof(struct moepgf_algorithm, maddrc) },
+			{ ":fanout", encode_fanout,
+				offsetof(struct moepgf_algorithm, maddrc_fanout) },
+		},
+	},
+	{
+		.name	= "maddrc3",
+		.help	= "memcpy followed by maddrc vs. non-destructive "
+							"maddrc3",
+		.run	= benchmark,
+		.col	= {
+			{ ":copy", encode_copy,
+				offsetof(struct moepgf_algorithm, maddrc) },
+			{ ":maddrc3", encode_maddrc3,
+				offsetof(struct moepgf_algorithm, maddrc3) },
+		},
+	},
+	{
+		.name	= "mulrc_copy",
+		.help	= "memcpy followed by in-place scaling vs. "
+						"out-of-place mulrc_copy",
+		.run	= benchmark,
+		.col	= {
+			{ ":inplace", encode_mulrc_inplace,
+				offsetof(struct moepgf_algorithm, mulrc_copy) },
+			{ ":copy", encode_mulrc_copy,
+				offsetof(struct moepgf_algorithm, mulrc_copy) },
+		},
+	},
+	{
+		.name	= "nt",
+		.help	= "regular vs. non-temporal stores in mulrc_copy and "
+						"maddrc3, shows the crossover",
+		.run	= benchmark,
+		.col	= {
+			{ ":copy", encode_mulrc_copy,
+				offsetof(struct moepgf_algorithm, mulrc_copy_nt) },
+			{ ":copy_nt", encode_mulrc_copy_nt,
+				offsetof(struct moepgf_algorithm, mulrc_copy_nt) },
+			{ ":maddrc3", encode_maddrc3,
+				offsetof(struct moepgf_algorithm, maddrc3_nt) },
+			{ ":maddrc3_nt", encode_maddrc3_nt,
+				offsetof(struct moepgf_algorithm, maddrc3_nt) },
+		},
+	},
+	{
+		.name	= "mulrr",
+		.help	= "element-wise mulrr and maddrr of two regions",
+		.run	= benchmark,
+		.col	= {
+			{ ":mulrr", encode_mulrr,
+				offsetof(struct moepgf_algorithm, mulrr) },
+			{ ":maddrr", encode_maddrr,
+				offsetof(struct moepgf_algorithm, maddrr) },
+		},
+	},
+	{
+		.name	= "invr",
+		.help	= "element-wise invr and divr of regions",
+		.run	= benchmark,
+		.col	= {
+			{ ":invr", encode_invr,
+				offsetof(struct moepgf_algorithm, invr) },
+			{ ":divr", encode_divr,
+				offsetof(struct moepgf_algorithm, divr) },
+		},
+	},
+	{
+		.name	= "matmul",
+		.help	= "maddrc loop vs. moepgf_matmul, sweeping k "
+				"(sources) and m (rows) up to count",
+		.run	= benchmark_matmul,
+	},
+};
+
+#define BENCH_OP_COUNT	(int)(sizeof(ops)/sizeof(ops[0]))
+
+static int
+has_fn(const struct moepgf_algorithm *alg, size_t fn)
+{
+	return *(void **)((char *)alg + fn) != NULL;
+}
+
 static void *
 encode_thread(void *args)
 {
@@ -278,17 +1412,16 @@ encode_thread(void *args)
 	struct thread_state state;
 	uint8_t *frame;
 	int i;
-	void (*encode)(madd_t, int, uint8_t *, struct coding_buffer *,
-						struct thread_state *state);
 
 	memset(&state, 0, sizeof(state));
 	clock_gettime(CLOCK_MONOTONIC, &start);
 	state.rseed = (unsigned int)start.tv_nsec;
-	encode = encode_random;
 
-	if (ta->random == 0) {
-		encode = encode_permutation;
-	}
+	if (!(state.coefs = malloc(ta->count * (ta->rows ? ta->rows : 1))))
+		exit(-1);
+
+	if (ta->rows && cb_init(&state.out, ta->rows, ta->length, 64))
+		exit(-1);
 
 	if (posix_memalign((void *)&frame, 64, ta->length))
 		exit(-1);
@@ -300,7 +1433,7 @@ encode_thread(void *args)
 
 	clock_gettime(CLOCK_MONOTONIC, &start);
 	for (i=0; i<ta->rep; i++)
-		encode(ta->madd, ta->mask, frame, &cb, &state);
+		ta->encode(ta, frame, &cb, &state);
 	clock_gettime(CLOCK_MONOTONIC, &end);
 
 	timespecsub(&end, &start);
@@ -308,18 +1441,52 @@ encode_thread(void *args)
 	ta->gbps = (double)ta->rep/((double)end.tv_sec
 			+ (double)end.tv_nsec*1e-9);
 	ta->gbps *= ta->length*8.0*1e-9;
+	if (ta->rows)
+		ta->gbps *= ta->rows;
 
 	cb_free(&cb);
+	if (ta->rows)
+		cb_free(&state.out);
 	free(frame);
+	free(state.coefs);
 
 	return NULL;
 }
 
+static double
+run_threads(struct args *args, struct thread_info *tinfo,
+					const struct thread_args *ta)
+{
+	int m;
+	double gbps;
+
+	for (m=0; m<args->threads; m++)
+		tinfo[m].args = *ta;
+
+	for (m=0; m<args->threads; m++) {
+		tinfo[m].tid =
+			pthread_create(
+				&tinfo[m].thread, NULL,
+				encode_thread,
+				(void *)&tinfo[m].args);
+	}
+	for (m=0; m<args->threads; m++)
+		pthread_join(tinfo[m].thread, NULL);
+
+	gbps = 0;
+	for (m=0; m<args->threads; m++)
+		gbps += tinfo[m].args.gbps;
+
+	return gbps;
+}
+
 static void
 benchmark(struct args *args)
 {
-	int i,j,l,m,rep,fset;
+	int i,j,k,l,rep,fset;
 	uint32_t s;
+	const struct bench_op *op = &ops[args->op];
+	struct thread_args ta;
 	struct moepgf_algorithm **algs;
 	struct moepgf gf;
 	struct thread_info *tinfo;
@@ -333,9 +1500,9 @@ benchmark(struct args *args)
 	fprintf(stderr,
 		"\nEncoding benchmark: "
 		"Encoding throughput in Gbps (1e9 bits per sec)\n"
-		"maxsize=%d, count=%d, repetitions=%d, "
-		"threads=%d\n\n",	args->maxsize, args->count, args->repeat,
-		args->threads);
+		"op=%s, maxsize=%d, count=%d, repetitions=%d, "
+		"threads=%d\n\n",	op->name, args->maxsize,
+		args->count, args->repeat, args->threads);
 
 	s = rand();
 	for (i=0; i<RVAL_COUNT; i++)
@@ -351,7 +1518,11 @@ benchmark(struct args *args)
 		for (j=0; j<MOEPGF_ALGORITHM_COUNT; j++) {
 			if (!algs[j])
 				continue;
-			fprintf(stderr, "%s \t", moepgf_a2name(algs[j]->type));
+			for (k=0; k<BENCH_MAX_COLUMNS && op->col[k].encode; k++) {
+				fprintf(stderr, "%s%s \t",
+						moepgf_a2name(algs[j]->type),
+						op->col[k].suffix);
+			}
 		}
 		fprintf(stderr, "\n");
 
@@ -361,45 +1532,109 @@ benchmark(struct args *args)
 				if (!algs[j])
 					continue;
 
-				if (!(fset & (1 << algs[j]->hwcaps))) {
-					fprintf(stderr, "n/a      \t");
-					continue;
+				for (k=0; k<BENCH_MAX_COLUMNS && op->col[k].encode;
+									k++) {
+					if (!(fset & (1 << algs[j]->hwcaps))
+					|| !has_fn(algs[j], op->col[k].fn)) {
+						fprintf(stderr, "n/a      \t");
+						continue;
+					}
+
+					if (rep < 256) {
+						fprintf(stderr, "rep too small\t");
+						continue;
+					}
+
+					memset(&ta, 0, sizeof(ta));
+					ta.alg = algs[j];
+					ta.encode = op->col[k].encode;
+					ta.mask = gf.mask;
+					ta.length = l;
+					ta.rep = rep;
+					ta.random = args->random;
+					ta.count = args->count;
+
+					gbps = run_threads(args, tinfo, &ta);
+					fprintf(stderr, "%.6f \t", gbps);
 				}
+			}
+			fprintf(stderr, "\n");
+		}
+		fprintf(stderr, "\n");
+		moepgf_free_algs(algs);
+	}
 
-				if (rep < 256) {
-					fprintf(stderr, "rep too small\t");
-					continue;
-				}
+	free(tinfo);
+}
 
-				for (m=0; m<args->threads; m++) {
-					tinfo[m].args.madd = algs[j]->maddrc;
-					tinfo[m].args.mask = gf.mask;
-					tinfo[m].args.length = l;
-					tinfo[m].args.rep = rep;
-					tinfo[m].args.random = args->random;
-					tinfo[m].args.count = args->count;
-				}
+static void
+benchmark_matmul_sizes(struct args *args, struct thread_info *tinfo,
+					const struct moepgf *gf, int k, int m)
+{
+	int l,rep,r;
+	struct thread_args ta;
+
+	for (l=128, rep=args->repeat; l<=args->maxsize; l*=2, rep/=2) {
+		fprintf(stderr, "%d\t%d\t%d\t", k, m, l);
+
+		/* Keep the amount of work per setting comparable to the
+		 * encoding benchmark with count sources. A single repetition
+		 * already covers k*m regions, so fewer are acceptable. */
+		r = (int)((int64_t)rep * args->count / (k*m));
+		if (r < 16) {
+			fprintf(stderr, "rep too small\trep too small\n");
+			continue;
+		}
 
-				for (m=0; m<args->threads; m++) {
-					tinfo[m].tid =
-						pthread_create(
-							&tinfo[m].thread, NULL,
-							encode_thread,
-							(void *)&tinfo[m].args);
-				}
-				for (m=0; m<args->threads; m++)
-					pthread_join(tinfo[m].thread, NULL);
+		memset(&ta, 0, sizeof(ta));
+		ta.gf = gf;
+		ta.mask = gf->mask;
+		ta.length = l;
+		ta.rep = r;
+		ta.random = args->random;
+		ta.count = k;
+		ta.rows = m;
+
+		ta.encode = encode_matmul_loop;
+		fprintf(stderr, "%.6f \t", run_threads(args, tinfo, &ta));
+		ta.encode = encode_matmul;
+		fprintf(stderr, "%.6f \n", run_threads(args, tinfo, &ta));
+	}
+}
 
-				gbps = 0;
-				for (m=0; m<args->threads; m++)
-					gbps += tinfo[m].args.gbps;
+static void
+benchmark_matmul(struct args *args)
+{
+	int i,k,m;
+	uint32_t s;
+	struct moepgf gf;
+	struct thread_info *tinfo;
+	int kmin = args->count < 4 ? args->count : 4;
 
-				fprintf(stderr, "%.6f \t", gbps);
-			}
-			fprintf(stderr, "\n");
+	tinfo = malloc(args->threads * sizeof(*tinfo));
+	memset(tinfo, 0, args->threads * sizeof(*tinfo));
+
+	fprintf(stderr,
+		"\nMatrix multiplication benchmark: "
+		"Output throughput in Gbps (1e9 bits per sec)\n"
+		"maxsize=%d, k,m=%d..%d, repetitions=%d, threads=%d\n\n",
+		args->maxsize, kmin, args->count, args->repeat, args->threads);
+
+	s = rand();
+	for (i=0; i<RVAL_COUNT; i++)
+		_rval[i] = moepgf_rand(&s) & 0xff;
+
+	for (i=0; i<4; i++) {
+		moepgf_init(&gf, i, MOEPGF_ALGORITHM_BEST);
+
+		fprintf(stderr, "%s\n", gf.name);
+		fprintf(stderr, "k\tm\tsize \tloop     \tmatmul   \n");
+
+		for (k=kmin; k<=args->count; k*=2) {
+			for (m=kmin; m<=args->count; m*=2)
+				benchmark_matmul_sizes(args, tinfo, &gf, k, m);
 		}
 		fprintf(stderr, "\n");
-		moepgf_free_algs(algs);
 	}
 
 	free(tinfo);
@@ -408,29 +1643,49 @@ benchmark(struct args *args)
 static void
 print_help(const char *name)
 {
-	fprintf(stdout, "Usage: %s [-m maxsize] [-c count] [-r repeat] "\
-			"[-t threads] [-d]\n\n", name);
+	int i;
+
+	fprintf(stdout, "Usage: %s [-o op] [-m maxsize] [-c count] "\
+			"[-r repeat] [-t threads] [-d] [-s]\n\n", name);
+	fprintf(stdout, "    -o op        Operation to benchmark:\n");
+	for (i=0; i<BENCH_OP_COUNT; i++) {
+		fprintf(stdout, "                 %-14s %s\n", ops[i].name,
+								ops[i].help);
+	}
 	fprintf(stdout, "    -m maxsize   Maximum packet size [Byte]\n");
 	fprintf(stdout, "    -c count     Number of packets per generation\n");
 	fprintf(stdout, "    -r repeat    Number of repetitions per setting\n");
 	fprintf(stdout, "    -t threads   Number of threads to use\n");
 	fprintf(stdout, "    -d           Deterministic permutation of coefficients\n");
+	fprintf(stdout, "    -s           Run the selftest only\n");
 	fprintf(stdout, "\n");
 }
 
 int
 main(int argc, char **argv)
 {
-	int opt;
+	int opt, i, selftest_only = 0;
 
+	args.op = 0;
 	args.count = 16;
 	args.maxsize = 1024*1024*8;
 	args.repeat = 1024*1024;
 	args.random = 1;
 	args.threads = 1;
 
-	while (-1 != (opt = getopt(argc, argv, "m:c:r:t:dh"))) {
+	while (-1 != (opt = getopt(argc, argv, "o:m:c:r:t:dsh"))) {
 		switch (opt) {
+		case 'o':
+			for (i=0; i<BENCH_OP_COUNT; i++) {
+				if (!strcmp(optarg, ops[i].name))
+					break;
+			}
+			if (i == BENCH_OP_COUNT) {
+				fprintf(stderr, "unknown op %s\n\n", optarg);
+				exit(-1);
+			}
+			args.op = i;
+			break;
 		case 'm':
 			args.maxsize = atoi(optarg);
 			if (args.maxsize < 128) {
@@ -455,6 +1710,9 @@ main(int argc, char **argv)
 		case 'd':
 			args.random = 0;
 			break;
+		case 's':
+			selftest_only = 1;
+			break;
 		case 't':
 			args.threads = atoi(optarg);
 			if (args.threads < 1) {
@@ -473,7 +1731,14 @@ main(int argc, char **argv)
 	}
 
 	selftest();
-	benchmark(&args);
+	if (failures) {
+		fprintf(stderr, "selftest failed: %d errors\n", failures);
+		exit(-1);
+	}
+	if (selftest_only)
+		return 0;
+
+	ops[args.op].run(&args);
 
 	return 0;
 }
@@ -0,0 +1,6 @@
+#!/bin/sh
+#
+# Runs the selftest of moepgfbench for make check. Cross-compiled aarch64
+# builds run it with the user-mode emulator given in QEMU.
+
+exec $LIBTOOL --mode=execute $QEMU ./moepgfbench -s
@@ -23,14 +23,17 @@
 #ifndef __MOEPGF_H_
 #define __MOEPGF_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
 /*
  * Maximum memory alignment used by kernels. Any memory regions supplied to the
  * library must be aligned to this value and the length of those regions must
- * be a multiple of this value.
+ * be a multiple of this value. The actual requirements of a particular GF are
+ * given by the members alignment and granularity of struct moepgf and may be
+ * smaller. The value covers the 64 byte vectors of the AVX-512 kernels.
  */
-#define MOEPGF_MAX_ALIGNMENT 32
+#define MOEPGF_MAX_ALIGNMENT 64
 
 /*
  * Definitions for hardware SIMD capabilities.
@@ -51,7 +54,12 @@ enum MOEPGF_HWCAPS
 	MOEPGF_HWCAPS_SIMD_AVX512GFNI	= 11,
 	MOEPGF_HWCAPS_SIMD_NEON		= 12,
 	MOEPGF_HWCAPS_SIMD_MSA		= 13,
-	MOEPGF_HWCAPS_COUNT		= 14,
+	MOEPGF_HWCAPS_SIMD_GFNI		= 14,
+	MOEPGF_HWCAPS_SIMD_AVX512VL	= 15,
+	MOEPGF_HWCAPS_SIMD_AVX512VBMI	= 16,
+	MOEPGF_HWCAPS_SIMD_NEON_SHA3	= 17,
+	MOEPGF_HWCAPS_SIMD_VECTOR	= 18,
+	MOEPGF_HWCAPS_COUNT		= 19,
 };
 
 /*
@@ -78,8 +86,22 @@ enum MOEPGF_HWCAPS
 #define MOEPGF256_MASK			(MOEPGF256_SIZE - 1)
 
 typedef void	(*maddrc_t)	(uint8_t *, const uint8_t *, uint8_t, size_t);
+typedef void	(*maddrc_multi_t)(uint8_t *, const uint8_t **, const uint8_t *,
+								int, size_t);
+typedef void	(*maddrc_fanout_t)(uint8_t **, const uint8_t *, const uint8_t *,
+								int, size_t);
+typedef void	(*maddrc3_t)	(uint8_t *, const uint8_t *, const uint8_t *,
+							uint8_t, size_t);
 typedef void	(*mulrc_t)	(uint8_t *, uint8_t, size_t);
+typedef void	(*mulrc_copy_t)	(uint8_t *, const uint8_t *, uint8_t, size_t);
+typedef void	(*mulrr_t)	(uint8_t *, const uint8_t *, size_t);
+typedef void	(*maddrr_t)	(uint8_t *, const uint8_t *, const uint8_t *, size_t);
+typedef void	(*invr_t)	(uint8_t *, size_t);
+typedef void	(*divr_t)	(uint8_t *, const uint8_t *, size_t);
 typedef uint8_t	(*inv_t)	(uint8_t);
+typedef void	(*maddrc_prefetch_t)(uint8_t *, const uint8_t *, uint8_t, size_t,
+								size_t);
+typedef void	(*mulrc_prefetch_t)(uint8_t *, uint8_t, size_t, size_t);
 
 /*
  * Used to identify different GFs.
@@ -124,13 +146,40 @@ enum MOEPGF_ALGORITHM
 	MOEPGF_GFNI128,
 	MOEPGF_GFNI256,
 	MOEPGF_GFNI512,
+	MOEPGF_GFNI_AFFINE128,
+	MOEPGF_GFNI_AFFINE256,
+	MOEPGF_GFNI_AFFINE512,
+	MOEPGF_LOOKUP_AVX512VBMI,
+	MOEPGF_SHUFFLE_AVX512VL,
+	MOEPGF_GFNI_AFFINE_AVX512VL,
+	MOEPGF_SHUFFLE_NEON_128,
+	MOEPGF_PMULL_NEON_128,
+	MOEPGF_SHUFFLE_NEON_SHA3,
+	MOEPGF_SHUFFLE_VECTOR,
+	MOEPGF_SHUFFLE_SSSE3_X2,
+	MOEPGF_SHUFFLE_SSSE3_X4,
+	MOEPGF_SHUFFLE_AVX2_X2,
+	MOEPGF_SHUFFLE_AVX2_X4,
+	MOEPGF_SHUFFLE_AVX512_X2,
+	MOEPGF_SHUFFLE_AVX512_X4,
 	MOEPGF_ALGORITHM_BEST,
+	MOEPGF_ALGORITHM_AUTOTUNE,
 	MOEPGF_ALGORITHM_COUNT
 };
 
 /*
  * Structure representing a moepgf algorithm, including function pointers and
- * informations about the algorithm, required hwcaps and field.
+ * informations about the algorithm, required hwcaps and field. Function
+ * pointers other than maddrc are NULL if the algorithm does not implement the
+ * respective operation. Kernels mulrc_copy_nt and maddrc3_nt are variants of
+ * mulrc_copy and maddrc3 that write r1 with non-temporal stores regardless of
+ * the length. Kernels maddrc_prefetch and mulrc_prefetch are variants of maddrc
+ * and mulrc that take a distance in bytes as additional last argument and
+ * prefetch the regions that far ahead of the current position. Prefetches go
+ * beyond the end of the regions, i.e., they also fetch the start of a region
+ * that directly follows, e.g., the next slot of a coding buffer. Members
+ * alignment and granularity specify the memory alignment and the length
+ * granularity in bytes required by the algorithm's kernels, see struct moepgf.
  */
 struct moepgf_algorithm {
 	maddrc_t		maddrc;
@@ -138,11 +187,28 @@ struct moepgf_algorithm {
 	enum MOEPGF_HWCAPS	hwcaps;
 	enum MOEPGF_ALGORITHM	type;
 	enum MOEPGF_TYPE	field;
+	maddrc_multi_t		maddrc_multi;
+	maddrc_fanout_t		maddrc_fanout;
+	maddrc3_t		maddrc3;
+	mulrc_copy_t		mulrc_copy;
+	mulrr_t			mulrr;
+	maddrr_t		maddrr;
+	invr_t			invr;
+	divr_t			divr;
+	maddrc_t		maddrc_unaligned;
+	mulrc_t			mulrc_unaligned;
+	mulrc_copy_t		mulrc_copy_nt;
+	maddrc3_t		maddrc3_nt;
+	maddrc_prefetch_t	maddrc_prefetch;
+	mulrc_prefetch_t	mulrc_prefetch;
+	size_t			alignment;
+	size_t			granularity;
 };
 
 /*
  * Structure representing a GF, including functions to user-accessible
- * functions maddrc, mulrc, and inv.
+ * functions maddrc, mulrc, maddrc_multi, maddrc_fanout, maddrc3, mulrc_copy,
+ * mulrr, maddrr, invr, divr, maddrc_unaligned, mulrc_unaligned, and inv.
  *
  * void maddrc(uint8_t * r1, const uint8_t *r2, uint8_t constant, size_t len)
  * Multiplies region r2 by constant and adds the result to region r1. The result
@@ -152,9 +218,70 @@ struct moepgf_algorithm {
  * Multiplies region r of length len by constant. The result is stored in
  * region r.
  *
+ * void mulrc_copy(uint8_t *r1, const uint8_t *r2, uint8_t constant, size_t len)
+ * Multiplies region r2 of length len by constant and stores the result in
+ * region r1, i.e., the result is the same as copying r2 to r1 and calling mulrc
+ * on r1, but both regions are traversed only once. Region r2 is not modified
+ * unless it is identical to r1.
+ *
+ * void maddrc_multi(uint8_t *r1, const uint8_t **r2,
+ *			const uint8_t *constants, int count, size_t len)
+ * Multiplies each of the count regions r2[i] by constants[i] and adds the
+ * results to region r1, i.e., the result is the same as calling maddrc count
+ * times. Region r1 is only loaded and stored once, though, which saves memory
+ * bandwidth when many regions are combined.
+ *
+ * void maddrc_fanout(uint8_t **r1, const uint8_t *r2,
+ *			const uint8_t *constants, int count, size_t len)
+ * Multiplies region r2 by each of the count constants[i] and adds the results
+ * to regions r1[i], i.e., the result is the same as calling maddrc count
+ * times. Region r2 is loaded once for a group of destination regions whose
+ * multiplication tables are kept in registers.
+ *
+ * void maddrc3(uint8_t *r1, const uint8_t *r2, const uint8_t *r3,
+ *			uint8_t constant, size_t len)
+ * Multiplies region r3 by constant, adds region r2 and stores the result in
+ * region r1 without modifying r2 or r3, i.e., the result is the same as copying
+ * r2 to r1 and calling maddrc on r1 and r3, but r1 is never read. Region r1
+ * may be identical to r2.
+ *
+ * void mulrr(uint8_t *r1, const uint8_t *r2, size_t len)
+ * Multiplies region r1 element-wise by region r2, i.e., each element of r1 is
+ * replaced by its product with the element at the same position in r2. Both
+ * regions have length len.
+ *
+ * void maddrr(uint8_t *r1, const uint8_t *r2, const uint8_t *r3, size_t len)
+ * Multiplies region r2 element-wise by region r3 and adds the result to
+ * region r1.
+ *
+ * void invr(uint8_t *r, size_t len)
+ * Replaces each element of region r of length len by its inverse. Zero
+ * elements remain zero.
+ *
+ * void divr(uint8_t *r1, const uint8_t *r2, size_t len)
+ * Divides region r1 element-wise by region r2, i.e., each element of r1 is
+ * multiplied by the inverse of the element at the same position in r2. As for
+ * invr, the inverse of zero is taken to be zero, i.e., elements of r1 are
+ * cleared where r2 is zero.
+ *
+ * void maddrc_unaligned(uint8_t *r1, const uint8_t *r2, uint8_t constant,
+ *			size_t len)
+ * void mulrc_unaligned(uint8_t *r, uint8_t constant, size_t len)
+ * Same as maddrc and mulrc, but regions may start at any address and exactly
+ * len bytes are accessed. The alignment rules below do not apply, i.e., both
+ * functions may be used directly on payloads within larger buffers. Bulk data
+ * is processed with unaligned vector loads and stores. The tail is handled by
+ * masked loads and stores (AVX-512) or by an overlapping last vector.
+ *
  * uint8_t inv(uint8_t x)
  * Returns the inverse element of x.
  *
+ * If the GF is initialized with MOEPGF_ALGORITHM_BEST, mulrc_copy and maddrc3
+ * write regions of at least nt_threshold bytes with non-temporal stores, which
+ * bypass the caches and avoid reading r1 into the cache before it is
+ * overwritten. The threshold is the size of the last level cache. It is zero
+ * if no such kernels are available.
+ *
  *
  * IMPORTANT: If len is not a multiple of MOEPGF_MAX_ALIGNMENT, SIMD
  * implementations may silently access memory addresses up to the next multiple
@@ -168,6 +295,13 @@ struct moepgf_algorithm {
  * 1) Regions r1 and r2 must be aligned to MOEPGF_MAX_ALIGNMENT and the
  *    allocated memory regions must be a multiple of MOEPGF_MAX_ALIGNMENT.
  * 2) len must be a multiple of MOEPGF_MAX_ALIGNMENT.
+ * This does not apply to maddrc_unaligned and mulrc_unaligned.
+ *
+ * The members alignment and granularity hold the actual requirements of the
+ * selected kernels, i.e., regions must be aligned to alignment bytes and
+ * kernels may access memory up to the next multiple of granularity. Both are
+ * powers of two no larger than MOEPGF_MAX_ALIGNMENT. Use moepgf_alloc() to
+ * obtain suitable regions.
  */
 struct moepgf {
 	enum MOEPGF_TYPE		type;
@@ -180,6 +314,19 @@ struct moepgf {
 	maddrc_t			maddrc;
 	mulrc_t				mulrc;
 	inv_t				inv;
+	maddrc_multi_t			maddrc_multi;
+	maddrc_fanout_t			maddrc_fanout;
+	maddrc3_t			maddrc3;
+	mulrc_copy_t			mulrc_copy;
+	mulrr_t				mulrr;
+	maddrr_t			maddrr;
+	invr_t				invr;
+	divr_t				divr;
+	maddrc_t			maddrc_unaligned;
+	mulrc_t				mulrc_unaligned;
+	size_t				alignment;
+	size_t				granularity;
+	size_t				nt_threshold;
 };
 
 /*
@@ -199,6 +346,41 @@ uint32_t moepgf_check_available_simd_extensions();
  * to zero, the fastest implementation available for the current architecture is
  * automatically determined. The function returns 0 on success and -1 on any
  * error, e.g. the requested SIMD extensions are not available.
+ *
+ * Any algorithm returned by moepgf_get_algs() may be requested. The function
+ * fails if the algorithm is not implemented for the field or requires hwcaps
+ * that are not available. Operations the algorithm does not implement are
+ * taken from MOEPGF_SELFTEST. For MOEPGF_ALGORITHM_BEST and
+ * MOEPGF_ALGORITHM_AUTOTUNE, the environment variable MOEPGF<field>_ALGORITHM,
+ * e.g., MOEPGF256_ALGORITHM=shuffle_avx2, forces the algorithm of the given
+ * name as returned by moepgf_a2name(), or "best" or "autotune". Unknown names
+ * make the function fail.
+ *
+ * The environment variable MOEPGF_MAX_VECTOR_WIDTH caps the vector width in
+ * bits of the kernels chosen by MOEPGF_ALGORITHM_BEST and
+ * MOEPGF_ALGORITHM_AUTOTUNE, e.g., MOEPGF_MAX_VECTOR_WIDTH=256 avoids the
+ * frequency drop of 512 bit instructions on some CPUs while AVX512VL and GFNI
+ * kernels on 256 bit registers remain available. Values that are not a number
+ * of at least 64 make the function fail.
+ *
+ * MOEPGF_ALGORITHM_AUTOTUNE starts from MOEPGF_ALGORITHM_BEST and times every
+ * applicable kernel returned by moepgf_get_algs() for each operation, which
+ * takes in the order of a second per field. The fastest kernels are stored in
+ * a profile file that is loaded by later calls and processes instead of
+ * measuring again. The profile is discarded if its version, the CPU model or
+ * its microcode revision differ. Its path is taken from the environment
+ * variable MOEPGF_PROFILE and defaults to $XDG_CACHE_HOME/libmoepgf.profile or
+ * $HOME/.cache/libmoepgf.profile. An empty MOEPGF_PROFILE disables the file.
+ * Kernels are selected and stored per value of MOEPGF_MAX_VECTOR_WIDTH,
+ * rounded down to a power of two, such that GFs with different caps neither
+ * share kernels nor overwrite each other's profile entries.
+ * The maddrc and mulrc functions are calibrated separately for lengths of up
+ * to 64, 128, ..., 4096 bytes and larger lengths. If different kernels win,
+ * each call is dispatched by its length to the kernel of the respective size
+ * class. If the kernels selected for maddrc and mulrc have prefetching
+ * variants, see struct moepgf_algorithm, the prefetch distance is calibrated
+ * on a walk over back to back regions of 1024 bytes and the variants are used
+ * if prefetching pays off.
  */
 int moepgf_init(struct moepgf *gf, enum MOEPGF_TYPE type,
 						enum MOEPGF_ALGORITHM atype);
@@ -215,6 +397,124 @@ struct moepgf_algorithm ** moepgf_get_algs(enum MOEPGF_TYPE type);
  */
 void moepgf_free_algs(struct moepgf_algorithm **algs);
 
+/*
+ * Allocates a region of at least len bytes that meets the alignment and
+ * granularity requirements of gf, i.e., the region is aligned to
+ * gf->alignment and its size is rounded up to a multiple of gf->granularity.
+ * Padding bytes are zeroed. Returns NULL on error. The region must be released
+ * by moepgf_free().
+ */
+void * moepgf_alloc(const struct moepgf *gf, size_t len);
+
+/*
+ * Frees a region previously allocated by moepgf_alloc().
+ */
+void moepgf_free(void *p);
+
+/*
+ * Computes the matrix product out = coef * in, where in is an array of k
+ * regions, out is an array of m regions, and coef is an m x k matrix of
+ * constants stored in row-major order, i.e.,
+ *
+ *	out[i] = sum_j coef[i*k+j] * in[j]
+ *
+ * for all 0 <= i < m. All regions are of length len and out is overwritten.
+ * The regions are processed in tiles that fit into the CPU caches such that
+ * each input is only streamed from memory once. Output rows are processed in
+ * groups using the maddrc_fanout function of gf, such that each input tile is
+ * loaded once per group of rows rather than once per row. No memory is
+ * allocated. The same alignment rules as for maddrc apply. Returns 0 on
+ * success and -1 on error.
+ */
+int moepgf_matmul(const struct moepgf *gf, uint8_t **out, const uint8_t **in,
+			const uint8_t *coef, int m, int k, size_t len);
+
+/*
+ * Directly callable kernels moepgf<field>_<op> for all fields and operations
+ * of struct moepgf. They behave like the respective function pointers of a
+ * struct moepgf initialized with MOEPGF_ALGORITHM_BEST, i.e., the same
+ * alignment rules apply, but without non-temporal dispatching for long
+ * regions. The kernels are resolved once, either by the dynamic linker or on
+ * the first call, and the result of the CPU feature detection is cached.
+ * Environment variables are not taken into account, i.e., the kernels are not
+ * subject to MOEPGF_MAX_VECTOR_WIDTH.
+ */
+void moepgf2_maddrc(uint8_t *r1, const uint8_t *r2, uint8_t c, size_t len);
+void moepgf2_mulrc(uint8_t *r, uint8_t c, size_t len);
+void moepgf2_maddrc_multi(uint8_t *r1, const uint8_t **r2, const uint8_t *c,
+						int count, size_t len);
+void moepgf2_maddrc_fanout(uint8_t **r1, const uint8_t *r2, const uint8_t *c,
+						int count, size_t len);
+void moepgf2_maddrc3(uint8_t *r1, const uint8_t *r2, const uint8_t *r3,
+						uint8_t c, size_t len);
+void moepgf2_mulrc_copy(uint8_t *r1, const uint8_t *r2, uint8_t c,
+							size_t len);
+void moepgf2_mulrr(uint8_t *r1, const uint8_t *r2, size_t len);
+void moepgf2_maddrr(uint8_t *r1, const uint8_t *r2, const uint8_t *r3,
+							size_t len);
+void moepgf2_invr(uint8_t *r, size_t len);
+void moepgf2_divr(uint8_t *r1, const uint8_t *r2, size_t len);
+void moepgf2_maddrc_unaligned(uint8_t *r1, const uint8_t *r2, uint8_t c,
+							size_t len);
+void moepgf2_mulrc_unaligned(uint8_t *r, uint8_t c, size_t len);
+
+void moepgf4_maddrc(uint8_t *r1, const uint8_t *r2, uint8_t c, size_t len);
+void moepgf4_mulrc(uint8_t *r, uint8_t c, size_t len);
+void moepgf4_maddrc_multi(uint8_t *r1, const uint8_t **r2, const uint8_t *c,
+						int count, size_t len);
+void moepgf4_maddrc_fanout(uint8_t **r1, const uint8_t *r2, const uint8_t *c,
+						int count, size_t len);
+void moepgf4_maddrc3(uint8_t *r1, const uint8_t *r2, const uint8_t *r3,
+						uint8_t c, size_t len);
+void moepgf4_mulrc_copy(uint8_t *r1, const uint8_t *r2, uint8_t c,
+							size_t len);
+void moepgf4_mulrr(uint8_t *r1, const uint8_t *r2, size_t len);
+void moepgf4_maddrr(uint8_t *r1, const uint8_t *r2, const uint8_t *r3,
+							size_t len);
+void moepgf4_invr(uint8_t *r, size_t len);
+void moepgf4_divr(uint8_t *r1, const uint8_t *r2, size_t len);
+void moepgf4_maddrc_unaligned(uint8_t *r1, const uint8_t *r2, uint8_t c,
+							size_t len);
+void moepgf4_mulrc_unaligned(uint8_t *r, uint8_t c, size_t len);
+
+void moepgf16_maddrc(uint8_t *r1, const uint8_t *r2, uint8_t c, size_t len);
+void moepgf16_mulrc(uint8_t *r, uint8_t c, size_t len);
+void moepgf16_maddrc_multi(uint8_t *r1, const uint8_t **r2, const uint8_t *c,
+						int count, size_t len);
+void moepgf16_maddrc_fanout(uint8_t **r1, const uint8_t *r2, const uint8_t *c,
+						int count, size_t len);
+void moepgf16_maddrc3(uint8_t *r1, const uint8_t *r2, const uint8_t *r3,
+						uint8_t c, size_t len);
+void moepgf16_mulrc_copy(uint8_t *r1, const uint8_t *r2, uint8_t c,
+							size_t len);
+void moepgf16_mulrr(uint8_t *r1, const uint8_t *r2, size_t len);
+void moepgf16_maddrr(uint8_t *r1, const uint8_t *r2, const uint8_t *r3,
+							size_t len);
+void moepgf16_invr(uint8_t *r, size_t len);
+void moepgf16_divr(uint8_t *r1, const uint8_t *r2, size_t len);
+void moepgf16_maddrc_unaligned(uint8_t *r1, const uint8_t *r2, uint8_t c,
+							size_t len);
+void moepgf16_mulrc_unaligned(uint8_t *r, uint8_t c, size_t len);
+
+void moepgf256_maddrc(uint8_t *r1, const uint8_t *r2, uint8_t c, size_t len);
+void moepgf256_mulrc(uint8_t *r, uint8_t c, size_t len);
+void moepgf256_maddrc_multi(uint8_t *r1, const uint8_t **r2, const uint8_t *c,
+						int count, size_t len);
+void moepgf256_maddrc_fanout(uint8_t **r1, const uint8_t *r2, const uint8_t *c,
+						int count, size_t len);
+void moepgf256_maddrc3(uint8_t *r1, const uint8_t *r2, const uint8_t *r3,
+						uint8_t c, size_t len);
+void moepgf256_mulrc_copy(uint8_t *r1, const uint8_t *r2, uint8_t c,
+							size_t len);
+void moepgf256_mulrr(uint8_t *r1, const uint8_t *r2, size_t len);
+void moepgf256_maddrr(uint8_t *r1, const uint8_t *r2, const uint8_t *r3,
+							size_t len);
+void moepgf256_invr(uint8_t *r, size_t len);
+void moepgf256_divr(uint8_t *r1, const uint8_t *r2, size_t len);
+void moepgf256_maddrc_unaligned(uint8_t *r1, const uint8_t *r2, uint8_t c,
+							size_t len);
+void moepgf256_mulrc_unaligned(uint8_t *r, uint8_t c, size_t len);
+
 static inline uint8_t
 moepgf_rand(uint32_t *s)
 {
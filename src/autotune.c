@@ -0,0 +1,929 @@
+/*
+ * This file is part of moep80211gf.
+ *
+ * Copyright (C) 2014   Stephan M. Guenther <moepi@moepi.net>
+ *
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 2.1 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library. If not, see <https://www.gnu.org/licenses/>
+ *
+ */
+
+#include <pthread.h>
+#include <string.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <moepgf/moepgf.h>
+
+#include "autotune.h"
+
+/*
+ * Version of the profile file format. Profiles with a different version are
+ * discarded and the measurements are repeated.
+ */
+#define PROFILE_VERSION		3
+#define PROFILE_MAGIC		"moepgf-profile"
+#define PROFILE_ENV		"MOEPGF_PROFILE"
+#define PROFILE_NAME		"libmoepgf.profile"
+#define PROFILE_BEST		"best"
+
+/*
+ * Lengths at which kernels are timed and amount of data processed per
+ * measurement. Each length is weighted equally, i.e., the kernel with the
+ * smallest sum of times per byte wins.
+ */
+#define TUNE_BYTES		(128*1024)
+#define TUNE_TRIALS		3
+#define TUNE_SOURCES		4
+#define TUNE_MAX_LENGTH		65536
+
+/*
+ * A kernel only replaces the current selection if it needs less than
+ * TUNE_MARGIN of its time, which keeps the static choice in case of
+ * measurement noise.
+ */
+#define TUNE_MARGIN		0.95
+
+static const size_t tune_lengths[] = { 256, 4096, TUNE_MAX_LENGTH };
+
+#define TUNE_LENGTH_COUNT	(sizeof(tune_lengths)/sizeof(tune_lengths[0]))
+
+/*
+ * Bucketed operations select a kernel per call depending on the length. The
+ * first bucket holds lengths up to 1 << SIZE_BUCKET_SHIFT, each following
+ * bucket twice as much, and the last bucket all remaining lengths. Buckets are
+ * calibrated at their largest length and at TUNE_MAX_LENGTH, respectively.
+ */
+#define SIZE_BUCKETS		8
+#define SIZE_BUCKET_SHIFT	6
+
+/*
+ * Prefetch distances in bytes tried for operations whose selected algorithm
+ * provides a prefetching kernel. Zero selects the plain kernel. Distances are
+ * timed on a walk over back to back regions of PREFETCH_LENGTH bytes spanning
+ * PREFETCH_BYTES, i.e., each call starts on a region that is not in the L1 or
+ * L2 cache and the hardware prefetcher has little time to catch up.
+ */
+#define PREFETCH_LENGTH		1024
+#define PREFETCH_BYTES		(4*1024*1024)
+#define PREFETCH_UNKNOWN	SIZE_MAX
+
+static const size_t prefetch_distances[] = { 0, 256, 512, 1024, 2048, 4096 };
+
+#define PREFETCH_DISTANCE_COUNT	\
+	(sizeof(prefetch_distances)/sizeof(prefetch_distances[0]))
+
+/*
+ * Vector width limits given by MOEPGF_MAX_VECTOR_WIDTH are tuned separately.
+ * The limit is rounded down to TUNE_MIN_WIDTH << w bytes for a width index
+ * 0 <= w < TUNE_WIDTHS, which does not change the set of candidates since
+ * all kernels have a power of two granularity of at most MOEPGF_MAX_ALIGNMENT.
+ */
+#define TUNE_MIN_WIDTH		8
+#define TUNE_WIDTHS		4
+
+/*
+ * Operations subject to autotuning. Offsets locate the function pointers in
+ * struct moepgf_algorithm and struct moepgf, respectively, and the prefetching
+ * kernel in struct moepgf_algorithm, which is zero if there is none.
+ */
+enum TUNE_OP {
+	TUNE_MADDRC		= 0,
+	TUNE_MULRC,
+	TUNE_MADDRC_MULTI,
+	TUNE_MADDRC_FANOUT,
+	TUNE_MADDRC3,
+	TUNE_MULRC_COPY,
+	TUNE_MULRR,
+	TUNE_MADDRR,
+	TUNE_INVR,
+	TUNE_DIVR,
+	TUNE_MADDRC_UNALIGNED,
+	TUNE_MULRC_UNALIGNED,
+	TUNE_OP_COUNT
+};
+
+static const struct {
+	const char	*name;
+	size_t		alg;
+	size_t		gf;
+	int		buckets;
+	size_t		prefetch;
+} tune_ops[TUNE_OP_COUNT] = {
+	[TUNE_MADDRC] = { "maddrc",
+		offsetof(struct moepgf_algorithm, maddrc),
+		offsetof(struct moepgf, maddrc), SIZE_BUCKETS,
+		offsetof(struct moepgf_algorithm, maddrc_prefetch) },
+	[TUNE_MULRC] = { "mulrc",
+		offsetof(struct moepgf_algorithm, mulrc),
+		offsetof(struct moepgf, mulrc), SIZE_BUCKETS,
+		offsetof(struct moepgf_algorithm, mulrc_prefetch) },
+	[TUNE_MADDRC_MULTI] = { "maddrc_multi",
+		offsetof(struct moepgf_algorithm, maddrc_multi),
+		offsetof(struct moepgf, maddrc_multi), 1 },
+	[TUNE_MADDRC_FANOUT] = { "maddrc_fanout",
+		offsetof(struct moepgf_algorithm, maddrc_fanout),
+		offsetof(struct moepgf, maddrc_fanout), 1 },
+	[TUNE_MADDRC3] = { "maddrc3",
+		offsetof(struct moepgf_algorithm, maddrc3),
+		offsetof(struct moepgf, maddrc3), 1 },
+	[TUNE_MULRC_COPY] = { "mulrc_copy",
+		offsetof(struct moepgf_algorithm, mulrc_copy),
+		offsetof(struct moepgf, mulrc_copy), 1 },
+	[TUNE_MULRR] = { "mulrr",
+		offsetof(struct moepgf_algorithm, mulrr),
+		offsetof(struct moepgf, mulrr), 1 },
+	[TUNE_MADDRR] = { "maddrr",
+		offsetof(struct moepgf_algorithm, maddrr),
+		offsetof(struct moepgf, maddrr), 1 },
+	[TUNE_INVR] = { "invr",
+		offsetof(struct moepgf_algorithm, invr),
+		offsetof(struct moepgf, invr), 1 },
+	[TUNE_DIVR] = { "divr",
+		offsetof(struct moepgf_algorithm, divr),
+		offsetof(struct moepgf, divr), 1 },
+	[TUNE_MADDRC_UNALIGNED] = { "maddrc_unaligned",
+		offsetof(struct moepgf_algorithm, maddrc_unaligned),
+		offsetof(struct moepgf, maddrc_unaligned), 1 },
+	[TUNE_MULRC_UNALIGNED] = { "mulrc_unaligned",
+		offsetof(struct moepgf_algorithm, mulrc_unaligned),
+		offsetof(struct moepgf, mulrc_unaligned), 1 },
+};
+
+/*
+ * Serializes autotune(), which is the only user of the profile, the prefetch
+ * distances, and the dispatch tables below.
+ */
+static pthread_mutex_t tune_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ * Selected algorithm per field, width index, operation, and size bucket.
+ * Operations that are not bucketed only use the first bucket.
+ * MOEPGF_ALGORITHM_BEST denotes the kernel from the static best_algorithms
+ * table, MOEPGF_SELFTEST an entry that has not been determined yet.
+ */
+static enum MOEPGF_ALGORITHM
+	profile[MOEPGF_COUNT][TUNE_WIDTHS][TUNE_OP_COUNT][SIZE_BUCKETS];
+static int profile_loaded;
+
+/*
+ * Selected prefetch distance per field, width index, and operation with a
+ * prefetching kernel, PREFETCH_UNKNOWN if it has not been determined yet.
+ */
+static size_t prefetch[MOEPGF_COUNT][TUNE_WIDTHS][TUNE_OP_COUNT];
+
+/*
+ * Kernels per size bucket used by the bucketed maddrc and mulrc functions of
+ * each field and width index. Buckets with a prefetching kernel call it with
+ * the respective distance instead of the plain kernel. The kernels do not get
+ * the GF passed, hence GFs of different width limits use separate entries.
+ * An entry is only written before its wrappers are handed out for the first
+ * time and marked ready afterwards, i.e., GFs may call the wrappers while
+ * other GFs are being initialized.
+ */
+static struct {
+	maddrc_t		maddrc[SIZE_BUCKETS];
+	mulrc_t			mulrc[SIZE_BUCKETS];
+	maddrc_prefetch_t	maddrc_prefetch[SIZE_BUCKETS];
+	mulrc_prefetch_t	mulrc_prefetch[SIZE_BUCKETS];
+	size_t			maddrc_distance;
+	size_t			mulrc_distance;
+	int			ready;
+} dispatch[MOEPGF_COUNT][TUNE_WIDTHS];
+
+static inline int
+size_bucket(size_t length)
+{
+	int b;
+
+	if (length <= (1 << SIZE_BUCKET_SHIFT))
+		return 0;
+
+	b = 8*sizeof(unsigned long) - __builtin_clzl(length-1)
+							- SIZE_BUCKET_SHIFT;
+
+	return b < SIZE_BUCKETS ? b : SIZE_BUCKETS-1;
+}
+
+static size_t
+bucket_length(int b)
+{
+	if (b == SIZE_BUCKETS-1)
+		return TUNE_MAX_LENGTH;
+
+	return (size_t)1 << (b + SIZE_BUCKET_SHIFT);
+}
+
+#define BUCKETED(field, bits, w)					\
+static void								\
+maddrc##field##_bucketed##bits(uint8_t *region1, const uint8_t *region2,\
+					uint8_t constant, size_t length)\
+{									\
+	int b = size_bucket(length);					\
+									\
+	if (dispatch[MOEPGF##field][w].maddrc_prefetch[b])		\
+		dispatch[MOEPGF##field][w].maddrc_prefetch[b](region1,	\
+				region2, constant, length,		\
+				dispatch[MOEPGF##field][w].maddrc_distance);\
+	else								\
+		dispatch[MOEPGF##field][w].maddrc[b](region1, region2,	\
+							constant, length);\
+}									\
+static void								\
+mulrc##field##_bucketed##bits(uint8_t *region, uint8_t constant,	\
+								size_t length)\
+{									\
+	int b = size_bucket(length);					\
+									\
+	if (dispatch[MOEPGF##field][w].mulrc_prefetch[b])		\
+		dispatch[MOEPGF##field][w].mulrc_prefetch[b](region,	\
+				constant, length,			\
+				dispatch[MOEPGF##field][w].mulrc_distance);\
+	else								\
+		dispatch[MOEPGF##field][w].mulrc[b](region, constant,	\
+								length);\
+}
+
+#define BUCKETED_WIDTHS(field)						\
+	BUCKETED(field, 64, 0)						\
+	BUCKETED(field, 128, 1)						\
+	BUCKETED(field, 256, 2)						\
+	BUCKETED(field, 512, 3)
+
+BUCKETED_WIDTHS(2)
+BUCKETED_WIDTHS(4)
+BUCKETED_WIDTHS(16)
+BUCKETED_WIDTHS(256)
+
+#define BUCKETED_ENTRY(field)						\
+	[MOEPGF##field] = {						\
+		{ maddrc##field##_bucketed64, mulrc##field##_bucketed64 },\
+		{ maddrc##field##_bucketed128, mulrc##field##_bucketed128 },\
+		{ maddrc##field##_bucketed256, mulrc##field##_bucketed256 },\
+		{ maddrc##field##_bucketed512, mulrc##field##_bucketed512 },\
+	}
+
+static const struct {
+	maddrc_t	maddrc;
+	mulrc_t		mulrc;
+} bucketed[MOEPGF_COUNT][TUNE_WIDTHS] = {
+	BUCKETED_ENTRY(2),
+	BUCKETED_ENTRY(4),
+	BUCKETED_ENTRY(16),
+	BUCKETED_ENTRY(256),
+};
+
+/*
+ * Returns the width index of the given vector width limit in bytes.
+ */
+static int
+width_index(size_t max_width)
+{
+	int w;
+
+	for (w=0; w<TUNE_WIDTHS-1; w++) {
+		if (((size_t)TUNE_MIN_WIDTH << (w+1)) > max_width)
+			break;
+	}
+
+	return w;
+}
+
+static void *
+fnptr(const void *base, size_t offset)
+{
+	return *(void **)((const char *)base + offset);
+}
+
+static void
+set_fnptr(void *base, size_t offset, void *fn)
+{
+	*(void **)((char *)base + offset) = fn;
+}
+
+/*
+ * Writes a string identifying CPU model and microcode revision to id. The
+ * information is taken from /proc/cpuinfo, if available, and extended by the
+ * detected hwcaps.
+ */
+static void
+cpu_id(char *id, size_t len)
+{
+	static const char *keys[] = {
+		"vendor_id", "cpu family", "model", "stepping", "microcode",
+		"CPU implementer", "CPU variant", "CPU part", "CPU revision",
+	};
+	char line[256], *v, *p;
+	size_t i, n;
+	FILE *f;
+
+	n = snprintf(id, len, "%x",
+			moepgf_check_available_simd_extensions());
+
+	if (!(f = fopen("/proc/cpuinfo", "r")))
+		return;
+
+	while (fgets(line, sizeof(line), f)) {
+		/* Only the first processor is considered */
+		if (line[0] == '\n')
+			break;
+		if (!(v = strchr(line, ':')))
+			continue;
+		for (i=0; i<sizeof(keys)/sizeof(keys[0]); i++) {
+			if (strncmp(line, keys[i], strlen(keys[i])))
+				continue;
+			/* Skip keys that only share a prefix, e.g. model name */
+			for (p=line+strlen(keys[i]); *p == ' ' || *p == '\t';
+									p++);
+			if (p != v)
+				continue;
+			for (v++; *v == ' '; v++);
+			for (p=v; *p; p++) {
+				if (*p == ' ' || *p == '\t')
+					*p = '_';
+				if (*p == '\n')
+					*p = 0;
+			}
+			if (n < len)
+				n += snprintf(id+n, len-n, "/%s", v);
+			break;
+		}
+	}
+
+	fclose(f);
+}
+
+/*
+ * Determines the path of the profile file. The environment variable
+ * MOEPGF_PROFILE takes precedence; an empty value disables the profile. The
+ * default is $XDG_CACHE_HOME/libmoepgf.profile or
+ * $HOME/.cache/libmoepgf.profile. Returns -1 if no profile is used.
+ */
+static int
+profile_path(char *path, size_t len)
+{
+	const char *p;
+	int n;
+
+	if ((p = getenv(PROFILE_ENV))) {
+		if (!*p)
+			return -1;
+		n = snprintf(path, len, "%s", p);
+	}
+	else if ((p = getenv("XDG_CACHE_HOME")) && *p) {
+		n = snprintf(path, len, "%s/%s", p, PROFILE_NAME);
+	}
+	else if ((p = getenv("HOME")) && *p) {
+		n = snprintf(path, len, "%s/.cache/%s", p, PROFILE_NAME);
+	}
+	else {
+		return -1;
+	}
+
+	if (n < 0 || (size_t)n >= len)
+		return -1;
+
+	return 0;
+}
+
+static enum MOEPGF_ALGORITHM
+name2a(const char *name)
+{
+	int i;
+
+	if (!strcmp(name, PROFILE_BEST))
+		return MOEPGF_ALGORITHM_BEST;
+
+	for (i=MOEPGF_SELFTEST+1; i<MOEPGF_ALGORITHM_BEST; i++) {
+		if (moepgf_a2name(i) && !strcmp(name, moepgf_a2name(i)))
+			return i;
+	}
+
+	return MOEPGF_SELFTEST;
+}
+
+static const char *
+a2name(enum MOEPGF_ALGORITHM a)
+{
+	if (a == MOEPGF_ALGORITHM_BEST)
+		return PROFILE_BEST;
+
+	return moepgf_a2name(a);
+}
+
+/*
+ * Loads the profile file. Entries are only accepted if version and CPU
+ * identification match, otherwise the profile is ignored and rewritten once
+ * the measurements are complete.
+ */
+static void
+profile_load()
+{
+	char path[1024], line[1024], id[512], op[32], alg[32], name[32];
+	int version, t, o, b, w;
+	unsigned long width;
+	FILE *f;
+
+	if (profile_path(path, sizeof(path)))
+		return;
+
+	if (!(f = fopen(path, "r")))
+		return;
+
+	if (!fgets(line, sizeof(line), f)
+	 || sscanf(line, PROFILE_MAGIC " %d", &version) != 1
+	 || version != PROFILE_VERSION)
+		goto out;
+
+	cpu_id(id, sizeof(id));
+	if (!fgets(line, sizeof(line), f)
+	 || strncmp(line, "cpu ", 4)
+	 || strncmp(line+4, id, strlen(id))
+	 || line[4+strlen(id)] != '\n')
+		goto out;
+
+	while (fgets(line, sizeof(line), f)) {
+		if (sscanf(line, "%d %lu %31s %d %31s", &t, &width, op, &b,
+								alg) != 5)
+			continue;
+		if (t < 0 || t >= MOEPGF_COUNT)
+			continue;
+		w = width_index(width);
+		if (width != (unsigned long)TUNE_MIN_WIDTH << w)
+			continue;
+		for (o=0; o<TUNE_OP_COUNT; o++) {
+			snprintf(name, sizeof(name), "%s_prefetch",
+							tune_ops[o].name);
+			if (tune_ops[o].prefetch && !strcmp(op, name))
+				prefetch[t][w][o] = strtoul(alg, NULL, 10);
+			if (strcmp(op, tune_ops[o].name))
+				continue;
+			if (b >= 0 && b < tune_ops[o].buckets)
+				profile[t][w][o][b] = name2a(alg);
+		}
+	}
+
+out:
+	fclose(f);
+}
+
+/*
+ * Writes the determined entries of field t and width index w to f.
+ */
+static void
+profile_store_width(FILE *f, int t, int w)
+{
+	size_t width = (size_t)TUNE_MIN_WIDTH << w;
+	int o, b;
+
+	for (o=0; o<TUNE_OP_COUNT; o++) {
+		for (b=0; b<tune_ops[o].buckets; b++) {
+			if (profile[t][w][o][b] == MOEPGF_SELFTEST)
+				continue;
+			fprintf(f, "%d %zu %s %d %s\n", t, width,
+					tune_ops[o].name, b,
+					a2name(profile[t][w][o][b]));
+		}
+		if (tune_ops[o].prefetch
+		 && prefetch[t][w][o] != PREFETCH_UNKNOWN) {
+			fprintf(f, "%d %zu %s_prefetch 0 %zu\n", t, width,
+					tune_ops[o].name, prefetch[t][w][o]);
+		}
+	}
+}
+
+/*
+ * Writes all determined entries to the profile file. The file is replaced
+ * atomically such that concurrent processes never see a partial profile.
+ */
+static void
+profile_store()
+{
+	char path[1024], tmp[1100], id[512];
+	int t, w, fd;
+	FILE *f;
+
+	if (profile_path(path, sizeof(path)))
+		return;
+
+	snprintf(tmp, sizeof(tmp), "%s.XXXXXX", path);
+	if ((fd = mkstemp(tmp)) < 0)
+		return;
+	if (!(f = fdopen(fd, "w"))) {
+		close(fd);
+		unlink(tmp);
+		return;
+	}
+
+	cpu_id(id, sizeof(id));
+	fprintf(f, PROFILE_MAGIC " %d\n", PROFILE_VERSION);
+	fprintf(f, "cpu %s\n", id);
+
+	for (t=0; t<MOEPGF_COUNT; t++) {
+		for (w=0; w<TUNE_WIDTHS; w++)
+			profile_store_width(f, t, w);
+	}
+
+	if (fclose(f) || rename(tmp, path))
+		unlink(tmp);
+}
+
+static void
+run(enum TUNE_OP op, void *fn, uint8_t **r, const uint8_t *c, size_t len)
+{
+	switch (op) {
+	case TUNE_MADDRC:
+	case TUNE_MADDRC_UNALIGNED:
+		((maddrc_t)fn)(r[0], r[1], c[0], len);
+		break;
+	case TUNE_MULRC:
+	case TUNE_MULRC_UNALIGNED:
+		((mulrc_t)fn)(r[0], c[0], len);
+		break;
+	case TUNE_MADDRC_MULTI:
+		((maddrc_multi_t)fn)(r[0], (const uint8_t **)r+1, c,
+							TUNE_SOURCES, len);
+		break;
+	case TUNE_MADDRC_FANOUT:
+		((maddrc_fanout_t)fn)(r+1, r[0], c, TUNE_SOURCES, len);
+		break;
+	case TUNE_MADDRC3:
+		((maddrc3_t)fn)(r[0], r[1], r[2], c[0], len);
+		break;
+	case TUNE_MULRC_COPY:
+		((mulrc_copy_t)fn)(r[0], r[1], c[0], len);
+		break;
+	case TUNE_MULRR:
+		((mulrr_t)fn)(r[0], r[1], len);
+		break;
+	case TUNE_MADDRR:
+		((maddrr_t)fn)(r[0], r[1], r[2], len);
+		break;
+	case TUNE_INVR:
+		((invr_t)fn)(r[0], len);
+		break;
+	case TUNE_DIVR:
+		((divr_t)fn)(r[0], r[1], len);
+		break;
+	default:
+		break;
+	}
+}
+
+/*
+ * Returns the time in seconds per byte needed by kernel fn for operation op,
+ * summed over count lengths. Each length is timed TUNE_TRIALS times and the
+ * fastest trial is taken. Measuring stops early once the sum exceeds bound,
+ * i.e., once fn cannot beat the best kernel found so far. A negative bound
+ * disables this.
+ */
+static double
+measure(enum TUNE_OP op, void *fn, uint8_t **r, const uint8_t *c,
+		const size_t *lengths, size_t count, double bound)
+{
+	struct timespec start, end;
+	double t, best, sum = 0;
+	size_t i, j, k, reps;
+
+	for (i=0; i<count; i++) {
+		reps = TUNE_BYTES / lengths[i];
+		best = -1;
+		for (j=0; j<TUNE_TRIALS; j++) {
+			clock_gettime(CLOCK_MONOTONIC, &start);
+			for (k=0; k<reps; k++)
+				run(op, fn, r, c, lengths[i]);
+			clock_gettime(CLOCK_MONOTONIC, &end);
+
+			t = (double)(end.tv_sec - start.tv_sec)
+				+ (double)(end.tv_nsec - start.tv_nsec)*1e-9;
+			if (best < 0 || t < best)
+				best = t;
+		}
+		sum += best / (double)(reps * lengths[i]);
+		if (bound >= 0 && sum > bound)
+			break;
+	}
+
+	return sum;
+}
+
+/*
+ * Returns the time in seconds needed by kernel fn for operation op to walk over
+ * the back to back regions of PREFETCH_LENGTH bytes in buf, or by its
+ * prefetching variant pf with the given distance if the distance is not zero.
+ * Destination of maddrc is frame. The fastest of TUNE_TRIALS walks is taken.
+ */
+static double
+measure_walk(enum TUNE_OP op, void *fn, void *pf, size_t distance,
+				uint8_t *frame, uint8_t *buf, uint8_t c)
+{
+	struct timespec start, end;
+	double t, best = -1;
+	size_t i, j;
+
+	for (j=0; j<TUNE_TRIALS; j++) {
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (i=0; i<PREFETCH_BYTES; i+=PREFETCH_LENGTH) {
+			if (op == TUNE_MADDRC && distance)
+				((maddrc_prefetch_t)pf)(frame, buf+i, c,
+						PREFETCH_LENGTH, distance);
+			else if (op == TUNE_MADDRC)
+				((maddrc_t)fn)(frame, buf+i, c,
+							PREFETCH_LENGTH);
+			else if (distance)
+				((mulrc_prefetch_t)pf)(buf+i, c,
+						PREFETCH_LENGTH, distance);
+			else
+				((mulrc_t)fn)(buf+i, c, PREFETCH_LENGTH);
+		}
+		clock_gettime(CLOCK_MONOTONIC, &end);
+
+		t = (double)(end.tv_sec - start.tv_sec)
+			+ (double)(end.tv_nsec - start.tv_nsec)*1e-9;
+		if (best < 0 || t < best)
+			best = t;
+	}
+
+	return best;
+}
+
+/*
+ * Returns the algorithm whose kernel is selected for width index w, operation
+ * o, and size bucket b of the field of best, which must have been initialized
+ * with MOEPGF_ALGORITHM_BEST, or -1 if the kernel is not found in algs.
+ */
+static int
+selected_algorithm(const struct moepgf *best, struct moepgf_algorithm **algs,
+							int w, int o, int b)
+{
+	enum MOEPGF_ALGORITHM a = profile[best->type][w][o][b];
+	int i;
+
+	if (a != MOEPGF_ALGORITHM_BEST)
+		return algs[a] ? (int)a : -1;
+
+	for (i=0; i<MOEPGF_ALGORITHM_COUNT; i++) {
+		if (algs[i] && fnptr(algs[i], tune_ops[o].alg)
+					== fnptr(best, tune_ops[o].gf))
+			return i;
+	}
+
+	return -1;
+}
+
+/*
+ * Measures all kernels for the given field and fills in the missing entries
+ * of the profile for width index w. The kernel selected by
+ * MOEPGF_ALGORITHM_BEST is always a candidate and is measured first. Bucketed
+ * operations are measured at the length of each bucket separately.
+ * Afterwards, the prefetch distance is determined for the algorithm selected
+ * at PREFETCH_LENGTH, if it provides a prefetching kernel.
+ */
+static int
+tune(const struct moepgf *gf, struct moepgf_algorithm **algs, uint32_t hwcaps,
+									int w)
+{
+	uint8_t *buf, *walk = NULL, *r[TUNE_SOURCES+1];
+	uint8_t c[TUNE_SOURCES];
+	uint32_t s = 0x5eed;
+	const size_t *lengths;
+	size_t count, len, d;
+	double t, best;
+	void *fn, *pf;
+	int i, o, b;
+
+	if (posix_memalign((void *)&buf, MOEPGF_MAX_ALIGNMENT,
+					(TUNE_SOURCES+1)*TUNE_MAX_LENGTH))
+		return -1;
+
+	for (i=0; i<(TUNE_SOURCES+1)*TUNE_MAX_LENGTH; i++)
+		buf[i] = moepgf_rand(&s);
+	for (i=0; i<=TUNE_SOURCES; i++)
+		r[i] = buf + i*TUNE_MAX_LENGTH;
+	for (i=0; i<TUNE_SOURCES; i++)
+		c[i] = (moepgf_rand(&s) & gf->mask) | (gf->mask > 1 ? 2 : 1);
+
+	for (o=0; o<TUNE_OP_COUNT; o++) {
+		for (b=0; b<tune_ops[o].buckets; b++) {
+			if (profile[gf->type][w][o][b] != MOEPGF_SELFTEST)
+				continue;
+
+			if (tune_ops[o].buckets > 1) {
+				len = bucket_length(b);
+				lengths = &len;
+				count = 1;
+			}
+			else {
+				lengths = tune_lengths;
+				count = TUNE_LENGTH_COUNT;
+			}
+
+			profile[gf->type][w][o][b] = MOEPGF_ALGORITHM_BEST;
+			if (!(fn = fnptr(gf, tune_ops[o].gf)))
+				continue;
+			best = measure(o, fn, r, c, lengths, count, -1);
+
+			for (i=0; i<MOEPGF_ALGORITHM_COUNT; i++) {
+				if (!algs[i] || !(hwcaps & (1 << algs[i]->hwcaps)))
+					continue;
+				if (!(fn = fnptr(algs[i], tune_ops[o].alg)))
+					continue;
+				t = measure(o, fn, r, c, lengths, count,
+							best*TUNE_MARGIN);
+				if (t < best*TUNE_MARGIN) {
+					best = t;
+					profile[gf->type][w][o][b] = i;
+				}
+			}
+		}
+	}
+
+	for (o=0; o<TUNE_OP_COUNT; o++) {
+		if (!tune_ops[o].prefetch
+		 || prefetch[gf->type][w][o] != PREFETCH_UNKNOWN)
+			continue;
+
+		prefetch[gf->type][w][o] = 0;
+		i = selected_algorithm(gf, algs, w, o,
+					size_bucket(PREFETCH_LENGTH));
+		if (i < 0 || !(pf = fnptr(algs[i], tune_ops[o].prefetch)))
+			continue;
+
+		if (!walk) {
+			if (posix_memalign((void *)&walk, MOEPGF_MAX_ALIGNMENT,
+							PREFETCH_BYTES)) {
+				free(buf);
+				return -1;
+			}
+			for (d=0; d<PREFETCH_BYTES; d++)
+				walk[d] = moepgf_rand(&s);
+		}
+
+		fn = fnptr(algs[i], tune_ops[o].alg);
+		best = measure_walk(o, fn, pf, 0, r[0], walk, c[0]);
+		for (d=1; d<PREFETCH_DISTANCE_COUNT; d++) {
+			t = measure_walk(o, fn, pf, prefetch_distances[d],
+							r[0], walk, c[0]);
+			if (t < best*TUNE_MARGIN) {
+				best = t;
+				prefetch[gf->type][w][o] = prefetch_distances[d];
+			}
+		}
+	}
+
+	free(walk);
+	free(buf);
+
+	return 0;
+}
+
+static int
+autotune_locked(struct moepgf *gf, size_t max_width)
+{
+	struct moepgf_algorithm **algs;
+	struct moepgf best;
+	uint32_t hwcaps;
+	int t, w, o, b, i, tuned = 0;
+	void *fn[SIZE_BUCKETS], *pf[SIZE_BUCKETS];
+	enum MOEPGF_ALGORITHM a;
+
+	if (!profile_loaded) {
+		for (t=0; t<MOEPGF_COUNT; t++) {
+			for (w=0; w<TUNE_WIDTHS; w++) {
+				for (o=0; o<TUNE_OP_COUNT; o++)
+					prefetch[t][w][o] = PREFETCH_UNKNOWN;
+			}
+		}
+		profile_load();
+		profile_loaded = 1;
+	}
+
+	w = width_index(max_width);
+	hwcaps = moepgf_check_available_simd_extensions();
+	if (!(algs = moepgf_get_algs(gf->type)))
+		return -1;
+
+	for (a=0; a<MOEPGF_ALGORITHM_COUNT; a++) {
+		if (algs[a] && algs[a]->granularity > max_width) {
+			free(algs[a]);
+			algs[a] = NULL;
+		}
+	}
+
+	/* Discard entries that are not applicable on this machine and
+	 * measure them along with missing ones */
+	for (o=0; o<TUNE_OP_COUNT; o++) {
+		for (b=0; b<tune_ops[o].buckets; b++) {
+			a = profile[gf->type][w][o][b];
+			if (a == MOEPGF_ALGORITHM_BEST)
+				continue;
+			if (a == MOEPGF_SELFTEST || !algs[a]
+			 || !(hwcaps & (1 << algs[a]->hwcaps))
+			 || !fnptr(algs[a], tune_ops[o].alg)) {
+				profile[gf->type][w][o][b] = MOEPGF_SELFTEST;
+				tuned = 1;
+			}
+		}
+		if (tune_ops[o].prefetch
+		 && prefetch[gf->type][w][o] == PREFETCH_UNKNOWN)
+			tuned = 1;
+	}
+
+	if (tuned && tune(gf, algs, hwcaps, w)) {
+		moepgf_free_algs(algs);
+		return -1;
+	}
+
+	best = *gf;
+	for (o=0; o<TUNE_OP_COUNT; o++) {
+		for (b=0; b<tune_ops[o].buckets; b++) {
+			pf[b] = NULL;
+			if (tune_ops[o].prefetch && prefetch[gf->type][w][o]
+			 && (i = selected_algorithm(&best, algs, w, o, b)) >= 0)
+				pf[b] = fnptr(algs[i], tune_ops[o].prefetch);
+
+			a = profile[gf->type][w][o][b];
+			if (a == MOEPGF_ALGORITHM_BEST) {
+				fn[b] = fnptr(&best, tune_ops[o].gf);
+				continue;
+			}
+			fn[b] = fnptr(algs[a], tune_ops[o].alg);
+			if (algs[a]->alignment > gf->alignment)
+				gf->alignment = algs[a]->alignment;
+			if (algs[a]->granularity > gf->granularity)
+				gf->granularity = algs[a]->granularity;
+			if (o == TUNE_MULRC_COPY || o == TUNE_MADDRC3)
+				gf->nt_threshold = 0;
+		}
+
+		for (b=1; b<tune_ops[o].buckets; b++) {
+			if (fn[b] != fn[0] || pf[b] != pf[0])
+				break;
+		}
+		if (b == tune_ops[o].buckets && !pf[0]) {
+			set_fnptr(gf, tune_ops[o].gf, fn[0]);
+			continue;
+		}
+
+		if (o == TUNE_MADDRC)
+			gf->maddrc = bucketed[gf->type][w].maddrc;
+		else
+			gf->mulrc = bucketed[gf->type][w].mulrc;
+
+		/* The entries are the same for all GFs of this width */
+		if (dispatch[gf->type][w].ready)
+			continue;
+
+		for (b=0; b<tune_ops[o].buckets; b++) {
+			if (o == TUNE_MADDRC) {
+				dispatch[gf->type][w].maddrc[b] = fn[b];
+				dispatch[gf->type][w].maddrc_prefetch[b] = pf[b];
+			}
+			else {
+				dispatch[gf->type][w].mulrc[b] = fn[b];
+				dispatch[gf->type][w].mulrc_prefetch[b] = pf[b];
+			}
+		}
+		if (o == TUNE_MADDRC)
+			dispatch[gf->type][w].maddrc_distance =
+						prefetch[gf->type][w][o];
+		else
+			dispatch[gf->type][w].mulrc_distance =
+						prefetch[gf->type][w][o];
+	}
+	dispatch[gf->type][w].ready = 1;
+
+	moepgf_free_algs(algs);
+
+	if (tuned)
+		profile_store();
+
+	return 0;
+}
+
+int
+autotune(struct moepgf *gf, size_t max_width)
+{
+	int ret;
+
+	pthread_mutex_lock(&tune_lock);
+	ret = autotune_locked(gf, max_width);
+	pthread_mutex_unlock(&tune_lock);
+
+	return ret;
+}
@@ -0,0 +1,37 @@
+/*
+ * This file is part of moep80211gf.
+ *
+ * Copyright (C) 2014   Stephan M. Guenther <moepi@moepi.net>
+ *
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 2.1 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library. If not, see <https://www.gnu.org/licenses/>
+ *
+ */
+
+#ifndef _AUTOTUNE_H_
+#define _AUTOTUNE_H_
+
+#include <moepgf/moepgf.h>
+
+/*
+ * Initializes the function pointers of gf, which must have been initialized
+ * with MOEPGF_ALGORITHM_BEST, with the fastest kernel measured for each
+ * operation. Algorithms whose vectors are wider than max_width bytes are not
+ * considered. Measurements are loaded from and stored to the profile file.
+ * Concurrent calls are serialized. Returns 0 on success and -1 on error.
+ */
+int autotune(struct moepgf *gf, size_t max_width)
+	__attribute__((visibility("hidden")));
+
+#endif
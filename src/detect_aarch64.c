@@ -0,0 +1,57 @@
+/*
+ * This file is part of moep80211gf.
+ *
+ * Copyright (C) 2014   Stephan M. Guenther <moepi@moepi.net>
+ *
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 2.1 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library. If not, see <https://www.gnu.org/licenses/>
+ *
+ */
+
+#include <sys/auxv.h>
+
+#include <moepgf/moepgf.h>
+
+#include "detect_aarch64.h"
+
+#ifndef HWCAP_ASIMD
+#define HWCAP_ASIMD	(1 << 1)
+#endif
+#ifndef HWCAP_SHA3
+#define HWCAP_SHA3	(1 << 17)
+#endif
+
+/*
+ * Unlike on ARMv7, the kernel reports the SIMD extensions in the auxiliary
+ * vector and no SIGILL probe is needed. AdvSIMD includes the 128 bit table
+ * lookups and the 8 bit polynomial multiplication (PMULL) used by the
+ * shuffle_neon_128 and pmull_neon_128 kernels, the three-way exclusive or
+ * (EOR3) is part of the optional SHA3 extension.
+ */
+uint32_t
+detect_aarch64()
+{
+	unsigned long hwcap;
+	uint32_t hwcaps = 0;
+
+	hwcap = getauxval(AT_HWCAP);
+
+	if (hwcap & HWCAP_ASIMD) {
+		hwcaps |= (1 << MOEPGF_HWCAPS_SIMD_NEON);
+		if (hwcap & HWCAP_SHA3)
+			hwcaps |= (1 << MOEPGF_HWCAPS_SIMD_NEON_SHA3);
+	}
+
+	return hwcaps;
+}
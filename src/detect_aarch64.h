@@ -0,0 +1,29 @@
+/*
+ * This file is part of moep80211gf.
+ *
+ * Copyright (C) 2014   Stephan M. Guenther <moepi@moepi.net>
+ *
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 2.1 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library. If not, see <https://www.gnu.org/licenses/>
+ *
+ */
+
+#ifndef __DETECT_AARCH64
+#define __DETECT_AARCH64
+
+#include <stdint.h>
+
+uint32_t detect_aarch64();
+
+#endif
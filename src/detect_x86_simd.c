@@ -72,7 +72,20 @@ detect_x86_simd()
 		hwcaps |= (1 << MOEPGF_HWCAPS_SIMD_AVX512);
 	if (ebx & (1 << 30))
 		hwcaps |= (1 << MOEPGF_HWCAPS_SIMD_AVX512BW);
-	if (ecx & (1 << 8))
+	/* The AVX512VL kernels use byte granular masks and shuffles on 256 bit
+	 * registers, which also requires AVX512BW */
+	if ((ebx & (1u << 31)) && (hwcaps & (1 << MOEPGF_HWCAPS_SIMD_AVX512BW)))
+		hwcaps |= (1 << MOEPGF_HWCAPS_SIMD_AVX512VL);
+	/* The VBMI kernels select table halves with AVX512BW instructions */
+	if ((ecx & (1 << 1)) && (hwcaps & (1 << MOEPGF_HWCAPS_SIMD_AVX512BW)))
+		hwcaps |= (1 << MOEPGF_HWCAPS_SIMD_AVX512VBMI);
+
+	/* GFNI is usable with VEX encoding on AVX2 capable CPUs and with EVEX
+	 * encoding on AVX512BW and AVX512VL capable CPUs. The latter covers
+	 * the 512 bit kernels as well as their 256 bit variants. */
+	if ((ecx & (1 << 8)) && (hwcaps & (1 << MOEPGF_HWCAPS_SIMD_AVX2)))
+		hwcaps |= (1 << MOEPGF_HWCAPS_SIMD_GFNI);
+	if ((ecx & (1 << 8)) && (hwcaps & (1 << MOEPGF_HWCAPS_SIMD_AVX512VL)))
 		hwcaps |= (1 << MOEPGF_HWCAPS_SIMD_AVX512GFNI);
 
 	return hwcaps;
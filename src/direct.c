@@ -0,0 +1,141 @@
+/*
+ * This file is part of moep80211gf.
+ *
+ * Copyright (C) 2014   Stephan M. Guenther <moepi@moepi.net>
+ *
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 2.1 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library. If not, see <https://www.gnu.org/licenses/>
+ *
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <moepgf/moepgf.h>
+
+#include "direct.h"
+
+/*
+ * Directly callable symbols moepgf<field>_<op>. With GNU IFUNC support the
+ * dynamic linker binds each symbol to the best kernel when the library is
+ * loaded, i.e., calls cost the same as calls to any other library function.
+ * Otherwise each symbol is a wrapper that resolves all kernels once, guarded
+ * by pthread_once(), and calls through the resolved function pointer.
+ */
+#if defined(HAVE_IFUNC) && defined(__x86_64__)
+
+/*
+ * IFUNC resolvers run while the dynamic linker processes relocations, i.e.,
+ * before libc is initialized. best_kernels() and the CPU detection therefore
+ * do not call any function. They do read best_algorithms, though, whose
+ * function pointers need relative relocations in the shared library. This
+ * relies on the library being relocated before any resolver runs: the
+ * dynamic linker relocates dependencies before the objects that use them, and
+ * IRELATIVE relocations of the library itself are applied after its relative
+ * relocations. Both hold for lazy binding and for -z now. They do not hold if
+ * an object that binds symbols of the library immediately is relocated first,
+ * e.g., if the library is preloaded and used by one of its own dependencies.
+ */
+static void
+resolve(struct moepgf *gf, enum MOEPGF_TYPE type)
+{
+	best_kernels(gf, type, moepgf_check_available_simd_extensions(),
+							MOEPGF_MAX_ALIGNMENT);
+}
+
+#define DIRECT(field, op, type, params, args)				\
+static type								\
+resolve_moepgf##field##_##op()						\
+{									\
+	struct moepgf gf;						\
+									\
+	resolve(&gf, MOEPGF##field);					\
+	return gf.op;							\
+}									\
+void moepgf##field##_##op params					\
+	__attribute__((ifunc("resolve_moepgf" #field "_" #op)));
+
+#else
+
+#include <pthread.h>
+
+static pthread_once_t resolved_once = PTHREAD_ONCE_INIT;
+static struct moepgf resolved[MOEPGF_COUNT];
+
+static void
+resolve_all()
+{
+	uint32_t hwcaps;
+	int i;
+
+	hwcaps = moepgf_check_available_simd_extensions();
+	for (i=0; i<MOEPGF_COUNT; i++)
+		best_kernels(&resolved[i], i, hwcaps, MOEPGF_MAX_ALIGNMENT);
+}
+
+#define DIRECT(field, op, type, params, args)				\
+void									\
+moepgf##field##_##op params						\
+{									\
+	pthread_once(&resolved_once, resolve_all);			\
+	resolved[MOEPGF##field].op args;				\
+}
+
+#endif
+
+#define DIRECT_FIELD(field)						\
+DIRECT(field, maddrc, maddrc_t,						\
+	(uint8_t *r1, const uint8_t *r2, uint8_t c, size_t len),	\
+	(r1, r2, c, len))						\
+DIRECT(field, mulrc, mulrc_t,						\
+	(uint8_t *r, uint8_t c, size_t len),				\
+	(r, c, len))							\
+DIRECT(field, maddrc_multi, maddrc_multi_t,				\
+	(uint8_t *r1, const uint8_t **r2, const uint8_t *c, int count,	\
+							size_t len),	\
+	(r1, r2, c, count, len))					\
+DIRECT(field, maddrc_fanout, maddrc_fanout_t,				\
+	(uint8_t **r1, const uint8_t *r2, const uint8_t *c, int count,	\
+							size_t len),	\
+	(r1, r2, c, count, len))					\
+DIRECT(field, maddrc3, maddrc3_t,					\
+	(uint8_t *r1, const uint8_t *r2, const uint8_t *r3, uint8_t c,	\
+							size_t len),	\
+	(r1, r2, r3, c, len))						\
+DIRECT(field, mulrc_copy, mulrc_copy_t,					\
+	(uint8_t *r1, const uint8_t *r2, uint8_t c, size_t len),	\
+	(r1, r2, c, len))						\
+DIRECT(field, mulrr, mulrr_t,						\
+	(uint8_t *r1, const uint8_t *r2, size_t len),			\
+	(r1, r2, len))							\
+DIRECT(field, maddrr, maddrr_t,						\
+	(uint8_t *r1, const uint8_t *r2, const uint8_t *r3, size_t len),\
+	(r1, r2, r3, len))						\
+DIRECT(field, invr, invr_t,						\
+	(uint8_t *r, size_t len),					\
+	(r, len))							\
+DIRECT(field, divr, divr_t,						\
+	(uint8_t *r1, const uint8_t *r2, size_t len),			\
+	(r1, r2, len))							\
+DIRECT(field, maddrc_unaligned, maddrc_t,				\
+	(uint8_t *r1, const uint8_t *r2, uint8_t c, size_t len),	\
+	(r1, r2, c, len))						\
+DIRECT(field, mulrc_unaligned, mulrc_t,					\
+	(uint8_t *r, uint8_t c, size_t len),				\
+	(r, c, len))
+
+DIRECT_FIELD(2)
+DIRECT_FIELD(4)
+DIRECT_FIELD(16)
+DIRECT_FIELD(256)
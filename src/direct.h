@@ -0,0 +1,36 @@
+/*
+ * This file is part of moep80211gf.
+ *
+ * Copyright (C) 2014   Stephan M. Guenther <moepi@moepi.net>
+ *
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 2.1 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library. If not, see <https://www.gnu.org/licenses/>
+ *
+ */
+
+#ifndef _DIRECT_H_
+#define _DIRECT_H_
+
+#include <moepgf/moepgf.h>
+
+/*
+ * Implemented in gf.c. Sets hwcaps, memory layout and function pointers of gf
+ * to the best kernels for the given field and hwcaps whose vectors are at most
+ * max_width bytes wide without calling any other function.
+ */
+void best_kernels(struct moepgf *gf, enum MOEPGF_TYPE type, uint32_t hwcaps,
+							size_t max_width)
+	__attribute__((visibility("hidden")));
+
+#endif
@@ -21,27 +21,67 @@
  */
 
 #include <string.h>
+#include <strings.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <unistd.h>
 
 #include <moepgf/moepgf.h>
 
 #ifdef __arm__
 #include "detect_arm_neon.h"
 #endif
+#ifdef __aarch64__
+#include "detect_aarch64.h"
+#endif
 #ifdef __x86_64__
 #include "detect_x86_simd.h"
 #endif
 #ifdef __mips__
 #endif
 
+/*
+ * The shuffle_vector kernels use compiler vector extensions. They are built
+ * with SSSE3 on x86_64, with the baseline NEON on aarch64 and with the flags
+ * of the target elsewhere. There, they are only preferred over the gpr64
+ * kernels if the target provides a byte permutation for __builtin_shuffle().
+ */
+#if defined(__x86_64__)
+#define VECTOR_HWCAPS	MOEPGF_HWCAPS_SIMD_SSSE3
+#elif defined(__arm__) || defined(__aarch64__)
+#define VECTOR_HWCAPS	MOEPGF_HWCAPS_SIMD_NEON
+#else
+#define VECTOR_HWCAPS	MOEPGF_HWCAPS_SIMD_VECTOR
+#if defined(__ALTIVEC__) || defined(__mips_msa) || defined(__riscv_vector)
+#define BEST_VECTOR
+#endif
+#endif
+
 #include "gf2.h"
 #include "gf4.h"
 #include "gf16.h"
 #include "gf256.h"
 #include "xor.h"
+#include "autotune.h"
+#include "direct.h"
+
+/*
+ * Cache parameters used by moepgf_matmul() to tile the byte dimension of
+ * regions. MATMUL_TILE_MIN is a multiple of the largest vector width used by
+ * any kernel times the number of vectors kept in registers by the
+ * maddrc_fanout kernels. MATMUL_ROWS is the number of output rows that are
+ * updated per load of an input tile.
+ */
+#define MATMUL_L1_SIZE		(32*1024)
+#define MATMUL_TILE_MIN		256
+#define MATMUL_ROWS		4
+
+/*
+ * Last level cache size assumed if it cannot be determined at runtime.
+ */
+#define DEFAULT_LLC_SIZE	(8*1024*1024)
 
 const char *gf_names[] =
 {
@@ -71,167 +111,2213 @@ const char *gf_names[] =
 	[MOEPGF_SHUFFLE_NEON_64]	= "shuffle_neon_64",
 	[MOEPGF_GFNI128]		= "gfni128",
 	[MOEPGF_GFNI256]		= "gfni256",
-	[MOEPGF_GFNI512]		= "gfni512"
+	[MOEPGF_GFNI512]		= "gfni512",
+	[MOEPGF_GFNI_AFFINE128]	= "gfni_affine128",
+	[MOEPGF_GFNI_AFFINE256]	= "gfni_affine256",
+	[MOEPGF_GFNI_AFFINE512]	= "gfni_affine512",
+	[MOEPGF_LOOKUP_AVX512VBMI]	= "lookup_avx512vbmi",
+	[MOEPGF_SHUFFLE_AVX512VL]	= "shuffle_avx512vl",
+	[MOEPGF_GFNI_AFFINE_AVX512VL]	= "gfni_affine_avx512vl",
+	[MOEPGF_SHUFFLE_NEON_128]	= "shuffle_neon_128",
+	[MOEPGF_PMULL_NEON_128]	= "pmull_neon_128",
+	[MOEPGF_SHUFFLE_NEON_SHA3]	= "shuffle_neon_sha3",
+	[MOEPGF_SHUFFLE_VECTOR]		= "shuffle_vector",
+	[MOEPGF_SHUFFLE_SSSE3_X2]	= "shuffle_ssse3_x2",
+	[MOEPGF_SHUFFLE_SSSE3_X4]	= "shuffle_ssse3_x4",
+	[MOEPGF_SHUFFLE_AVX2_X2]	= "shuffle_avx2_x2",
+	[MOEPGF_SHUFFLE_AVX2_X4]	= "shuffle_avx2_x4",
+	[MOEPGF_SHUFFLE_AVX512_X2]	= "shuffle_avx512_x2",
+	[MOEPGF_SHUFFLE_AVX512_X4]	= "shuffle_avx512_x4"
+};
+
+/*
+ * Memory alignment and length granularity in bytes required by the kernels of
+ * each algorithm. Algorithms that fall back to a wider xorr kernel for the
+ * constant 1 inherit its granularity. NEON loads and stores do not require
+ * alignment.
+ */
+static const struct {
+	size_t	alignment;
+	size_t	granularity;
+} algorithm_layout[MOEPGF_ALGORITHM_COUNT] = {
+	[MOEPGF_SELFTEST]		= {  1,  1 },
+	[MOEPGF_XOR_SCALAR]		= {  1,  1 },
+	[MOEPGF_XOR_GPR32]		= {  4,  4 },
+	[MOEPGF_XOR_GPR64]		= {  8,  8 },
+	[MOEPGF_XOR_SSE2]		= { 16, 16 },
+	[MOEPGF_XOR_AVX2]		= { 32, 32 },
+	[MOEPGF_XOR_AVX512]		= { 64, 64 },
+	[MOEPGF_XOR_NEON_128]		= {  1, 16 },
+	[MOEPGF_XOR_MSA]		= { 16, 16 },
+	[MOEPGF_LOG_TABLE]		= {  1,  1 },
+	[MOEPGF_FLAT_TABLE]		= {  1,  1 },
+	[MOEPGF_IMUL_SCALAR]		= {  1,  1 },
+	[MOEPGF_IMUL_GPR32]		= {  4,  4 },
+	[MOEPGF_IMUL_GPR64]		= {  8,  8 },
+	[MOEPGF_IMUL_SSE2]		= { 16, 16 },
+	[MOEPGF_IMUL_AVX2]		= { 32, 32 },
+	[MOEPGF_IMUL_AVX512]		= { 64, 64 },
+	[MOEPGF_IMUL_AVX512BW]		= { 64, 64 },
+	[MOEPGF_IMUL_NEON_64]		= {  1, 16 },
+	[MOEPGF_IMUL_NEON_128]		= {  1, 16 },
+	[MOEPGF_SHUFFLE_SSSE3]		= { 16, 16 },
+	[MOEPGF_SHUFFLE_AVX2]		= { 32, 32 },
+	[MOEPGF_SHUFFLE_AVX512]		= { 64, 64 },
+	[MOEPGF_SHUFFLE_NEON_64]	= {  1, 16 },
+	[MOEPGF_GFNI128]		= { 16, 16 },
+	[MOEPGF_GFNI256]		= { 32, 32 },
+	[MOEPGF_GFNI512]		= { 64, 64 },
+	[MOEPGF_GFNI_AFFINE128]	= { 16, 16 },
+	[MOEPGF_GFNI_AFFINE256]	= { 32, 32 },
+	[MOEPGF_GFNI_AFFINE512]	= { 64, 64 },
+	[MOEPGF_LOOKUP_AVX512VBMI]	= { 64, 64 },
+	[MOEPGF_SHUFFLE_AVX512VL]	= { 32, 32 },
+	[MOEPGF_GFNI_AFFINE_AVX512VL]	= { 32, 32 },
+	[MOEPGF_SHUFFLE_NEON_128]	= {  1, 16 },
+	[MOEPGF_PMULL_NEON_128]		= {  1, 16 },
+	[MOEPGF_SHUFFLE_NEON_SHA3]	= {  1, 16 },
+	[MOEPGF_SHUFFLE_VECTOR]		= {  1, 16 },
+	[MOEPGF_SHUFFLE_SSSE3_X2]	= { 16, 16 },
+	[MOEPGF_SHUFFLE_SSSE3_X4]	= { 16, 16 },
+	[MOEPGF_SHUFFLE_AVX2_X2]	= { 32, 32 },
+	[MOEPGF_SHUFFLE_AVX2_X4]	= { 32, 32 },
+	[MOEPGF_SHUFFLE_AVX512_X2]	= { 64, 64 },
+	[MOEPGF_SHUFFLE_AVX512_X4]	= { 64, 64 },
+};
+
+/*
+ * Memory alignment and length granularity of the entries of best_algorithms.
+ * Entries mix kernels of different algorithms, hence the values are the
+ * maximum over all kernels used by any field for the respective hwcaps.
+ */
+static const struct {
+	size_t	alignment;
+	size_t	granularity;
+} best_layout[MOEPGF_HWCAPS_COUNT] = {
+	[MOEPGF_HWCAPS_SIMD_NONE]	= {  8,  8 },
+	[MOEPGF_HWCAPS_SIMD_SSE2]	= { 16, 16 },
+	[MOEPGF_HWCAPS_SIMD_SSSE3]	= { 16, 16 },
+	[MOEPGF_HWCAPS_SIMD_AVX2]	= { 32, 32 },
+	[MOEPGF_HWCAPS_SIMD_AVX512]	= { 64, 64 },
+	[MOEPGF_HWCAPS_SIMD_AVX512BW]	= { 64, 64 },
+	[MOEPGF_HWCAPS_SIMD_AVX512GFNI]	= { 64, 64 },
+	[MOEPGF_HWCAPS_SIMD_GFNI]	= { 32, 32 },
+	[MOEPGF_HWCAPS_SIMD_AVX512VL]	= { 32, 32 },
+	[MOEPGF_HWCAPS_SIMD_NEON]	= {  8, 16 },
+	[MOEPGF_HWCAPS_SIMD_NEON_SHA3]	= {  8, 16 },
+	[MOEPGF_HWCAPS_SIMD_VECTOR]	= {  8, 16 },
 };
 
 const struct {
 	mulrc_t		mulrc;
 	maddrc_t	maddrc;
+	maddrc_multi_t	maddrc_multi;
+	maddrc_fanout_t	maddrc_fanout;
+	maddrc3_t	maddrc3;
+	mulrc_copy_t	mulrc_copy;
+	mulrr_t	mulrr;
+	maddrr_t	maddrr;
+	invr_t	invr;
+	divr_t	divr;
+	maddrc_t	maddrc_unaligned;
+	mulrc_t	mulrc_unaligned;
+	mulrc_copy_t	mulrc_copy_nt;
+	maddrc3_t	maddrc3_nt;
 } best_algorithms[MOEPGF_COUNT][MOEPGF_HWCAPS_COUNT] = {
 	[MOEPGF2][MOEPGF_HWCAPS_SIMD_NONE]  = {
 		.mulrc	= mulrc2,
-		.maddrc	= maddrc2_gpr64
+		.maddrc	= maddrc2_gpr64,
+		.maddrc_multi	= maddrc_multi2_gpr64,
+		.maddrc_fanout	= maddrc_fanout2_gpr64,
+		.maddrc3	= maddrc3_2_gpr64,
+		.mulrc_copy	= mulrc_copy2,
+		.mulrr	= mulrr2_gpr64,
+		.maddrr	= maddrr2_gpr64,
+		.invr	= invr2,
+		.divr	= mulrr2_gpr64,
+		.maddrc_unaligned	= maddrc2_scalar,
+		.mulrc_unaligned	= mulrc2
 	},
 #ifdef __x86_64__
 	[MOEPGF2][MOEPGF_HWCAPS_SIMD_SSE2]  = {
 		.mulrc	= mulrc2,
-		.maddrc	= maddrc2_sse2
+		.maddrc	= maddrc2_sse2,
+		.maddrc_multi	= maddrc_multi2_sse2,
+		.maddrc_fanout	= maddrc_fanout2_sse2,
+		.maddrc3	= maddrc3_2_sse2,
+		.mulrc_copy	= mulrc_copy2,
+		.mulrr	= mulrr2_sse2,
+		.maddrr	= maddrr2_sse2,
+		.invr	= invr2,
+		.divr	= mulrr2_sse2,
+		.maddrc_unaligned	= maddrc_unaligned2_sse2,
+		.mulrc_unaligned	= mulrc2
 	},
 	[MOEPGF2][MOEPGF_HWCAPS_SIMD_SSSE3] = {
 		.mulrc	= mulrc2,
-		.maddrc	= maddrc2_sse2
+		.maddrc	= maddrc2_sse2,
+		.maddrc_multi	= maddrc_multi2_sse2,
+		.maddrc_fanout	= maddrc_fanout2_sse2,
+		.maddrc3	= maddrc3_2_sse2,
+		.mulrc_copy	= mulrc_copy2,
+		.mulrr	= mulrr2_sse2,
+		.maddrr	= maddrr2_sse2,
+		.invr	= invr2,
+		.divr	= mulrr2_sse2,
+		.maddrc_unaligned	= maddrc_unaligned2_sse2,
+		.mulrc_unaligned	= mulrc2
 	},
 	[MOEPGF2][MOEPGF_HWCAPS_SIMD_AVX2]  = {
 		.mulrc	= mulrc2,
-		.maddrc	= maddrc2_avx2
+		.maddrc	= maddrc2_avx2,
+		.maddrc_multi	= maddrc_multi2_avx2,
+		.maddrc_fanout	= maddrc_fanout2_avx2,
+		.maddrc3	= maddrc3_2_avx2,
+		.mulrc_copy	= mulrc_copy2,
+		.mulrr	= mulrr2_avx2,
+		.maddrr	= maddrr2_avx2,
+		.invr	= invr2,
+		.divr	= mulrr2_avx2,
+		.maddrc_unaligned	= maddrc_unaligned2_avx2,
+		.mulrc_unaligned	= mulrc2
 	},
 	[MOEPGF2][MOEPGF_HWCAPS_SIMD_AVX512]  = {
 		.mulrc	= mulrc2,
-		.maddrc	= maddrc2_avx512
+		.maddrc	= maddrc2_avx512,
+		.maddrc_multi	= maddrc_multi2_avx512,
+		.maddrc_fanout	= maddrc_fanout2_avx512,
+		.maddrc3	= maddrc3_2_avx512,
+		.mulrc_copy	= mulrc_copy2,
+		.mulrr	= mulrr2_avx512,
+		.maddrr	= maddrr2_avx512,
+		.invr	= invr2,
+		.divr	= mulrr2_avx512,
+		.maddrc_unaligned	= maddrc_unaligned2_avx512,
+		.mulrc_unaligned	= mulrc2
 	},
 	[MOEPGF2][MOEPGF_HWCAPS_SIMD_AVX512BW]  = {
 		.mulrc	= mulrc2,
-		.maddrc	= maddrc2_avx512
+		.maddrc	= maddrc2_avx512,
+		.maddrc_multi	= maddrc_multi2_avx512,
+		.maddrc_fanout	= maddrc_fanout2_avx512,
+		.maddrc3	= maddrc3_2_avx512,
+		.mulrc_copy	= mulrc_copy2,
+		.mulrr	= mulrr2_avx512,
+		.maddrr	= maddrr2_avx512,
+		.invr	= invr2,
+		.divr	= mulrr2_avx512,
+		.maddrc_unaligned	= maddrc_unaligned2_avx512,
+		.mulrc_unaligned	= mulrc2
 	},
 
 #endif
-#ifdef __arm__
+#if defined(__arm__) || defined(__aarch64__)
 	[MOEPGF2][MOEPGF_HWCAPS_SIMD_NEON]  = {
 		.mulrc	= mulrc2,
-		.maddrc	= maddrc2_neon
+		.maddrc	= maddrc2_neon,
+		.maddrc_multi	= maddrc_multi2_neon,
+		.maddrc_fanout	= maddrc_fanout2_neon,
+		.maddrc3	= maddrc3_2_neon,
+		.mulrc_copy	= mulrc_copy2,
+		.mulrr	= mulrr2_neon,
+		.maddrr	= maddrr2_neon,
+		.invr	= invr2,
+		.divr	= mulrr2_neon,
+		.maddrc_unaligned	= maddrc2_scalar,
+		.mulrc_unaligned	= mulrc2
+	},
+#endif
+#ifdef __aarch64__
+	[MOEPGF2][MOEPGF_HWCAPS_SIMD_NEON_SHA3]  = {
+		.mulrc	= mulrc2,
+		.maddrc	= maddrc2_neon,
+		.maddrc_multi	= maddrc_multi2_neon_sha3,
+		.maddrc_fanout	= maddrc_fanout2_neon,
+		.maddrc3	= maddrc3_2_neon,
+		.mulrc_copy	= mulrc_copy2,
+		.mulrr	= mulrr2_neon,
+		.maddrr	= maddrr2_neon,
+		.invr	= invr2,
+		.divr	= mulrr2_neon,
+		.maddrc_unaligned	= maddrc2_scalar,
+		.mulrc_unaligned	= mulrc2
 	},
 #endif
 
 	[MOEPGF4][MOEPGF_HWCAPS_SIMD_NONE]  = {
 		.mulrc	= mulrc4_imul_gpr64,
-		.maddrc	= maddrc4_imul_gpr64
+		.maddrc	= maddrc4_imul_gpr64,
+		.maddrc_multi	= maddrc_multi4_imul_gpr64,
+		.maddrc_fanout	= maddrc_fanout4_imul_gpr64,
+		.maddrc3	= maddrc3_4_imul_gpr64,
+		.mulrc_copy	= mulrc_copy4_imul_gpr64,
+		.mulrr	= mulrr4_imul_gpr64,
+		.maddrr	= maddrr4_imul_gpr64,
+		.invr	= invr4_imul_gpr64,
+		.divr	= divr4_imul_gpr64,
+		.maddrc_unaligned	= maddrc4_flat_table,
+		.mulrc_unaligned	= mulrc4_imul_scalar
 	},
 #ifdef __x86_64__
 	[MOEPGF4][MOEPGF_HWCAPS_SIMD_SSE2]  = {
 		.mulrc	= mulrc4_imul_sse2,
-		.maddrc	= maddrc4_imul_sse2
+		.maddrc	= maddrc4_imul_sse2,
+		.maddrc_multi	= maddrc_multi4_imul_sse2,
+		.maddrc_fanout	= maddrc_fanout4_imul_sse2,
+		.maddrc3	= maddrc3_4_imul_sse2,
+		.mulrc_copy	= mulrc_copy4_imul_sse2,
+		.mulrr	= mulrr4_imul_sse2,
+		.maddrr	= maddrr4_imul_sse2,
+		.invr	= invr4_imul_sse2,
+		.divr	= divr4_imul_sse2,
+		.maddrc_unaligned	= maddrc4_flat_table,
+		.mulrc_unaligned	= mulrc4_imul_scalar
 	},
 	[MOEPGF4][MOEPGF_HWCAPS_SIMD_SSSE3] = {
 		.mulrc	= mulrc4_shuffle_ssse3,
-		.maddrc	= maddrc4_shuffle_ssse3
+		.maddrc	= maddrc4_shuffle_ssse3,
+		.maddrc_multi	= maddrc_multi4_shuffle_ssse3,
+		.maddrc_fanout	= maddrc_fanout4_shuffle_ssse3,
+		.maddrc3	= maddrc3_4_shuffle_ssse3,
+		.mulrc_copy	= mulrc_copy4_shuffle_ssse3,
+		.mulrr	= mulrr4_imul_sse2,
+		.maddrr	= maddrr4_imul_sse2,
+		.invr	= invr4_imul_sse2,
+		.divr	= divr4_imul_sse2,
+		.maddrc_unaligned	= maddrc_unaligned4_shuffle_ssse3,
+		.mulrc_unaligned	= mulrc_unaligned4_shuffle_ssse3
 	},
 	[MOEPGF4][MOEPGF_HWCAPS_SIMD_AVX2]  = {
 		.mulrc	= mulrc4_shuffle_avx2,
-		.maddrc	= maddrc4_shuffle_avx2
+		.maddrc	= maddrc4_shuffle_avx2,
+		.maddrc_multi	= maddrc_multi4_shuffle_avx2,
+		.maddrc_fanout	= maddrc_fanout4_shuffle_avx2,
+		.maddrc3	= maddrc3_4_shuffle_avx2,
+		.mulrc_copy	= mulrc_copy4_shuffle_avx2,
+		.mulrr	= mulrr4_imul_avx2,
+		.maddrr	= maddrr4_imul_avx2,
+		.invr	= invr4_imul_avx2,
+		.divr	= divr4_imul_avx2,
+		.maddrc_unaligned	= maddrc_unaligned4_shuffle_avx2,
+		.mulrc_unaligned	= mulrc_unaligned4_shuffle_avx2,
+		.mulrc_copy_nt	= mulrc_copy_nt4_shuffle_avx2,
+		.maddrc3_nt	= maddrc3_nt4_shuffle_avx2
+	},
+	[MOEPGF4][MOEPGF_HWCAPS_SIMD_AVX512VL]  = {
+		.mulrc	= mulrc4_shuffle_avx512vl,
+		.maddrc	= maddrc4_shuffle_avx512vl,
+		.maddrc_multi	= maddrc_multi4_shuffle_avx512vl,
+		.maddrc_fanout	= maddrc_fanout4_shuffle_avx512vl,
+		.maddrc3	= maddrc3_4_shuffle_avx512vl,
+		.mulrc_copy	= mulrc_copy4_shuffle_avx512vl,
+		.mulrr	= mulrr4_imul_avx2,
+		.maddrr	= maddrr4_imul_avx2,
+		.invr	= invr4_imul_avx2,
+		.divr	= divr4_imul_avx2,
+		.maddrc_unaligned	= maddrc_unaligned4_shuffle_avx512vl,
+		.mulrc_unaligned	= mulrc_unaligned4_shuffle_avx512vl,
+		.mulrc_copy_nt	= mulrc_copy_nt4_shuffle_avx512vl,
+		.maddrc3_nt	= maddrc3_nt4_shuffle_avx512vl
 	},
 	[MOEPGF4][MOEPGF_HWCAPS_SIMD_AVX512]  = {
 		.mulrc	= mulrc4_imul_avx512,
-		.maddrc	= maddrc4_imul_avx512
+		.maddrc	= maddrc4_imul_avx512,
+		.maddrc_multi	= maddrc_multi4_shuffle_avx2,
+		.maddrc_fanout	= maddrc_fanout4_shuffle_avx2,
+		.maddrc3	= maddrc3_4_imul_avx512,
+		.mulrc_copy	= mulrc_copy4_imul_avx512,
+		.mulrr	= mulrr4_imul_avx512,
+		.maddrr	= maddrr4_imul_avx512,
+		.invr	= invr4_imul_avx512,
+		.divr	= divr4_imul_avx512,
+		.maddrc_unaligned	= maddrc_unaligned4_shuffle_avx2,
+		.mulrc_unaligned	= mulrc_unaligned4_shuffle_avx2
 	},
 	[MOEPGF4][MOEPGF_HWCAPS_SIMD_AVX512BW]  = {
 		.mulrc	= mulrc4_shuffle_avx512,
-		.maddrc	= maddrc4_shuffle_avx512
+		.maddrc	= maddrc4_shuffle_avx512,
+		.maddrc_multi	= maddrc_multi4_shuffle_avx512,
+		.maddrc_fanout	= maddrc_fanout4_shuffle_avx512,
+		.maddrc3	= maddrc3_4_shuffle_avx512,
+		.mulrc_copy	= mulrc_copy4_shuffle_avx512,
+		.mulrr	= mulrr4_imul_avx512,
+		.maddrr	= maddrr4_imul_avx512,
+		.invr	= invr4_imul_avx512,
+		.divr	= divr4_imul_avx512,
+		.maddrc_unaligned	= maddrc_unaligned4_shuffle_avx512,
+		.mulrc_unaligned	= mulrc_unaligned4_shuffle_avx512,
+		.mulrc_copy_nt	= mulrc_copy_nt4_shuffle_avx512,
+		.maddrc3_nt	= maddrc3_nt4_shuffle_avx512
+	},
+	[MOEPGF4][MOEPGF_HWCAPS_SIMD_AVX512GFNI]  = {
+		.mulrc	= mulrc4_gfni_affine512,
+		.maddrc	= maddrc4_gfni_affine512,
+		.maddrc_multi	= maddrc_multi4_gfni_affine512,
+		.maddrc_fanout	= maddrc_fanout4_gfni_affine512,
+		.maddrc3	= maddrc3_4_gfni_affine512,
+		.mulrc_copy	= mulrc_copy4_gfni_affine512,
+		.mulrr	= mulrr4_imul_avx512,
+		.maddrr	= maddrr4_imul_avx512,
+		.invr	= invr4_imul_avx512,
+		.divr	= divr4_imul_avx512,
+		.maddrc_unaligned	= maddrc_unaligned4_gfni_affine512,
+		.mulrc_unaligned	= mulrc_unaligned4_gfni_affine512,
+		.mulrc_copy_nt	= mulrc_copy_nt4_gfni_affine512,
+		.maddrc3_nt	= maddrc3_nt4_gfni_affine512
+	},
+	[MOEPGF4][MOEPGF_HWCAPS_SIMD_GFNI]  = {
+		.mulrc	= mulrc4_gfni_affine256,
+		.maddrc	= maddrc4_gfni_affine256,
+		.maddrc_multi	= maddrc_multi4_gfni_affine256,
+		.maddrc_fanout	= maddrc_fanout4_gfni_affine256,
+		.maddrc3	= maddrc3_4_gfni_affine256,
+		.mulrc_copy	= mulrc_copy4_gfni_affine256,
+		.mulrr	= mulrr4_imul_avx2,
+		.maddrr	= maddrr4_imul_avx2,
+		.invr	= invr4_imul_avx2,
+		.divr	= divr4_imul_avx2,
+		.maddrc_unaligned	= maddrc_unaligned4_gfni_affine256,
+		.mulrc_unaligned	= mulrc_unaligned4_gfni_affine256,
+		.mulrc_copy_nt	= mulrc_copy_nt4_gfni_affine256,
+		.maddrc3_nt	= maddrc3_nt4_gfni_affine256
 	},
 #endif
 #ifdef __arm__
 	[MOEPGF4][MOEPGF_HWCAPS_SIMD_NEON]  = {
 		.mulrc	= mulrc4_imul_neon_64,
-		.maddrc	= maddrc4_imul_neon_128
+		.maddrc	= maddrc4_imul_neon_128,
+		.maddrc_multi	= maddrc_multi4_imul_neon_128,
+		.maddrc_fanout	= maddrc_fanout4_imul_neon_128,
+		.maddrc3	= maddrc3_4_imul_neon_128,
+		.mulrc_copy	= mulrc_copy4_imul_neon_64,
+		.mulrr	= mulrr4_imul_neon_128,
+		.maddrr	= maddrr4_imul_neon_128,
+		.invr	= invr4_imul_neon_128,
+		.divr	= divr4_imul_neon_128,
+		.maddrc_unaligned	= maddrc4_flat_table,
+		.mulrc_unaligned	= mulrc4_imul_scalar
+	},
+#endif
+#ifdef __aarch64__
+	[MOEPGF4][MOEPGF_HWCAPS_SIMD_NEON]  = {
+		.mulrc	= mulrc4_shuffle_neon_128,
+		.maddrc	= maddrc4_shuffle_neon_128,
+		.maddrc_multi	= maddrc_multi4_shuffle_neon_128,
+		.maddrc_fanout	= maddrc_fanout4_shuffle_neon_128,
+		.maddrc3	= maddrc3_4_shuffle_neon_128,
+		.mulrc_copy	= mulrc_copy4_shuffle_neon_128,
+		.mulrr	= mulrr4_imul_gpr64,
+		.maddrr	= maddrr4_imul_gpr64,
+		.invr	= invr4_flat_table,
+		.divr	= divr4_flat_table,
+		.maddrc_unaligned	= maddrc4_flat_table,
+		.mulrc_unaligned	= mulrc4_imul_scalar
+	},
+	[MOEPGF4][MOEPGF_HWCAPS_SIMD_NEON_SHA3]  = {
+		.mulrc	= mulrc4_shuffle_neon_128,
+		.maddrc	= maddrc4_shuffle_neon_sha3,
+		.maddrc_multi	= maddrc_multi4_shuffle_neon_sha3,
+		.maddrc_fanout	= maddrc_fanout4_shuffle_neon_sha3,
+		.maddrc3	= maddrc3_4_shuffle_neon_sha3,
+		.mulrc_copy	= mulrc_copy4_shuffle_neon_128,
+		.mulrr	= mulrr4_imul_gpr64,
+		.maddrr	= maddrr4_imul_gpr64,
+		.invr	= invr4_flat_table,
+		.divr	= divr4_flat_table,
+		.maddrc_unaligned	= maddrc4_flat_table,
+		.mulrc_unaligned	= mulrc4_imul_scalar
+	},
+#endif
+#ifdef BEST_VECTOR
+	[MOEPGF4][MOEPGF_HWCAPS_SIMD_VECTOR]  = {
+		.mulrc	= mulrc4_shuffle_vector,
+		.maddrc	= maddrc4_shuffle_vector,
+		.maddrc_multi	= maddrc_multi4_shuffle_vector,
+		.maddrc_fanout	= maddrc_fanout4_shuffle_vector,
+		.maddrc3	= maddrc3_4_shuffle_vector,
+		.mulrc_copy	= mulrc_copy4_shuffle_vector,
+		.mulrr	= mulrr4_imul_gpr64,
+		.maddrr	= maddrr4_imul_gpr64,
+		.invr	= invr4_flat_table,
+		.divr	= divr4_flat_table,
+		.maddrc_unaligned	= maddrc4_flat_table,
+		.mulrc_unaligned	= mulrc4_imul_scalar
 	},
 #endif
 
 	[MOEPGF16][MOEPGF_HWCAPS_SIMD_NONE]  = {
 		.mulrc	= mulrc16_imul_gpr64,
-		.maddrc	= maddrc16_imul_gpr64
+		.maddrc	= maddrc16_imul_gpr64,
+		.maddrc_multi	= maddrc_multi16_imul_gpr64,
+		.maddrc_fanout	= maddrc_fanout16_imul_gpr64,
+		.maddrc3	= maddrc3_16_imul_gpr64,
+		.mulrc_copy	= mulrc_copy16_imul_gpr64,
+		.mulrr	= mulrr16_imul_gpr64,
+		.maddrr	= maddrr16_imul_gpr64,
+		.invr	= invr16_flat_table,
+		.divr	= divr16_flat_table,
+		.maddrc_unaligned	= maddrc16_flat_table,
+		.mulrc_unaligned	= mulrc16_imul_scalar
 	},
 #ifdef __x86_64__
 	[MOEPGF16][MOEPGF_HWCAPS_SIMD_SSE2]  = {
 		.mulrc	= mulrc16_imul_sse2,
-		.maddrc	= maddrc16_imul_sse2
+		.maddrc	= maddrc16_imul_sse2,
+		.maddrc_multi	= maddrc_multi16_imul_sse2,
+		.maddrc_fanout	= maddrc_fanout16_imul_sse2,
+		.maddrc3	= maddrc3_16_imul_sse2,
+		.mulrc_copy	= mulrc_copy16_imul_sse2,
+		.mulrr	= mulrr16_imul_sse2,
+		.maddrr	= maddrr16_imul_sse2,
+		.invr	= invr16_flat_table,
+		.divr	= divr16_flat_table,
+		.maddrc_unaligned	= maddrc16_flat_table,
+		.mulrc_unaligned	= mulrc16_imul_scalar
 	},
 	[MOEPGF16][MOEPGF_HWCAPS_SIMD_SSSE3] = {
 		.mulrc	= mulrc16_shuffle_ssse3,
-		.maddrc	= maddrc16_shuffle_ssse3
+		.maddrc	= maddrc16_shuffle_ssse3,
+		.maddrc_multi	= maddrc_multi16_shuffle_ssse3,
+		.maddrc_fanout	= maddrc_fanout16_shuffle_ssse3,
+		.maddrc3	= maddrc3_16_shuffle_ssse3,
+		.mulrc_copy	= mulrc_copy16_shuffle_ssse3,
+		.mulrr	= mulrr16_imul_sse2,
+		.maddrr	= maddrr16_imul_sse2,
+		.invr	= invr16_shuffle_ssse3,
+		.divr	= divr16_shuffle_ssse3,
+		.maddrc_unaligned	= maddrc_unaligned16_shuffle_ssse3,
+		.mulrc_unaligned	= mulrc_unaligned16_shuffle_ssse3
 	},
 	[MOEPGF16][MOEPGF_HWCAPS_SIMD_AVX2]  = {
 		.mulrc	= mulrc16_shuffle_avx2,
-		.maddrc	= maddrc16_shuffle_avx2
+		.maddrc	= maddrc16_shuffle_avx2,
+		.maddrc_multi	= maddrc_multi16_shuffle_avx2,
+		.maddrc_fanout	= maddrc_fanout16_shuffle_avx2,
+		.maddrc3	= maddrc3_16_shuffle_avx2,
+		.mulrc_copy	= mulrc_copy16_shuffle_avx2,
+		.mulrr	= mulrr16_imul_avx2,
+		.maddrr	= maddrr16_imul_avx2,
+		.invr	= invr16_shuffle_avx2,
+		.divr	= divr16_shuffle_avx2,
+		.maddrc_unaligned	= maddrc_unaligned16_shuffle_avx2,
+		.mulrc_unaligned	= mulrc_unaligned16_shuffle_avx2,
+		.mulrc_copy_nt	= mulrc_copy_nt16_shuffle_avx2,
+		.maddrc3_nt	= maddrc3_nt16_shuffle_avx2
+	},
+	[MOEPGF16][MOEPGF_HWCAPS_SIMD_AVX512VL]  = {
+		.mulrc	= mulrc16_shuffle_avx512vl,
+		.maddrc	= maddrc16_shuffle_avx512vl,
+		.maddrc_multi	= maddrc_multi16_shuffle_avx512vl,
+		.maddrc_fanout	= maddrc_fanout16_shuffle_avx512vl,
+		.maddrc3	= maddrc3_16_shuffle_avx512vl,
+		.mulrc_copy	= mulrc_copy16_shuffle_avx512vl,
+		.mulrr	= mulrr16_imul_avx2,
+		.maddrr	= maddrr16_imul_avx2,
+		.invr	= invr16_shuffle_avx2,
+		.divr	= divr16_shuffle_avx2,
+		.maddrc_unaligned	= maddrc_unaligned16_shuffle_avx512vl,
+		.mulrc_unaligned	= mulrc_unaligned16_shuffle_avx512vl,
+		.mulrc_copy_nt	= mulrc_copy_nt16_shuffle_avx512vl,
+		.maddrc3_nt	= maddrc3_nt16_shuffle_avx512vl
 	},
 	[MOEPGF16][MOEPGF_HWCAPS_SIMD_AVX512]  = {
 		.mulrc	= mulrc16_imul_avx512,
-		.maddrc	= maddrc16_imul_avx512
+		.maddrc	= maddrc16_imul_avx512,
+		.maddrc_multi	= maddrc_multi16_shuffle_avx2,
+		.maddrc_fanout	= maddrc_fanout16_shuffle_avx2,
+		.maddrc3	= maddrc3_16_imul_avx512,
+		.mulrc_copy	= mulrc_copy16_imul_avx512,
+		.mulrr	= mulrr16_imul_avx512,
+		.maddrr	= maddrr16_imul_avx512,
+		.invr	= invr16_shuffle_avx2,
+		.divr	= divr16_shuffle_avx2,
+		.maddrc_unaligned	= maddrc_unaligned16_shuffle_avx2,
+		.mulrc_unaligned	= mulrc_unaligned16_shuffle_avx2
 	},
 	[MOEPGF16][MOEPGF_HWCAPS_SIMD_AVX512BW]  = {
 		.mulrc	= mulrc16_shuffle_avx512,
-		.maddrc	= maddrc16_shuffle_avx512
+		.maddrc	= maddrc16_shuffle_avx512,
+		.maddrc_multi	= maddrc_multi16_shuffle_avx512,
+		.maddrc_fanout	= maddrc_fanout16_shuffle_avx512,
+		.maddrc3	= maddrc3_16_shuffle_avx512,
+		.mulrc_copy	= mulrc_copy16_shuffle_avx512,
+		.mulrr	= mulrr16_imul_avx512,
+		.maddrr	= maddrr16_imul_avx512,
+		.invr	= invr16_shuffle_avx512,
+		.divr	= divr16_shuffle_avx512,
+		.maddrc_unaligned	= maddrc_unaligned16_shuffle_avx512,
+		.mulrc_unaligned	= mulrc_unaligned16_shuffle_avx512,
+		.mulrc_copy_nt	= mulrc_copy_nt16_shuffle_avx512,
+		.maddrc3_nt	= maddrc3_nt16_shuffle_avx512
+	},
+	[MOEPGF16][MOEPGF_HWCAPS_SIMD_AVX512GFNI]  = {
+		.mulrc	= mulrc16_gfni_affine512,
+		.maddrc	= maddrc16_gfni_affine512,
+		.maddrc_multi	= maddrc_multi16_gfni_affine512,
+		.maddrc_fanout	= maddrc_fanout16_gfni_affine512,
+		.maddrc3	= maddrc3_16_gfni_affine512,
+		.mulrc_copy	= mulrc_copy16_gfni_affine512,
+		.mulrr	= mulrr16_imul_avx512,
+		.maddrr	= maddrr16_imul_avx512,
+		.invr	= invr16_shuffle_avx512,
+		.divr	= divr16_shuffle_avx512,
+		.maddrc_unaligned	= maddrc_unaligned16_gfni_affine512,
+		.mulrc_unaligned	= mulrc_unaligned16_gfni_affine512,
+		.mulrc_copy_nt	= mulrc_copy_nt16_gfni_affine512,
+		.maddrc3_nt	= maddrc3_nt16_gfni_affine512
+	},
+	[MOEPGF16][MOEPGF_HWCAPS_SIMD_GFNI]  = {
+		.mulrc	= mulrc16_gfni_affine256,
+		.maddrc	= maddrc16_gfni_affine256,
+		.maddrc_multi	= maddrc_multi16_gfni_affine256,
+		.maddrc_fanout	= maddrc_fanout16_gfni_affine256,
+		.maddrc3	= maddrc3_16_gfni_affine256,
+		.mulrc_copy	= mulrc_copy16_gfni_affine256,
+		.mulrr	= mulrr16_imul_avx2,
+		.maddrr	= maddrr16_imul_avx2,
+		.invr	= invr16_shuffle_avx2,
+		.divr	= divr16_shuffle_avx2,
+		.maddrc_unaligned	= maddrc_unaligned16_gfni_affine256,
+		.mulrc_unaligned	= mulrc_unaligned16_gfni_affine256,
+		.mulrc_copy_nt	= mulrc_copy_nt16_gfni_affine256,
+		.maddrc3_nt	= maddrc3_nt16_gfni_affine256
 	},
 
 #endif
 #ifdef __arm__
 	[MOEPGF16][MOEPGF_HWCAPS_SIMD_NEON]  = {
 		.mulrc	= mulrc16_shuffle_neon_64,
-		.maddrc	= maddrc16_shuffle_neon_64
+		.maddrc	= maddrc16_shuffle_neon_64,
+		.maddrc_multi	= maddrc_multi16_shuffle_neon_64,
+		.maddrc_fanout	= maddrc_fanout16_shuffle_neon_64,
+		.maddrc3	= maddrc3_16_shuffle_neon_64,
+		.mulrc_copy	= mulrc_copy16_shuffle_neon_64,
+		.mulrr	= mulrr16_imul_neon_128,
+		.maddrr	= maddrr16_imul_neon_128,
+		.invr	= invr16_shuffle_neon_64,
+		.divr	= divr16_shuffle_neon_64,
+		.maddrc_unaligned	= maddrc16_flat_table,
+		.mulrc_unaligned	= mulrc16_imul_scalar
+	},
+#endif
+#ifdef __aarch64__
+	[MOEPGF16][MOEPGF_HWCAPS_SIMD_NEON]  = {
+		.mulrc	= mulrc16_shuffle_neon_128,
+		.maddrc	= maddrc16_shuffle_neon_128,
+		.maddrc_multi	= maddrc_multi16_shuffle_neon_128,
+		.maddrc_fanout	= maddrc_fanout16_shuffle_neon_128,
+		.maddrc3	= maddrc3_16_shuffle_neon_128,
+		.mulrc_copy	= mulrc_copy16_shuffle_neon_128,
+		.mulrr	= mulrr16_imul_gpr64,
+		.maddrr	= maddrr16_imul_gpr64,
+		.invr	= invr16_shuffle_neon_128,
+		.divr	= divr16_flat_table,
+		.maddrc_unaligned	= maddrc16_flat_table,
+		.mulrc_unaligned	= mulrc16_imul_scalar
+	},
+	[MOEPGF16][MOEPGF_HWCAPS_SIMD_NEON_SHA3]  = {
+		.mulrc	= mulrc16_shuffle_neon_128,
+		.maddrc	= maddrc16_shuffle_neon_sha3,
+		.maddrc_multi	= maddrc_multi16_shuffle_neon_sha3,
+		.maddrc_fanout	= maddrc_fanout16_shuffle_neon_sha3,
+		.maddrc3	= maddrc3_16_shuffle_neon_sha3,
+		.mulrc_copy	= mulrc_copy16_shuffle_neon_128,
+		.mulrr	= mulrr16_imul_gpr64,
+		.maddrr	= maddrr16_imul_gpr64,
+		.invr	= invr16_shuffle_neon_128,
+		.divr	= divr16_flat_table,
+		.maddrc_unaligned	= maddrc16_flat_table,
+		.mulrc_unaligned	= mulrc16_imul_scalar
+	},
+#endif
+#ifdef BEST_VECTOR
+	[MOEPGF16][MOEPGF_HWCAPS_SIMD_VECTOR]  = {
+		.mulrc	= mulrc16_shuffle_vector,
+		.maddrc	= maddrc16_shuffle_vector,
+		.maddrc_multi	= maddrc_multi16_shuffle_vector,
+		.maddrc_fanout	= maddrc_fanout16_shuffle_vector,
+		.maddrc3	= maddrc3_16_shuffle_vector,
+		.mulrc_copy	= mulrc_copy16_shuffle_vector,
+		.mulrr	= mulrr16_imul_gpr64,
+		.maddrr	= maddrr16_imul_gpr64,
+		.invr	= invr16_flat_table,
+		.divr	= divr16_flat_table,
+		.maddrc_unaligned	= maddrc16_flat_table,
+		.mulrc_unaligned	= mulrc16_imul_scalar
 	},
 #endif
 
 	[MOEPGF256][MOEPGF_HWCAPS_SIMD_NONE]  = {
 		.mulrc	= mulrc256_imul_gpr64,
-		.maddrc	= maddrc256_imul_gpr64
+		.maddrc	= maddrc256_imul_gpr64,
+		.maddrc_multi	= maddrc_multi256_imul_gpr64,
+		.maddrc_fanout	= maddrc_fanout256_imul_gpr64,
+		.maddrc3	= maddrc3_256_imul_gpr64,
+		.mulrc_copy	= mulrc_copy256_imul_gpr64,
+		.mulrr	= mulrr256_imul_gpr64,
+		.maddrr	= maddrr256_imul_gpr64,
+		.invr	= invr256_flat_table,
+		.divr	= divr256_flat_table,
+		.maddrc_unaligned	= maddrc256_flat_table,
+		.mulrc_unaligned	= mulrc256_pdiv
 	},
 #ifdef __x86_64__
 	[MOEPGF256][MOEPGF_HWCAPS_SIMD_SSE2]  = {
 		.mulrc	= mulrc256_imul_sse2,
-		.maddrc	= maddrc256_imul_sse2
+		.maddrc	= maddrc256_imul_sse2,
+		.maddrc_multi	= maddrc_multi256_imul_sse2,
+		.maddrc_fanout	= maddrc_fanout256_imul_sse2,
+		.maddrc3	= maddrc3_256_imul_sse2,
+		.mulrc_copy	= mulrc_copy256_imul_sse2,
+		.mulrr	= mulrr256_imul_sse2,
+		.maddrr	= maddrr256_imul_sse2,
+		.invr	= invr256_flat_table,
+		.divr	= divr256_flat_table,
+		.maddrc_unaligned	= maddrc256_flat_table,
+		.mulrc_unaligned	= mulrc256_pdiv
 	},
 	[MOEPGF256][MOEPGF_HWCAPS_SIMD_SSSE3] = {
 		.mulrc	= mulrc256_shuffle_ssse3,
-		.maddrc	= maddrc256_shuffle_ssse3
+		.maddrc	= maddrc256_shuffle_ssse3,
+		.maddrc_multi	= maddrc_multi256_shuffle_ssse3,
+		.maddrc_fanout	= maddrc_fanout256_shuffle_ssse3,
+		.maddrc3	= maddrc3_256_shuffle_ssse3,
+		.mulrc_copy	= mulrc_copy256_shuffle_ssse3,
+		.mulrr	= mulrr256_imul_sse2,
+		.maddrr	= maddrr256_imul_sse2,
+		.invr	= invr256_flat_table,
+		.divr	= divr256_flat_table,
+		.maddrc_unaligned	= maddrc_unaligned256_shuffle_ssse3,
+		.mulrc_unaligned	= mulrc_unaligned256_shuffle_ssse3
 	},
 	[MOEPGF256][MOEPGF_HWCAPS_SIMD_AVX2]  = {
 		.mulrc	= mulrc256_shuffle_avx2,
-		.maddrc	= maddrc256_shuffle_avx2
+		.maddrc	= maddrc256_shuffle_avx2,
+		.maddrc_multi	= maddrc_multi256_shuffle_avx2,
+		.maddrc_fanout	= maddrc_fanout256_shuffle_avx2,
+		.maddrc3	= maddrc3_256_shuffle_avx2,
+		.mulrc_copy	= mulrc_copy256_shuffle_avx2,
+		.mulrr	= mulrr256_imul_avx2,
+		.maddrr	= maddrr256_imul_avx2,
+		.invr	= invr256_flat_table,
+		.divr	= divr256_flat_table,
+		.maddrc_unaligned	= maddrc_unaligned256_shuffle_avx2,
+		.mulrc_unaligned	= mulrc_unaligned256_shuffle_avx2,
+		.mulrc_copy_nt	= mulrc_copy_nt256_shuffle_avx2,
+		.maddrc3_nt	= maddrc3_nt256_shuffle_avx2
+	},
+	[MOEPGF256][MOEPGF_HWCAPS_SIMD_AVX512VL]  = {
+		.mulrc	= mulrc256_shuffle_avx512vl,
+		.maddrc	= maddrc256_shuffle_avx512vl,
+		.maddrc_multi	= maddrc_multi256_shuffle_avx512vl,
+		.maddrc_fanout	= maddrc_fanout256_shuffle_avx512vl,
+		.maddrc3	= maddrc3_256_shuffle_avx512vl,
+		.mulrc_copy	= mulrc_copy256_shuffle_avx512vl,
+		.mulrr	= mulrr256_imul_avx2,
+		.maddrr	= maddrr256_imul_avx2,
+		.invr	= invr256_flat_table,
+		.divr	= divr256_flat_table,
+		.maddrc_unaligned	= maddrc_unaligned256_shuffle_avx512vl,
+		.mulrc_unaligned	= mulrc_unaligned256_shuffle_avx512vl,
+		.mulrc_copy_nt	= mulrc_copy_nt256_shuffle_avx512vl,
+		.maddrc3_nt	= maddrc3_nt256_shuffle_avx512vl
 	},
 	[MOEPGF256][MOEPGF_HWCAPS_SIMD_AVX512]  = {
 		.mulrc	= mulrc256_imul_avx512,
-		.maddrc	= maddrc256_imul_avx512
+		.maddrc	= maddrc256_imul_avx512,
+		.maddrc_multi	= maddrc_multi256_shuffle_avx2,
+		.maddrc_fanout	= maddrc_fanout256_shuffle_avx2,
+		.maddrc3	= maddrc3_256_imul_avx512,
+		.mulrc_copy	= mulrc_copy256_imul_avx512,
+		.mulrr	= mulrr256_imul_avx512,
+		.maddrr	= maddrr256_imul_avx512,
+		.invr	= invr256_flat_table,
+		.divr	= divr256_flat_table,
+		.maddrc_unaligned	= maddrc_unaligned256_shuffle_avx2,
+		.mulrc_unaligned	= mulrc_unaligned256_shuffle_avx2
 	},
 	[MOEPGF256][MOEPGF_HWCAPS_SIMD_AVX512BW]  = {
 		.mulrc	= mulrc256_shuffle_avx512,
-		.maddrc	= maddrc256_shuffle_avx512
+		.maddrc	= maddrc256_shuffle_avx512,
+		.maddrc_multi	= maddrc_multi256_shuffle_avx512,
+		.maddrc_fanout	= maddrc_fanout256_shuffle_avx512,
+		.maddrc3	= maddrc3_256_shuffle_avx512,
+		.mulrc_copy	= mulrc_copy256_shuffle_avx512,
+		.mulrr	= mulrr256_imul_avx512,
+		.maddrr	= maddrr256_imul_avx512,
+		.invr	= invr256_shuffle_avx512,
+		.divr	= divr256_shuffle_avx512,
+		.maddrc_unaligned	= maddrc_unaligned256_shuffle_avx512,
+		.mulrc_unaligned	= mulrc_unaligned256_shuffle_avx512,
+		.mulrc_copy_nt	= mulrc_copy_nt256_shuffle_avx512,
+		.maddrc3_nt	= maddrc3_nt256_shuffle_avx512
 	},
+#if MOEPGF256_POLYNOMIAL == 283
 	[MOEPGF256][MOEPGF_HWCAPS_SIMD_AVX512GFNI]  = {
 		.mulrc	= mulrc256_gfni512,
-		.maddrc	= maddrc256_gfni512
+		.maddrc	= maddrc256_gfni512,
+		.maddrc_multi	= maddrc_multi256_gfni512,
+		.maddrc_fanout	= maddrc_fanout256_gfni512,
+		.maddrc3	= maddrc3_256_gfni512,
+		.mulrc_copy	= mulrc_copy256_gfni512,
+		.mulrr	= mulrr256_gfni512,
+		.maddrr	= maddrr256_gfni512,
+		.invr	= invr256_gfni512,
+		.divr	= divr256_gfni512,
+		.maddrc_unaligned	= maddrc_unaligned256_gfni512,
+		.mulrc_unaligned	= mulrc_unaligned256_gfni512,
+		.mulrc_copy_nt	= mulrc_copy_nt256_gfni512,
+		.maddrc3_nt	= maddrc3_nt256_gfni512
+	},
+	[MOEPGF256][MOEPGF_HWCAPS_SIMD_GFNI]  = {
+		.mulrc	= mulrc256_gfni256,
+		.maddrc	= maddrc256_gfni256,
+		.maddrc_multi	= maddrc_multi256_gfni256,
+		.maddrc_fanout	= maddrc_fanout256_gfni256,
+		.maddrc3	= maddrc3_256_gfni256,
+		.mulrc_copy	= mulrc_copy256_gfni256,
+		.mulrr	= mulrr256_gfni256,
+		.maddrr	= maddrr256_gfni256,
+		.invr	= invr256_gfni256,
+		.divr	= divr256_gfni256,
+		.maddrc_unaligned	= maddrc_unaligned256_gfni256,
+		.mulrc_unaligned	= mulrc_unaligned256_gfni256,
+		.mulrc_copy_nt	= mulrc_copy_nt256_gfni256,
+		.maddrc3_nt	= maddrc3_nt256_gfni256
+	},
+#else
+	[MOEPGF256][MOEPGF_HWCAPS_SIMD_AVX512GFNI]  = {
+		.mulrc	= mulrc256_gfni_affine512,
+		.maddrc	= maddrc256_gfni_affine512,
+		.maddrc_multi	= maddrc_multi256_gfni_affine512,
+		.maddrc_fanout	= maddrc_fanout256_gfni_affine512,
+		.maddrc3	= maddrc3_256_gfni_affine512,
+		.mulrc_copy	= mulrc_copy256_gfni_affine512,
+		.mulrr	= mulrr256_imul_avx512,
+		.maddrr	= maddrr256_imul_avx512,
+		.invr	= invr256_shuffle_avx512,
+		.divr	= divr256_shuffle_avx512,
+		.maddrc_unaligned	= maddrc_unaligned256_gfni_affine512,
+		.mulrc_unaligned	= mulrc_unaligned256_gfni_affine512,
+		.mulrc_copy_nt	= mulrc_copy_nt256_gfni_affine512,
+		.maddrc3_nt	= maddrc3_nt256_gfni_affine512
 	},
+	[MOEPGF256][MOEPGF_HWCAPS_SIMD_GFNI]  = {
+		.mulrc	= mulrc256_gfni_affine256,
+		.maddrc	= maddrc256_gfni_affine256,
+		.maddrc_multi	= maddrc_multi256_gfni_affine256,
+		.maddrc_fanout	= maddrc_fanout256_gfni_affine256,
+		.maddrc3	= maddrc3_256_gfni_affine256,
+		.mulrc_copy	= mulrc_copy256_gfni_affine256,
+		.mulrr	= mulrr256_imul_avx2,
+		.maddrr	= maddrr256_imul_avx2,
+		.invr	= invr256_flat_table,
+		.divr	= divr256_flat_table,
+		.maddrc_unaligned	= maddrc_unaligned256_gfni_affine256,
+		.mulrc_unaligned	= mulrc_unaligned256_gfni_affine256,
+		.mulrc_copy_nt	= mulrc_copy_nt256_gfni_affine256,
+		.maddrc3_nt	= maddrc3_nt256_gfni_affine256
+	},
+#endif
 
 #endif
 #ifdef __arm__
 	[MOEPGF256][MOEPGF_HWCAPS_SIMD_NEON]  = {
 		.mulrc	= mulrc256_shuffle_neon_64,
-		.maddrc	= maddrc256_shuffle_neon_64
+		.maddrc	= maddrc256_shuffle_neon_64,
+		.maddrc_multi	= maddrc_multi256_shuffle_neon_64,
+		.maddrc_fanout	= maddrc_fanout256_shuffle_neon_64,
+		.maddrc3	= maddrc3_256_shuffle_neon_64,
+		.mulrc_copy	= mulrc_copy256_shuffle_neon_64,
+		.mulrr	= mulrr256_imul_neon_128,
+		.maddrr	= maddrr256_imul_neon_128,
+		.invr	= invr256_flat_table,
+		.divr	= divr256_flat_table,
+		.maddrc_unaligned	= maddrc256_flat_table,
+		.mulrc_unaligned	= mulrc256_pdiv
+	},
+#endif
+#ifdef __aarch64__
+	[MOEPGF256][MOEPGF_HWCAPS_SIMD_NEON]  = {
+		.mulrc	= mulrc256_shuffle_neon_128,
+		.maddrc	= maddrc256_shuffle_neon_128,
+		.maddrc_multi	= maddrc_multi256_shuffle_neon_128,
+		.maddrc_fanout	= maddrc_fanout256_shuffle_neon_128,
+		.maddrc3	= maddrc3_256_shuffle_neon_128,
+		.mulrc_copy	= mulrc_copy256_shuffle_neon_128,
+		.mulrr	= mulrr256_pmull_neon_128,
+		.maddrr	= maddrr256_pmull_neon_128,
+		.invr	= invr256_shuffle_neon_128,
+		.divr	= divr256_pmull_neon_128,
+		.maddrc_unaligned	= maddrc256_flat_table,
+		.mulrc_unaligned	= mulrc256_pdiv
+	},
+	[MOEPGF256][MOEPGF_HWCAPS_SIMD_NEON_SHA3]  = {
+		.mulrc	= mulrc256_shuffle_neon_128,
+		.maddrc	= maddrc256_shuffle_neon_sha3,
+		.maddrc_multi	= maddrc_multi256_shuffle_neon_sha3,
+		.maddrc_fanout	= maddrc_fanout256_shuffle_neon_sha3,
+		.maddrc3	= maddrc3_256_shuffle_neon_sha3,
+		.mulrc_copy	= mulrc_copy256_shuffle_neon_128,
+		.mulrr	= mulrr256_pmull_neon_128,
+		.maddrr	= maddrr256_pmull_neon_128,
+		.invr	= invr256_shuffle_neon_128,
+		.divr	= divr256_pmull_neon_128,
+		.maddrc_unaligned	= maddrc256_flat_table,
+		.mulrc_unaligned	= mulrc256_pdiv
+	},
+#endif
+#ifdef BEST_VECTOR
+	[MOEPGF256][MOEPGF_HWCAPS_SIMD_VECTOR]  = {
+		.mulrc	= mulrc256_shuffle_vector,
+		.maddrc	= maddrc256_shuffle_vector,
+		.maddrc_multi	= maddrc_multi256_shuffle_vector,
+		.maddrc_fanout	= maddrc_fanout256_shuffle_vector,
+		.maddrc3	= maddrc3_256_shuffle_vector,
+		.mulrc_copy	= mulrc_copy256_shuffle_vector,
+		.mulrr	= mulrr256_imul_gpr64,
+		.maddrr	= maddrr256_imul_gpr64,
+		.invr	= invr256_flat_table,
+		.divr	= divr256_flat_table,
+		.maddrc_unaligned	= maddrc256_flat_table,
+		.mulrc_unaligned	= mulrc256_pdiv
+	},
+#endif
+};
+
+/*
+ * Order in which hwcaps are tried when the best algorithm is requested. The
+ * first hwcaps that is supported by the CPU and has an entry for the requested
+ * field in best_algorithms wins. AVX512VBMI is not listed: on the CPUs we
+ * measured, two vpermi2b per vector do not beat the nibble shuffles of the
+ * AVX512BW kernels. The lookup kernels remain available to autotune.
+ */
+static const enum MOEPGF_HWCAPS best_hwcaps[] = {
+#ifdef __x86_64__
+	MOEPGF_HWCAPS_SIMD_AVX512GFNI,
+	MOEPGF_HWCAPS_SIMD_GFNI,
+	MOEPGF_HWCAPS_SIMD_AVX512BW,
+	MOEPGF_HWCAPS_SIMD_AVX512,
+	MOEPGF_HWCAPS_SIMD_AVX512VL,
+	MOEPGF_HWCAPS_SIMD_AVX2,
+	MOEPGF_HWCAPS_SIMD_SSSE3,
+	MOEPGF_HWCAPS_SIMD_SSE2,
+#endif
+#ifdef __arm__
+	MOEPGF_HWCAPS_SIMD_NEON,
+#endif
+#ifdef __aarch64__
+	MOEPGF_HWCAPS_SIMD_NEON_SHA3,
+	MOEPGF_HWCAPS_SIMD_NEON,
+#endif
+#ifdef BEST_VECTOR
+	MOEPGF_HWCAPS_SIMD_VECTOR,
+#endif
+	MOEPGF_HWCAPS_SIMD_NONE
+};
+
+/*
+ * All algorithms available per field. Entries without maddrc are not
+ * available on the current architecture.
+ */
+static const struct moepgf_algorithm
+algorithms[MOEPGF_COUNT][MOEPGF_ALGORITHM_COUNT] = {
+	[MOEPGF2][MOEPGF_XOR_GPR32] = {
+		.maddrc		= maddrc2_gpr32,
+		.mulrc		= mulrc2,
+		.maddrc_multi	= maddrc_multi2_gpr32,
+		.maddrc_fanout	= maddrc_fanout2_gpr32,
+		.maddrc3	= maddrc3_2_gpr32,
+		.mulrc_copy	= mulrc_copy2,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NONE,
+	},
+	[MOEPGF2][MOEPGF_XOR_GPR64] = {
+		.maddrc		= maddrc2_gpr64,
+		.mulrc		= mulrc2,
+		.maddrc_multi	= maddrc_multi2_gpr64,
+		.maddrc_fanout	= maddrc_fanout2_gpr64,
+		.maddrc3	= maddrc3_2_gpr64,
+		.mulrc_copy	= mulrc_copy2,
+		.mulrr		= mulrr2_gpr64,
+		.maddrr		= maddrr2_gpr64,
+		.invr		= invr2,
+		.divr		= mulrr2_gpr64,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NONE,
+	},
+#ifdef __x86_64__
+	[MOEPGF2][MOEPGF_XOR_SSE2] = {
+		.maddrc		= maddrc2_sse2,
+		.mulrc		= mulrc2,
+		.maddrc_multi	= maddrc_multi2_sse2,
+		.maddrc_fanout	= maddrc_fanout2_sse2,
+		.maddrc3	= maddrc3_2_sse2,
+		.mulrc_copy	= mulrc_copy2,
+		.mulrr		= mulrr2_sse2,
+		.maddrr		= maddrr2_sse2,
+		.invr		= invr2,
+		.divr		= mulrr2_sse2,
+		.maddrc_unaligned	= maddrc_unaligned2_sse2,
+		.mulrc_unaligned	= mulrc2,
+		.maddrc_prefetch	= maddrc_prefetch2_sse2,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_SSE2,
+	},
+	[MOEPGF2][MOEPGF_XOR_AVX2] = {
+		.maddrc		= maddrc2_avx2,
+		.mulrc		= mulrc2,
+		.maddrc_multi	= maddrc_multi2_avx2,
+		.maddrc_fanout	= maddrc_fanout2_avx2,
+		.maddrc3	= maddrc3_2_avx2,
+		.mulrc_copy	= mulrc_copy2,
+		.mulrr		= mulrr2_avx2,
+		.maddrr		= maddrr2_avx2,
+		.invr		= invr2,
+		.divr		= mulrr2_avx2,
+		.maddrc_unaligned	= maddrc_unaligned2_avx2,
+		.mulrc_unaligned	= mulrc2,
+		.maddrc_prefetch	= maddrc_prefetch2_avx2,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX2,
+	},
+	[MOEPGF2][MOEPGF_XOR_AVX512] = {
+		.maddrc		= maddrc2_avx512,
+		.mulrc		= mulrc2,
+		.maddrc_multi	= maddrc_multi2_avx512,
+		.maddrc_fanout	= maddrc_fanout2_avx512,
+		.maddrc3	= maddrc3_2_avx512,
+		.mulrc_copy	= mulrc_copy2,
+		.mulrr		= mulrr2_avx512,
+		.maddrr		= maddrr2_avx512,
+		.invr		= invr2,
+		.divr		= mulrr2_avx512,
+		.maddrc_unaligned	= maddrc_unaligned2_avx512,
+		.mulrc_unaligned	= mulrc2,
+		.maddrc_prefetch	= maddrc_prefetch2_avx512,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512,
+	},
+#endif
+#if defined(__arm__) || defined(__aarch64__)
+	[MOEPGF2][MOEPGF_XOR_NEON_128] = {
+		.maddrc		= maddrc2_neon,
+		.mulrc		= mulrc2,
+		.maddrc_multi	= maddrc_multi2_neon,
+		.maddrc_fanout	= maddrc_fanout2_neon,
+		.maddrc3	= maddrc3_2_neon,
+		.mulrc_copy	= mulrc_copy2,
+		.mulrr		= mulrr2_neon,
+		.maddrr		= maddrr2_neon,
+		.invr		= invr2,
+		.divr		= mulrr2_neon,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NEON,
+	},
+#endif
+#ifdef __mips__
+	[MOEPGF2][MOEPGF_XOR_MSA] = {
+		.maddrc		= maddrc2_msa,
+		.mulrc		= mulrc2,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_MSA,
+	},
+#endif
+
+	[MOEPGF4][MOEPGF_FLAT_TABLE] = {
+		.maddrc		= maddrc4_flat_table,
+		.maddrc3	= maddrc3_4_flat_table,
+		.mulrr		= mulrr4_flat_table,
+		.maddrr		= maddrr4_flat_table,
+		.invr		= invr4_flat_table,
+		.divr		= divr4_flat_table,
+		.maddrc_unaligned	= maddrc4_flat_table,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NONE,
+	},
+	[MOEPGF4][MOEPGF_IMUL_GPR32] = {
+		.maddrc		= maddrc4_imul_gpr32,
+		.mulrc		= mulrc4_imul_gpr32,
+		.maddrc3	= maddrc3_4_imul_gpr32,
+		.mulrc_copy	= mulrc_copy4_imul_gpr32,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NONE,
+	},
+	[MOEPGF4][MOEPGF_IMUL_GPR64] = {
+		.maddrc		= maddrc4_imul_gpr64,
+		.mulrc		= mulrc4_imul_gpr64,
+		.maddrc_multi	= maddrc_multi4_imul_gpr64,
+		.maddrc_fanout	= maddrc_fanout4_imul_gpr64,
+		.maddrc3	= maddrc3_4_imul_gpr64,
+		.mulrc_copy	= mulrc_copy4_imul_gpr64,
+		.mulrr		= mulrr4_imul_gpr64,
+		.maddrr		= maddrr4_imul_gpr64,
+		.invr		= invr4_imul_gpr64,
+		.divr		= divr4_imul_gpr64,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NONE,
+	},
+#ifdef __x86_64__
+	[MOEPGF4][MOEPGF_IMUL_SSE2] = {
+		.maddrc		= maddrc4_imul_sse2,
+		.mulrc		= mulrc4_imul_sse2,
+		.maddrc_multi	= maddrc_multi4_imul_sse2,
+		.maddrc_fanout	= maddrc_fanout4_imul_sse2,
+		.maddrc3	= maddrc3_4_imul_sse2,
+		.mulrc_copy	= mulrc_copy4_imul_sse2,
+		.mulrr		= mulrr4_imul_sse2,
+		.maddrr		= maddrr4_imul_sse2,
+		.invr		= invr4_imul_sse2,
+		.divr		= divr4_imul_sse2,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_SSE2,
+	},
+	[MOEPGF4][MOEPGF_IMUL_AVX2] = {
+		.maddrc		= maddrc4_imul_avx2,
+		.mulrc		= mulrc4_imul_avx2,
+		.maddrc3	= maddrc3_4_imul_avx2,
+		.mulrc_copy	= mulrc_copy4_imul_avx2,
+		.mulrr		= mulrr4_imul_avx2,
+		.maddrr		= maddrr4_imul_avx2,
+		.invr		= invr4_imul_avx2,
+		.divr		= divr4_imul_avx2,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX2,
+	},
+	[MOEPGF4][MOEPGF_IMUL_AVX512] = {
+		.maddrc		= maddrc4_imul_avx512,
+		.mulrc		= mulrc4_imul_avx512,
+		.maddrc3	= maddrc3_4_imul_avx512,
+		.mulrc_copy	= mulrc_copy4_imul_avx512,
+		.mulrr		= mulrr4_imul_avx512,
+		.maddrr		= maddrr4_imul_avx512,
+		.invr		= invr4_imul_avx512,
+		.divr		= divr4_imul_avx512,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512,
+	},
+	[MOEPGF4][MOEPGF_SHUFFLE_SSSE3] = {
+		.maddrc		= maddrc4_shuffle_ssse3,
+		.mulrc		= mulrc4_shuffle_ssse3,
+		.maddrc_multi	= maddrc_multi4_shuffle_ssse3,
+		.maddrc_fanout	= maddrc_fanout4_shuffle_ssse3,
+		.maddrc3	= maddrc3_4_shuffle_ssse3,
+		.mulrc_copy	= mulrc_copy4_shuffle_ssse3,
+		.maddrc_unaligned	= maddrc_unaligned4_shuffle_ssse3,
+		.mulrc_unaligned	= mulrc_unaligned4_shuffle_ssse3,
+		.maddrc_prefetch	= maddrc_prefetch4_shuffle_ssse3,
+		.mulrc_prefetch	= mulrc_prefetch4_shuffle_ssse3,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_SSSE3,
+	},
+	[MOEPGF4][MOEPGF_SHUFFLE_AVX2] = {
+		.maddrc		= maddrc4_shuffle_avx2,
+		.mulrc		= mulrc4_shuffle_avx2,
+		.maddrc_multi	= maddrc_multi4_shuffle_avx2,
+		.maddrc_fanout	= maddrc_fanout4_shuffle_avx2,
+		.maddrc3	= maddrc3_4_shuffle_avx2,
+		.mulrc_copy	= mulrc_copy4_shuffle_avx2,
+		.maddrc_unaligned	= maddrc_unaligned4_shuffle_avx2,
+		.mulrc_unaligned	= mulrc_unaligned4_shuffle_avx2,
+		.mulrc_copy_nt	= mulrc_copy_nt4_shuffle_avx2,
+		.maddrc3_nt	= maddrc3_nt4_shuffle_avx2,
+		.maddrc_prefetch	= maddrc_prefetch4_shuffle_avx2,
+		.mulrc_prefetch	= mulrc_prefetch4_shuffle_avx2,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX2,
+	},
+	[MOEPGF4][MOEPGF_SHUFFLE_AVX512] = {
+		.maddrc		= maddrc4_shuffle_avx512,
+		.mulrc		= mulrc4_shuffle_avx512,
+		.maddrc_multi	= maddrc_multi4_shuffle_avx512,
+		.maddrc_fanout	= maddrc_fanout4_shuffle_avx512,
+		.maddrc3	= maddrc3_4_shuffle_avx512,
+		.mulrc_copy	= mulrc_copy4_shuffle_avx512,
+		.maddrc_unaligned	= maddrc_unaligned4_shuffle_avx512,
+		.mulrc_unaligned	= mulrc_unaligned4_shuffle_avx512,
+		.mulrc_copy_nt	= mulrc_copy_nt4_shuffle_avx512,
+		.maddrc3_nt	= maddrc3_nt4_shuffle_avx512,
+		.maddrc_prefetch	= maddrc_prefetch4_shuffle_avx512,
+		.mulrc_prefetch	= mulrc_prefetch4_shuffle_avx512,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512BW,
+	},
+	/*
+	 * The _x2 and _x4 algorithms equal the plain shuffle algorithms except
+	 * for maddrc and mulrc, which process two or four vectors per iteration
+	 * in independent dependency chains to hide the latency of the shuffles.
+	 */
+	[MOEPGF4][MOEPGF_SHUFFLE_SSSE3_X2] = {
+		.maddrc		= maddrc4_shuffle_ssse3_x2,
+		.mulrc		= mulrc4_shuffle_ssse3_x2,
+		.maddrc_multi	= maddrc_multi4_shuffle_ssse3,
+		.maddrc_fanout	= maddrc_fanout4_shuffle_ssse3,
+		.maddrc3	= maddrc3_4_shuffle_ssse3,
+		.mulrc_copy	= mulrc_copy4_shuffle_ssse3,
+		.maddrc_unaligned	= maddrc_unaligned4_shuffle_ssse3,
+		.mulrc_unaligned	= mulrc_unaligned4_shuffle_ssse3,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_SSSE3,
+	},
+	[MOEPGF4][MOEPGF_SHUFFLE_SSSE3_X4] = {
+		.maddrc		= maddrc4_shuffle_ssse3_x4,
+		.mulrc		= mulrc4_shuffle_ssse3_x4,
+		.maddrc_multi	= maddrc_multi4_shuffle_ssse3,
+		.maddrc_fanout	= maddrc_fanout4_shuffle_ssse3,
+		.maddrc3	= maddrc3_4_shuffle_ssse3,
+		.mulrc_copy	= mulrc_copy4_shuffle_ssse3,
+		.maddrc_unaligned	= maddrc_unaligned4_shuffle_ssse3,
+		.mulrc_unaligned	= mulrc_unaligned4_shuffle_ssse3,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_SSSE3,
+	},
+	[MOEPGF4][MOEPGF_SHUFFLE_AVX2_X2] = {
+		.maddrc		= maddrc4_shuffle_avx2_x2,
+		.mulrc		= mulrc4_shuffle_avx2_x2,
+		.maddrc_multi	= maddrc_multi4_shuffle_avx2,
+		.maddrc_fanout	= maddrc_fanout4_shuffle_avx2,
+		.maddrc3	= maddrc3_4_shuffle_avx2,
+		.mulrc_copy	= mulrc_copy4_shuffle_avx2,
+		.maddrc_unaligned	= maddrc_unaligned4_shuffle_avx2,
+		.mulrc_unaligned	= mulrc_unaligned4_shuffle_avx2,
+		.mulrc_copy_nt	= mulrc_copy_nt4_shuffle_avx2,
+		.maddrc3_nt	= maddrc3_nt4_shuffle_avx2,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX2,
+	},
+	[MOEPGF4][MOEPGF_SHUFFLE_AVX2_X4] = {
+		.maddrc		= maddrc4_shuffle_avx2_x4,
+		.mulrc		= mulrc4_shuffle_avx2_x4,
+		.maddrc_multi	= maddrc_multi4_shuffle_avx2,
+		.maddrc_fanout	= maddrc_fanout4_shuffle_avx2,
+		.maddrc3	= maddrc3_4_shuffle_avx2,
+		.mulrc_copy	= mulrc_copy4_shuffle_avx2,
+		.maddrc_unaligned	= maddrc_unaligned4_shuffle_avx2,
+		.mulrc_unaligned	= mulrc_unaligned4_shuffle_avx2,
+		.mulrc_copy_nt	= mulrc_copy_nt4_shuffle_avx2,
+		.maddrc3_nt	= maddrc3_nt4_shuffle_avx2,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX2,
+	},
+	[MOEPGF4][MOEPGF_SHUFFLE_AVX512_X2] = {
+		.maddrc		= maddrc4_shuffle_avx512_x2,
+		.mulrc		= mulrc4_shuffle_avx512_x2,
+		.maddrc_multi	= maddrc_multi4_shuffle_avx512,
+		.maddrc_fanout	= maddrc_fanout4_shuffle_avx512,
+		.maddrc3	= maddrc3_4_shuffle_avx512,
+		.mulrc_copy	= mulrc_copy4_shuffle_avx512,
+		.maddrc_unaligned	= maddrc_unaligned4_shuffle_avx512,
+		.mulrc_unaligned	= mulrc_unaligned4_shuffle_avx512,
+		.mulrc_copy_nt	= mulrc_copy_nt4_shuffle_avx512,
+		.maddrc3_nt	= maddrc3_nt4_shuffle_avx512,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512BW,
+	},
+	[MOEPGF4][MOEPGF_SHUFFLE_AVX512_X4] = {
+		.maddrc		= maddrc4_shuffle_avx512_x4,
+		.mulrc		= mulrc4_shuffle_avx512_x4,
+		.maddrc_multi	= maddrc_multi4_shuffle_avx512,
+		.maddrc_fanout	= maddrc_fanout4_shuffle_avx512,
+		.maddrc3	= maddrc3_4_shuffle_avx512,
+		.mulrc_copy	= mulrc_copy4_shuffle_avx512,
+		.maddrc_unaligned	= maddrc_unaligned4_shuffle_avx512,
+		.mulrc_unaligned	= mulrc_unaligned4_shuffle_avx512,
+		.mulrc_copy_nt	= mulrc_copy_nt4_shuffle_avx512,
+		.maddrc3_nt	= maddrc3_nt4_shuffle_avx512,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512BW,
+	},
+	[MOEPGF4][MOEPGF_SHUFFLE_AVX512VL] = {
+		.maddrc		= maddrc4_shuffle_avx512vl,
+		.mulrc		= mulrc4_shuffle_avx512vl,
+		.maddrc_multi	= maddrc_multi4_shuffle_avx512vl,
+		.maddrc_fanout	= maddrc_fanout4_shuffle_avx512vl,
+		.maddrc3	= maddrc3_4_shuffle_avx512vl,
+		.mulrc_copy	= mulrc_copy4_shuffle_avx512vl,
+		.maddrc_unaligned	= maddrc_unaligned4_shuffle_avx512vl,
+		.mulrc_unaligned	= mulrc_unaligned4_shuffle_avx512vl,
+		.mulrc_copy_nt	= mulrc_copy_nt4_shuffle_avx512vl,
+		.maddrc3_nt	= maddrc3_nt4_shuffle_avx512vl,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512VL,
+	},
+	[MOEPGF4][MOEPGF_GFNI_AFFINE128] = {
+		.maddrc		= maddrc4_gfni_affine128,
+		.mulrc		= mulrc4_gfni_affine128,
+		.maddrc_multi	= maddrc_multi4_gfni_affine128,
+		.maddrc_fanout	= maddrc_fanout4_gfni_affine128,
+		.maddrc3	= maddrc3_4_gfni_affine128,
+		.mulrc_copy	= mulrc_copy4_gfni_affine128,
+		.maddrc_unaligned	= maddrc_unaligned4_gfni_affine128,
+		.mulrc_unaligned	= mulrc_unaligned4_gfni_affine128,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_GFNI,
+	},
+	[MOEPGF4][MOEPGF_GFNI_AFFINE256] = {
+		.maddrc		= maddrc4_gfni_affine256,
+		.mulrc		= mulrc4_gfni_affine256,
+		.maddrc_multi	= maddrc_multi4_gfni_affine256,
+		.maddrc_fanout	= maddrc_fanout4_gfni_affine256,
+		.maddrc3	= maddrc3_4_gfni_affine256,
+		.mulrc_copy	= mulrc_copy4_gfni_affine256,
+		.maddrc_unaligned	= maddrc_unaligned4_gfni_affine256,
+		.mulrc_unaligned	= mulrc_unaligned4_gfni_affine256,
+		.mulrc_copy_nt	= mulrc_copy_nt4_gfni_affine256,
+		.maddrc3_nt	= maddrc3_nt4_gfni_affine256,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_GFNI,
+	},
+	[MOEPGF4][MOEPGF_GFNI_AFFINE512] = {
+		.maddrc		= maddrc4_gfni_affine512,
+		.mulrc		= mulrc4_gfni_affine512,
+		.maddrc_multi	= maddrc_multi4_gfni_affine512,
+		.maddrc_fanout	= maddrc_fanout4_gfni_affine512,
+		.maddrc3	= maddrc3_4_gfni_affine512,
+		.mulrc_copy	= mulrc_copy4_gfni_affine512,
+		.maddrc_unaligned	= maddrc_unaligned4_gfni_affine512,
+		.mulrc_unaligned	= mulrc_unaligned4_gfni_affine512,
+		.mulrc_copy_nt	= mulrc_copy_nt4_gfni_affine512,
+		.maddrc3_nt	= maddrc3_nt4_gfni_affine512,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512GFNI,
+	},
+	[MOEPGF4][MOEPGF_GFNI_AFFINE_AVX512VL] = {
+		.maddrc		= maddrc4_gfni_affine_avx512vl,
+		.mulrc		= mulrc4_gfni_affine_avx512vl,
+		.maddrc_multi	= maddrc_multi4_gfni_affine_avx512vl,
+		.maddrc_fanout	= maddrc_fanout4_gfni_affine_avx512vl,
+		.maddrc3	= maddrc3_4_gfni_affine_avx512vl,
+		.mulrc_copy	= mulrc_copy4_gfni_affine_avx512vl,
+		.maddrc_unaligned	= maddrc_unaligned4_gfni_affine_avx512vl,
+		.mulrc_unaligned	= mulrc_unaligned4_gfni_affine_avx512vl,
+		.mulrc_copy_nt	= mulrc_copy_nt4_gfni_affine_avx512vl,
+		.maddrc3_nt	= maddrc3_nt4_gfni_affine_avx512vl,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512GFNI,
+	},
+#endif
+#ifndef __arm__
+	[MOEPGF4][MOEPGF_SHUFFLE_VECTOR] = {
+		.maddrc		= maddrc4_shuffle_vector,
+		.mulrc		= mulrc4_shuffle_vector,
+		.maddrc_multi	= maddrc_multi4_shuffle_vector,
+		.maddrc_fanout	= maddrc_fanout4_shuffle_vector,
+		.maddrc3	= maddrc3_4_shuffle_vector,
+		.mulrc_copy	= mulrc_copy4_shuffle_vector,
+		.hwcaps		= VECTOR_HWCAPS,
+	},
+#endif
+#ifdef __arm__
+	[MOEPGF4][MOEPGF_IMUL_NEON_64] = {
+		.maddrc		= maddrc4_imul_neon_64,
+		.mulrc		= mulrc4_imul_neon_64,
+		.maddrc3	= maddrc3_4_imul_neon_64,
+		.mulrc_copy	= mulrc_copy4_imul_neon_64,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NEON,
+	},
+	[MOEPGF4][MOEPGF_IMUL_NEON_128] = {
+		.maddrc		= maddrc4_imul_neon_128,
+		.maddrc_multi	= maddrc_multi4_imul_neon_128,
+		.maddrc_fanout	= maddrc_fanout4_imul_neon_128,
+		.maddrc3	= maddrc3_4_imul_neon_128,
+		.mulrr		= mulrr4_imul_neon_128,
+		.maddrr		= maddrr4_imul_neon_128,
+		.invr		= invr4_imul_neon_128,
+		.divr		= divr4_imul_neon_128,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NEON,
+	},
+	[MOEPGF4][MOEPGF_SHUFFLE_NEON_64] = {
+		.maddrc		= maddrc4_shuffle_neon_64,
+		.maddrc3	= maddrc3_4_shuffle_neon_64,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NEON,
+	},
+#endif
+#ifdef __aarch64__
+	[MOEPGF4][MOEPGF_SHUFFLE_NEON_128] = {
+		.maddrc		= maddrc4_shuffle_neon_128,
+		.mulrc		= mulrc4_shuffle_neon_128,
+		.maddrc_multi	= maddrc_multi4_shuffle_neon_128,
+		.maddrc_fanout	= maddrc_fanout4_shuffle_neon_128,
+		.maddrc3	= maddrc3_4_shuffle_neon_128,
+		.mulrc_copy	= mulrc_copy4_shuffle_neon_128,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NEON,
+	},
+	[MOEPGF4][MOEPGF_SHUFFLE_NEON_SHA3] = {
+		.maddrc		= maddrc4_shuffle_neon_sha3,
+		.mulrc		= mulrc4_shuffle_neon_128,
+		.maddrc_multi	= maddrc_multi4_shuffle_neon_sha3,
+		.maddrc_fanout	= maddrc_fanout4_shuffle_neon_sha3,
+		.maddrc3	= maddrc3_4_shuffle_neon_sha3,
+		.mulrc_copy	= mulrc_copy4_shuffle_neon_128,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NEON_SHA3,
+	},
+#endif
+
+	[MOEPGF16][MOEPGF_FLAT_TABLE] = {
+		.maddrc		= maddrc16_flat_table,
+		.maddrc3	= maddrc3_16_flat_table,
+		.mulrr		= mulrr16_flat_table,
+		.maddrr		= maddrr16_flat_table,
+		.invr		= invr16_flat_table,
+		.divr		= divr16_flat_table,
+		.maddrc_unaligned	= maddrc16_flat_table,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NONE,
+	},
+	[MOEPGF16][MOEPGF_LOG_TABLE] = {
+		.maddrc		= maddrc16_log_table,
+		.maddrc3	= maddrc3_16_log_table,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NONE,
+	},
+	[MOEPGF16][MOEPGF_IMUL_GPR32] = {
+		.maddrc		= maddrc16_imul_gpr32,
+		.mulrc		= mulrc16_imul_gpr32,
+		.maddrc3	= maddrc3_16_imul_gpr32,
+		.mulrc_copy	= mulrc_copy16_imul_gpr32,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NONE,
+	},
+	[MOEPGF16][MOEPGF_IMUL_GPR64] = {
+		.maddrc		= maddrc16_imul_gpr64,
+		.mulrc		= mulrc16_imul_gpr64,
+		.maddrc_multi	= maddrc_multi16_imul_gpr64,
+		.maddrc_fanout	= maddrc_fanout16_imul_gpr64,
+		.maddrc3	= maddrc3_16_imul_gpr64,
+		.mulrc_copy	= mulrc_copy16_imul_gpr64,
+		.mulrr		= mulrr16_imul_gpr64,
+		.maddrr		= maddrr16_imul_gpr64,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NONE,
+	},
+#ifdef __x86_64__
+	[MOEPGF16][MOEPGF_IMUL_SSE2] = {
+		.maddrc		= maddrc16_imul_sse2,
+		.mulrc		= mulrc16_imul_sse2,
+		.maddrc_multi	= maddrc_multi16_imul_sse2,
+		.maddrc_fanout	= maddrc_fanout16_imul_sse2,
+		.maddrc3	= maddrc3_16_imul_sse2,
+		.mulrc_copy	= mulrc_copy16_imul_sse2,
+		.mulrr		= mulrr16_imul_sse2,
+		.maddrr		= maddrr16_imul_sse2,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_SSE2,
+	},
+	[MOEPGF16][MOEPGF_IMUL_AVX2] = {
+		.maddrc		= maddrc16_imul_avx2,
+		.maddrc3	= maddrc3_16_imul_avx2,
+		.mulrr		= mulrr16_imul_avx2,
+		.maddrr		= maddrr16_imul_avx2,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX2,
+	},
+	[MOEPGF16][MOEPGF_IMUL_AVX512] = {
+		.maddrc		= maddrc16_imul_avx512,
+		.mulrc		= mulrc16_imul_avx512,
+		.maddrc3	= maddrc3_16_imul_avx512,
+		.mulrc_copy	= mulrc_copy16_imul_avx512,
+		.mulrr		= mulrr16_imul_avx512,
+		.maddrr		= maddrr16_imul_avx512,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512,
+	},
+	[MOEPGF16][MOEPGF_SHUFFLE_SSSE3] = {
+		.maddrc		= maddrc16_shuffle_ssse3,
+		.mulrc		= mulrc16_shuffle_ssse3,
+		.maddrc_multi	= maddrc_multi16_shuffle_ssse3,
+		.maddrc_fanout	= maddrc_fanout16_shuffle_ssse3,
+		.maddrc3	= maddrc3_16_shuffle_ssse3,
+		.mulrc_copy	= mulrc_copy16_shuffle_ssse3,
+		.invr		= invr16_shuffle_ssse3,
+		.divr		= divr16_shuffle_ssse3,
+		.maddrc_unaligned	= maddrc_unaligned16_shuffle_ssse3,
+		.mulrc_unaligned	= mulrc_unaligned16_shuffle_ssse3,
+		.maddrc_prefetch	= maddrc_prefetch16_shuffle_ssse3,
+		.mulrc_prefetch	= mulrc_prefetch16_shuffle_ssse3,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_SSSE3,
+	},
+	[MOEPGF16][MOEPGF_SHUFFLE_AVX2] = {
+		.maddrc		= maddrc16_shuffle_avx2,
+		.mulrc		= mulrc16_shuffle_avx2,
+		.maddrc_multi	= maddrc_multi16_shuffle_avx2,
+		.maddrc_fanout	= maddrc_fanout16_shuffle_avx2,
+		.maddrc3	= maddrc3_16_shuffle_avx2,
+		.mulrc_copy	= mulrc_copy16_shuffle_avx2,
+		.invr		= invr16_shuffle_avx2,
+		.divr		= divr16_shuffle_avx2,
+		.maddrc_unaligned	= maddrc_unaligned16_shuffle_avx2,
+		.mulrc_unaligned	= mulrc_unaligned16_shuffle_avx2,
+		.mulrc_copy_nt	= mulrc_copy_nt16_shuffle_avx2,
+		.maddrc3_nt	= maddrc3_nt16_shuffle_avx2,
+		.maddrc_prefetch	= maddrc_prefetch16_shuffle_avx2,
+		.mulrc_prefetch	= mulrc_prefetch16_shuffle_avx2,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX2,
+	},
+	[MOEPGF16][MOEPGF_SHUFFLE_AVX512] = {
+		.maddrc		= maddrc16_shuffle_avx512,
+		.mulrc		= mulrc16_shuffle_avx512,
+		.maddrc_multi	= maddrc_multi16_shuffle_avx512,
+		.maddrc_fanout	= maddrc_fanout16_shuffle_avx512,
+		.maddrc3	= maddrc3_16_shuffle_avx512,
+		.mulrc_copy	= mulrc_copy16_shuffle_avx512,
+		.invr		= invr16_shuffle_avx512,
+		.divr		= divr16_shuffle_avx512,
+		.maddrc_unaligned	= maddrc_unaligned16_shuffle_avx512,
+		.mulrc_unaligned	= mulrc_unaligned16_shuffle_avx512,
+		.mulrc_copy_nt	= mulrc_copy_nt16_shuffle_avx512,
+		.maddrc3_nt	= maddrc3_nt16_shuffle_avx512,
+		.maddrc_prefetch	= maddrc_prefetch16_shuffle_avx512,
+		.mulrc_prefetch	= mulrc_prefetch16_shuffle_avx512,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512BW,
+	},
+	[MOEPGF16][MOEPGF_SHUFFLE_SSSE3_X2] = {
+		.maddrc		= maddrc16_shuffle_ssse3_x2,
+		.mulrc		= mulrc16_shuffle_ssse3_x2,
+		.maddrc_multi	= maddrc_multi16_shuffle_ssse3,
+		.maddrc_fanout	= maddrc_fanout16_shuffle_ssse3,
+		.maddrc3	= maddrc3_16_shuffle_ssse3,
+		.mulrc_copy	= mulrc_copy16_shuffle_ssse3,
+		.invr		= invr16_shuffle_ssse3,
+		.divr		= divr16_shuffle_ssse3,
+		.maddrc_unaligned	= maddrc_unaligned16_shuffle_ssse3,
+		.mulrc_unaligned	= mulrc_unaligned16_shuffle_ssse3,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_SSSE3,
+	},
+	[MOEPGF16][MOEPGF_SHUFFLE_SSSE3_X4] = {
+		.maddrc		= maddrc16_shuffle_ssse3_x4,
+		.mulrc		= mulrc16_shuffle_ssse3_x4,
+		.maddrc_multi	= maddrc_multi16_shuffle_ssse3,
+		.maddrc_fanout	= maddrc_fanout16_shuffle_ssse3,
+		.maddrc3	= maddrc3_16_shuffle_ssse3,
+		.mulrc_copy	= mulrc_copy16_shuffle_ssse3,
+		.invr		= invr16_shuffle_ssse3,
+		.divr		= divr16_shuffle_ssse3,
+		.maddrc_unaligned	= maddrc_unaligned16_shuffle_ssse3,
+		.mulrc_unaligned	= mulrc_unaligned16_shuffle_ssse3,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_SSSE3,
+	},
+	[MOEPGF16][MOEPGF_SHUFFLE_AVX2_X2] = {
+		.maddrc		= maddrc16_shuffle_avx2_x2,
+		.mulrc		= mulrc16_shuffle_avx2_x2,
+		.maddrc_multi	= maddrc_multi16_shuffle_avx2,
+		.maddrc_fanout	= maddrc_fanout16_shuffle_avx2,
+		.maddrc3	= maddrc3_16_shuffle_avx2,
+		.mulrc_copy	= mulrc_copy16_shuffle_avx2,
+		.invr		= invr16_shuffle_avx2,
+		.divr		= divr16_shuffle_avx2,
+		.maddrc_unaligned	= maddrc_unaligned16_shuffle_avx2,
+		.mulrc_unaligned	= mulrc_unaligned16_shuffle_avx2,
+		.mulrc_copy_nt	= mulrc_copy_nt16_shuffle_avx2,
+		.maddrc3_nt	= maddrc3_nt16_shuffle_avx2,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX2,
+	},
+	[MOEPGF16][MOEPGF_SHUFFLE_AVX2_X4] = {
+		.maddrc		= maddrc16_shuffle_avx2_x4,
+		.mulrc		= mulrc16_shuffle_avx2_x4,
+		.maddrc_multi	= maddrc_multi16_shuffle_avx2,
+		.maddrc_fanout	= maddrc_fanout16_shuffle_avx2,
+		.maddrc3	= maddrc3_16_shuffle_avx2,
+		.mulrc_copy	= mulrc_copy16_shuffle_avx2,
+		.invr		= invr16_shuffle_avx2,
+		.divr		= divr16_shuffle_avx2,
+		.maddrc_unaligned	= maddrc_unaligned16_shuffle_avx2,
+		.mulrc_unaligned	= mulrc_unaligned16_shuffle_avx2,
+		.mulrc_copy_nt	= mulrc_copy_nt16_shuffle_avx2,
+		.maddrc3_nt	= maddrc3_nt16_shuffle_avx2,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX2,
+	},
+	[MOEPGF16][MOEPGF_SHUFFLE_AVX512_X2] = {
+		.maddrc		= maddrc16_shuffle_avx512_x2,
+		.mulrc		= mulrc16_shuffle_avx512_x2,
+		.maddrc_multi	= maddrc_multi16_shuffle_avx512,
+		.maddrc_fanout	= maddrc_fanout16_shuffle_avx512,
+		.maddrc3	= maddrc3_16_shuffle_avx512,
+		.mulrc_copy	= mulrc_copy16_shuffle_avx512,
+		.invr		= invr16_shuffle_avx512,
+		.divr		= divr16_shuffle_avx512,
+		.maddrc_unaligned	= maddrc_unaligned16_shuffle_avx512,
+		.mulrc_unaligned	= mulrc_unaligned16_shuffle_avx512,
+		.mulrc_copy_nt	= mulrc_copy_nt16_shuffle_avx512,
+		.maddrc3_nt	= maddrc3_nt16_shuffle_avx512,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512BW,
+	},
+	[MOEPGF16][MOEPGF_SHUFFLE_AVX512_X4] = {
+		.maddrc		= maddrc16_shuffle_avx512_x4,
+		.mulrc		= mulrc16_shuffle_avx512_x4,
+		.maddrc_multi	= maddrc_multi16_shuffle_avx512,
+		.maddrc_fanout	= maddrc_fanout16_shuffle_avx512,
+		.maddrc3	= maddrc3_16_shuffle_avx512,
+		.mulrc_copy	= mulrc_copy16_shuffle_avx512,
+		.invr		= invr16_shuffle_avx512,
+		.divr		= divr16_shuffle_avx512,
+		.maddrc_unaligned	= maddrc_unaligned16_shuffle_avx512,
+		.mulrc_unaligned	= mulrc_unaligned16_shuffle_avx512,
+		.mulrc_copy_nt	= mulrc_copy_nt16_shuffle_avx512,
+		.maddrc3_nt	= maddrc3_nt16_shuffle_avx512,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512BW,
+	},
+	[MOEPGF16][MOEPGF_SHUFFLE_AVX512VL] = {
+		.maddrc		= maddrc16_shuffle_avx512vl,
+		.mulrc		= mulrc16_shuffle_avx512vl,
+		.maddrc_multi	= maddrc_multi16_shuffle_avx512vl,
+		.maddrc_fanout	= maddrc_fanout16_shuffle_avx512vl,
+		.maddrc3	= maddrc3_16_shuffle_avx512vl,
+		.mulrc_copy	= mulrc_copy16_shuffle_avx512vl,
+		.maddrc_unaligned	= maddrc_unaligned16_shuffle_avx512vl,
+		.mulrc_unaligned	= mulrc_unaligned16_shuffle_avx512vl,
+		.mulrc_copy_nt	= mulrc_copy_nt16_shuffle_avx512vl,
+		.maddrc3_nt	= maddrc3_nt16_shuffle_avx512vl,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512VL,
+	},
+	[MOEPGF16][MOEPGF_GFNI_AFFINE128] = {
+		.maddrc		= maddrc16_gfni_affine128,
+		.mulrc		= mulrc16_gfni_affine128,
+		.maddrc_multi	= maddrc_multi16_gfni_affine128,
+		.maddrc_fanout	= maddrc_fanout16_gfni_affine128,
+		.maddrc3	= maddrc3_16_gfni_affine128,
+		.mulrc_copy	= mulrc_copy16_gfni_affine128,
+		.maddrc_unaligned	= maddrc_unaligned16_gfni_affine128,
+		.mulrc_unaligned	= mulrc_unaligned16_gfni_affine128,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_GFNI,
+	},
+	[MOEPGF16][MOEPGF_GFNI_AFFINE256] = {
+		.maddrc		= maddrc16_gfni_affine256,
+		.mulrc		= mulrc16_gfni_affine256,
+		.maddrc_multi	= maddrc_multi16_gfni_affine256,
+		.maddrc_fanout	= maddrc_fanout16_gfni_affine256,
+		.maddrc3	= maddrc3_16_gfni_affine256,
+		.mulrc_copy	= mulrc_copy16_gfni_affine256,
+		.maddrc_unaligned	= maddrc_unaligned16_gfni_affine256,
+		.mulrc_unaligned	= mulrc_unaligned16_gfni_affine256,
+		.mulrc_copy_nt	= mulrc_copy_nt16_gfni_affine256,
+		.maddrc3_nt	= maddrc3_nt16_gfni_affine256,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_GFNI,
+	},
+	[MOEPGF16][MOEPGF_GFNI_AFFINE512] = {
+		.maddrc		= maddrc16_gfni_affine512,
+		.mulrc		= mulrc16_gfni_affine512,
+		.maddrc_multi	= maddrc_multi16_gfni_affine512,
+		.maddrc_fanout	= maddrc_fanout16_gfni_affine512,
+		.maddrc3	= maddrc3_16_gfni_affine512,
+		.mulrc_copy	= mulrc_copy16_gfni_affine512,
+		.maddrc_unaligned	= maddrc_unaligned16_gfni_affine512,
+		.mulrc_unaligned	= mulrc_unaligned16_gfni_affine512,
+		.mulrc_copy_nt	= mulrc_copy_nt16_gfni_affine512,
+		.maddrc3_nt	= maddrc3_nt16_gfni_affine512,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512GFNI,
+	},
+	[MOEPGF16][MOEPGF_GFNI_AFFINE_AVX512VL] = {
+		.maddrc		= maddrc16_gfni_affine_avx512vl,
+		.mulrc		= mulrc16_gfni_affine_avx512vl,
+		.maddrc_multi	= maddrc_multi16_gfni_affine_avx512vl,
+		.maddrc_fanout	= maddrc_fanout16_gfni_affine_avx512vl,
+		.maddrc3	= maddrc3_16_gfni_affine_avx512vl,
+		.mulrc_copy	= mulrc_copy16_gfni_affine_avx512vl,
+		.maddrc_unaligned	= maddrc_unaligned16_gfni_affine_avx512vl,
+		.mulrc_unaligned	= mulrc_unaligned16_gfni_affine_avx512vl,
+		.mulrc_copy_nt	= mulrc_copy_nt16_gfni_affine_avx512vl,
+		.maddrc3_nt	= maddrc3_nt16_gfni_affine_avx512vl,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512GFNI,
+	},
+	[MOEPGF16][MOEPGF_LOOKUP_AVX512VBMI] = {
+		.maddrc		= maddrc16_lookup_avx512vbmi,
+		.mulrc		= mulrc16_lookup_avx512vbmi,
+		.maddrc_multi	= maddrc_multi16_lookup_avx512vbmi,
+		.maddrc3	= maddrc3_16_lookup_avx512vbmi,
+		.mulrc_copy	= mulrc_copy16_lookup_avx512vbmi,
+		.maddrc_unaligned	= maddrc_unaligned16_lookup_avx512vbmi,
+		.mulrc_unaligned	= mulrc_unaligned16_lookup_avx512vbmi,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512VBMI,
+	},
+#endif
+#ifndef __arm__
+	[MOEPGF16][MOEPGF_SHUFFLE_VECTOR] = {
+		.maddrc		= maddrc16_shuffle_vector,
+		.mulrc		= mulrc16_shuffle_vector,
+		.maddrc_multi	= maddrc_multi16_shuffle_vector,
+		.maddrc_fanout	= maddrc_fanout16_shuffle_vector,
+		.maddrc3	= maddrc3_16_shuffle_vector,
+		.mulrc_copy	= mulrc_copy16_shuffle_vector,
+		.hwcaps		= VECTOR_HWCAPS,
+	},
+#endif
+#ifdef __arm__
+	[MOEPGF16][MOEPGF_IMUL_NEON_64] = {
+		.maddrc		= maddrc16_imul_neon_64,
+		.maddrc3	= maddrc3_16_imul_neon_64,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NEON,
+	},
+	[MOEPGF16][MOEPGF_IMUL_NEON_128] = {
+		.maddrc		= maddrc16_imul_neon_128,
+		.maddrc3	= maddrc3_16_imul_neon_128,
+		.mulrr		= mulrr16_imul_neon_128,
+		.maddrr		= maddrr16_imul_neon_128,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NEON,
+	},
+	[MOEPGF16][MOEPGF_SHUFFLE_NEON_64] = {
+		.maddrc		= maddrc16_shuffle_neon_64,
+		.mulrc		= mulrc16_shuffle_neon_64,
+		.maddrc_multi	= maddrc_multi16_shuffle_neon_64,
+		.maddrc_fanout	= maddrc_fanout16_shuffle_neon_64,
+		.maddrc3	= maddrc3_16_shuffle_neon_64,
+		.mulrc_copy	= mulrc_copy16_shuffle_neon_64,
+		.invr		= invr16_shuffle_neon_64,
+		.divr		= divr16_shuffle_neon_64,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NEON,
+	},
+#endif
+#ifdef __aarch64__
+	[MOEPGF16][MOEPGF_SHUFFLE_NEON_128] = {
+		.maddrc		= maddrc16_shuffle_neon_128,
+		.mulrc		= mulrc16_shuffle_neon_128,
+		.maddrc_multi	= maddrc_multi16_shuffle_neon_128,
+		.maddrc_fanout	= maddrc_fanout16_shuffle_neon_128,
+		.maddrc3	= maddrc3_16_shuffle_neon_128,
+		.mulrc_copy	= mulrc_copy16_shuffle_neon_128,
+		.invr		= invr16_shuffle_neon_128,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NEON,
+	},
+	[MOEPGF16][MOEPGF_SHUFFLE_NEON_SHA3] = {
+		.maddrc		= maddrc16_shuffle_neon_sha3,
+		.mulrc		= mulrc16_shuffle_neon_128,
+		.maddrc_multi	= maddrc_multi16_shuffle_neon_sha3,
+		.maddrc_fanout	= maddrc_fanout16_shuffle_neon_sha3,
+		.maddrc3	= maddrc3_16_shuffle_neon_sha3,
+		.mulrc_copy	= mulrc_copy16_shuffle_neon_128,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NEON_SHA3,
+	},
+#endif
+
+	[MOEPGF256][MOEPGF_FLAT_TABLE] = {
+		.maddrc		= maddrc256_flat_table,
+		.maddrc3	= maddrc3_256_flat_table,
+		.mulrr		= mulrr256_flat_table,
+		.maddrr		= maddrr256_flat_table,
+		.invr		= invr256_flat_table,
+		.divr		= divr256_flat_table,
+		.maddrc_unaligned	= maddrc256_flat_table,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NONE,
+	},
+	[MOEPGF256][MOEPGF_LOG_TABLE] = {
+		.maddrc		= maddrc256_log_table,
+		.maddrc3	= maddrc3_256_log_table,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NONE,
+	},
+	[MOEPGF256][MOEPGF_IMUL_GPR32] = {
+		.maddrc		= maddrc256_imul_gpr32,
+		.mulrc		= mulrc256_imul_gpr32,
+		.maddrc3	= maddrc3_256_imul_gpr32,
+		.mulrc_copy	= mulrc_copy256_imul_gpr32,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NONE,
+	},
+	[MOEPGF256][MOEPGF_IMUL_GPR64] = {
+		.maddrc		= maddrc256_imul_gpr64,
+		.mulrc		= mulrc256_imul_gpr64,
+		.maddrc_multi	= maddrc_multi256_imul_gpr64,
+		.maddrc_fanout	= maddrc_fanout256_imul_gpr64,
+		.maddrc3	= maddrc3_256_imul_gpr64,
+		.mulrc_copy	= mulrc_copy256_imul_gpr64,
+		.mulrr		= mulrr256_imul_gpr64,
+		.maddrr		= maddrr256_imul_gpr64,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NONE,
+	},
+#ifdef __x86_64__
+	[MOEPGF256][MOEPGF_IMUL_SSE2] = {
+		.maddrc		= maddrc256_imul_sse2,
+		.mulrc		= mulrc256_imul_sse2,
+		.maddrc_multi	= maddrc_multi256_imul_sse2,
+		.maddrc_fanout	= maddrc_fanout256_imul_sse2,
+		.maddrc3	= maddrc3_256_imul_sse2,
+		.mulrc_copy	= mulrc_copy256_imul_sse2,
+		.mulrr		= mulrr256_imul_sse2,
+		.maddrr		= maddrr256_imul_sse2,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_SSE2,
+	},
+	[MOEPGF256][MOEPGF_IMUL_AVX2] = {
+		.maddrc		= maddrc256_imul_avx2,
+		.maddrc3	= maddrc3_256_imul_avx2,
+		.mulrr		= mulrr256_imul_avx2,
+		.maddrr		= maddrr256_imul_avx2,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX2,
+	},
+	[MOEPGF256][MOEPGF_IMUL_AVX512] = {
+		.maddrc		= maddrc256_imul_avx512,
+		.mulrc		= mulrc256_imul_avx512,
+		.maddrc3	= maddrc3_256_imul_avx512,
+		.mulrc_copy	= mulrc_copy256_imul_avx512,
+		.mulrr		= mulrr256_imul_avx512,
+		.maddrr		= maddrr256_imul_avx512,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512,
+	},
+	[MOEPGF256][MOEPGF_SHUFFLE_SSSE3] = {
+		.maddrc		= maddrc256_shuffle_ssse3,
+		.mulrc		= mulrc256_shuffle_ssse3,
+		.maddrc_multi	= maddrc_multi256_shuffle_ssse3,
+		.maddrc_fanout	= maddrc_fanout256_shuffle_ssse3,
+		.maddrc3	= maddrc3_256_shuffle_ssse3,
+		.mulrc_copy	= mulrc_copy256_shuffle_ssse3,
+		.invr		= invr256_shuffle_ssse3,
+		.divr		= divr256_shuffle_ssse3,
+		.maddrc_unaligned	= maddrc_unaligned256_shuffle_ssse3,
+		.mulrc_unaligned	= mulrc_unaligned256_shuffle_ssse3,
+		.maddrc_prefetch	= maddrc_prefetch256_shuffle_ssse3,
+		.mulrc_prefetch	= mulrc_prefetch256_shuffle_ssse3,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_SSSE3,
+	},
+	[MOEPGF256][MOEPGF_SHUFFLE_AVX2] = {
+		.maddrc		= maddrc256_shuffle_avx2,
+		.mulrc		= mulrc256_shuffle_avx2,
+		.maddrc_multi	= maddrc_multi256_shuffle_avx2,
+		.maddrc_fanout	= maddrc_fanout256_shuffle_avx2,
+		.maddrc3	= maddrc3_256_shuffle_avx2,
+		.mulrc_copy	= mulrc_copy256_shuffle_avx2,
+		.invr		= invr256_shuffle_avx2,
+		.divr		= divr256_shuffle_avx2,
+		.maddrc_unaligned	= maddrc_unaligned256_shuffle_avx2,
+		.mulrc_unaligned	= mulrc_unaligned256_shuffle_avx2,
+		.mulrc_copy_nt	= mulrc_copy_nt256_shuffle_avx2,
+		.maddrc3_nt	= maddrc3_nt256_shuffle_avx2,
+		.maddrc_prefetch	= maddrc_prefetch256_shuffle_avx2,
+		.mulrc_prefetch	= mulrc_prefetch256_shuffle_avx2,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX2,
+	},
+	[MOEPGF256][MOEPGF_SHUFFLE_AVX512] = {
+		.maddrc		= maddrc256_shuffle_avx512,
+		.mulrc		= mulrc256_shuffle_avx512,
+		.maddrc_multi	= maddrc_multi256_shuffle_avx512,
+		.maddrc_fanout	= maddrc_fanout256_shuffle_avx512,
+		.maddrc3	= maddrc3_256_shuffle_avx512,
+		.mulrc_copy	= mulrc_copy256_shuffle_avx512,
+		.invr		= invr256_shuffle_avx512,
+		.divr		= divr256_shuffle_avx512,
+		.maddrc_unaligned	= maddrc_unaligned256_shuffle_avx512,
+		.mulrc_unaligned	= mulrc_unaligned256_shuffle_avx512,
+		.mulrc_copy_nt	= mulrc_copy_nt256_shuffle_avx512,
+		.maddrc3_nt	= maddrc3_nt256_shuffle_avx512,
+		.maddrc_prefetch	= maddrc_prefetch256_shuffle_avx512,
+		.mulrc_prefetch	= mulrc_prefetch256_shuffle_avx512,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512BW,
+	},
+	[MOEPGF256][MOEPGF_SHUFFLE_SSSE3_X2] = {
+		.maddrc		= maddrc256_shuffle_ssse3_x2,
+		.mulrc		= mulrc256_shuffle_ssse3_x2,
+		.maddrc_multi	= maddrc_multi256_shuffle_ssse3,
+		.maddrc_fanout	= maddrc_fanout256_shuffle_ssse3,
+		.maddrc3	= maddrc3_256_shuffle_ssse3,
+		.mulrc_copy	= mulrc_copy256_shuffle_ssse3,
+		.invr		= invr256_shuffle_ssse3,
+		.divr		= divr256_shuffle_ssse3,
+		.maddrc_unaligned	= maddrc_unaligned256_shuffle_ssse3,
+		.mulrc_unaligned	= mulrc_unaligned256_shuffle_ssse3,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_SSSE3,
+	},
+	[MOEPGF256][MOEPGF_SHUFFLE_SSSE3_X4] = {
+		.maddrc		= maddrc256_shuffle_ssse3_x4,
+		.mulrc		= mulrc256_shuffle_ssse3_x4,
+		.maddrc_multi	= maddrc_multi256_shuffle_ssse3,
+		.maddrc_fanout	= maddrc_fanout256_shuffle_ssse3,
+		.maddrc3	= maddrc3_256_shuffle_ssse3,
+		.mulrc_copy	= mulrc_copy256_shuffle_ssse3,
+		.invr		= invr256_shuffle_ssse3,
+		.divr		= divr256_shuffle_ssse3,
+		.maddrc_unaligned	= maddrc_unaligned256_shuffle_ssse3,
+		.mulrc_unaligned	= mulrc_unaligned256_shuffle_ssse3,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_SSSE3,
+	},
+	[MOEPGF256][MOEPGF_SHUFFLE_AVX2_X2] = {
+		.maddrc		= maddrc256_shuffle_avx2_x2,
+		.mulrc		= mulrc256_shuffle_avx2_x2,
+		.maddrc_multi	= maddrc_multi256_shuffle_avx2,
+		.maddrc_fanout	= maddrc_fanout256_shuffle_avx2,
+		.maddrc3	= maddrc3_256_shuffle_avx2,
+		.mulrc_copy	= mulrc_copy256_shuffle_avx2,
+		.invr		= invr256_shuffle_avx2,
+		.divr		= divr256_shuffle_avx2,
+		.maddrc_unaligned	= maddrc_unaligned256_shuffle_avx2,
+		.mulrc_unaligned	= mulrc_unaligned256_shuffle_avx2,
+		.mulrc_copy_nt	= mulrc_copy_nt256_shuffle_avx2,
+		.maddrc3_nt	= maddrc3_nt256_shuffle_avx2,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX2,
+	},
+	[MOEPGF256][MOEPGF_SHUFFLE_AVX2_X4] = {
+		.maddrc		= maddrc256_shuffle_avx2_x4,
+		.mulrc		= mulrc256_shuffle_avx2_x4,
+		.maddrc_multi	= maddrc_multi256_shuffle_avx2,
+		.maddrc_fanout	= maddrc_fanout256_shuffle_avx2,
+		.maddrc3	= maddrc3_256_shuffle_avx2,
+		.mulrc_copy	= mulrc_copy256_shuffle_avx2,
+		.invr		= invr256_shuffle_avx2,
+		.divr		= divr256_shuffle_avx2,
+		.maddrc_unaligned	= maddrc_unaligned256_shuffle_avx2,
+		.mulrc_unaligned	= mulrc_unaligned256_shuffle_avx2,
+		.mulrc_copy_nt	= mulrc_copy_nt256_shuffle_avx2,
+		.maddrc3_nt	= maddrc3_nt256_shuffle_avx2,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX2,
+	},
+	[MOEPGF256][MOEPGF_SHUFFLE_AVX512_X2] = {
+		.maddrc		= maddrc256_shuffle_avx512_x2,
+		.mulrc		= mulrc256_shuffle_avx512_x2,
+		.maddrc_multi	= maddrc_multi256_shuffle_avx512,
+		.maddrc_fanout	= maddrc_fanout256_shuffle_avx512,
+		.maddrc3	= maddrc3_256_shuffle_avx512,
+		.mulrc_copy	= mulrc_copy256_shuffle_avx512,
+		.invr		= invr256_shuffle_avx512,
+		.divr		= divr256_shuffle_avx512,
+		.maddrc_unaligned	= maddrc_unaligned256_shuffle_avx512,
+		.mulrc_unaligned	= mulrc_unaligned256_shuffle_avx512,
+		.mulrc_copy_nt	= mulrc_copy_nt256_shuffle_avx512,
+		.maddrc3_nt	= maddrc3_nt256_shuffle_avx512,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512BW,
+	},
+	[MOEPGF256][MOEPGF_SHUFFLE_AVX512_X4] = {
+		.maddrc		= maddrc256_shuffle_avx512_x4,
+		.mulrc		= mulrc256_shuffle_avx512_x4,
+		.maddrc_multi	= maddrc_multi256_shuffle_avx512,
+		.maddrc_fanout	= maddrc_fanout256_shuffle_avx512,
+		.maddrc3	= maddrc3_256_shuffle_avx512,
+		.mulrc_copy	= mulrc_copy256_shuffle_avx512,
+		.invr		= invr256_shuffle_avx512,
+		.divr		= divr256_shuffle_avx512,
+		.maddrc_unaligned	= maddrc_unaligned256_shuffle_avx512,
+		.mulrc_unaligned	= mulrc_unaligned256_shuffle_avx512,
+		.mulrc_copy_nt	= mulrc_copy_nt256_shuffle_avx512,
+		.maddrc3_nt	= maddrc3_nt256_shuffle_avx512,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512BW,
+	},
+	[MOEPGF256][MOEPGF_SHUFFLE_AVX512VL] = {
+		.maddrc		= maddrc256_shuffle_avx512vl,
+		.mulrc		= mulrc256_shuffle_avx512vl,
+		.maddrc_multi	= maddrc_multi256_shuffle_avx512vl,
+		.maddrc_fanout	= maddrc_fanout256_shuffle_avx512vl,
+		.maddrc3	= maddrc3_256_shuffle_avx512vl,
+		.mulrc_copy	= mulrc_copy256_shuffle_avx512vl,
+		.maddrc_unaligned	= maddrc_unaligned256_shuffle_avx512vl,
+		.mulrc_unaligned	= mulrc_unaligned256_shuffle_avx512vl,
+		.mulrc_copy_nt	= mulrc_copy_nt256_shuffle_avx512vl,
+		.maddrc3_nt	= maddrc3_nt256_shuffle_avx512vl,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512VL,
+	},
+#if MOEPGF256_POLYNOMIAL == 283
+	[MOEPGF256][MOEPGF_GFNI128] = {
+		.maddrc		= maddrc256_gfni128,
+		.mulrc		= mulrc256_gfni128,
+		.maddrc_multi	= maddrc_multi256_gfni128,
+		.maddrc_fanout	= maddrc_fanout256_gfni128,
+		.maddrc3	= maddrc3_256_gfni128,
+		.mulrc_copy	= mulrc_copy256_gfni128,
+		.mulrr		= mulrr256_gfni128,
+		.maddrr		= maddrr256_gfni128,
+		.invr		= invr256_gfni128,
+		.divr		= divr256_gfni128,
+		.maddrc_unaligned	= maddrc_unaligned256_gfni128,
+		.mulrc_unaligned	= mulrc_unaligned256_gfni128,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_GFNI,
+	},
+	[MOEPGF256][MOEPGF_GFNI256] = {
+		.maddrc		= maddrc256_gfni256,
+		.mulrc		= mulrc256_gfni256,
+		.maddrc_multi	= maddrc_multi256_gfni256,
+		.maddrc_fanout	= maddrc_fanout256_gfni256,
+		.maddrc3	= maddrc3_256_gfni256,
+		.mulrc_copy	= mulrc_copy256_gfni256,
+		.mulrr		= mulrr256_gfni256,
+		.maddrr		= maddrr256_gfni256,
+		.invr		= invr256_gfni256,
+		.divr		= divr256_gfni256,
+		.maddrc_unaligned	= maddrc_unaligned256_gfni256,
+		.mulrc_unaligned	= mulrc_unaligned256_gfni256,
+		.mulrc_copy_nt	= mulrc_copy_nt256_gfni256,
+		.maddrc3_nt	= maddrc3_nt256_gfni256,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_GFNI,
+	},
+	[MOEPGF256][MOEPGF_GFNI512] = {
+		.maddrc		= maddrc256_gfni512,
+		.mulrc		= mulrc256_gfni512,
+		.maddrc_multi	= maddrc_multi256_gfni512,
+		.maddrc_fanout	= maddrc_fanout256_gfni512,
+		.maddrc3	= maddrc3_256_gfni512,
+		.mulrc_copy	= mulrc_copy256_gfni512,
+		.mulrr		= mulrr256_gfni512,
+		.maddrr		= maddrr256_gfni512,
+		.invr		= invr256_gfni512,
+		.divr		= divr256_gfni512,
+		.maddrc_unaligned	= maddrc_unaligned256_gfni512,
+		.mulrc_unaligned	= mulrc_unaligned256_gfni512,
+		.mulrc_copy_nt	= mulrc_copy_nt256_gfni512,
+		.maddrc3_nt	= maddrc3_nt256_gfni512,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512GFNI,
+	},
+#endif
+	[MOEPGF256][MOEPGF_GFNI_AFFINE128] = {
+		.maddrc		= maddrc256_gfni_affine128,
+		.mulrc		= mulrc256_gfni_affine128,
+		.maddrc_multi	= maddrc_multi256_gfni_affine128,
+		.maddrc_fanout	= maddrc_fanout256_gfni_affine128,
+		.maddrc3	= maddrc3_256_gfni_affine128,
+		.mulrc_copy	= mulrc_copy256_gfni_affine128,
+		.maddrc_unaligned	= maddrc_unaligned256_gfni_affine128,
+		.mulrc_unaligned	= mulrc_unaligned256_gfni_affine128,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_GFNI,
+	},
+	[MOEPGF256][MOEPGF_GFNI_AFFINE256] = {
+		.maddrc		= maddrc256_gfni_affine256,
+		.mulrc		= mulrc256_gfni_affine256,
+		.maddrc_multi	= maddrc_multi256_gfni_affine256,
+		.maddrc_fanout	= maddrc_fanout256_gfni_affine256,
+		.maddrc3	= maddrc3_256_gfni_affine256,
+		.mulrc_copy	= mulrc_copy256_gfni_affine256,
+		.maddrc_unaligned	= maddrc_unaligned256_gfni_affine256,
+		.mulrc_unaligned	= mulrc_unaligned256_gfni_affine256,
+		.mulrc_copy_nt	= mulrc_copy_nt256_gfni_affine256,
+		.maddrc3_nt	= maddrc3_nt256_gfni_affine256,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_GFNI,
+	},
+	[MOEPGF256][MOEPGF_GFNI_AFFINE512] = {
+		.maddrc		= maddrc256_gfni_affine512,
+		.mulrc		= mulrc256_gfni_affine512,
+		.maddrc_multi	= maddrc_multi256_gfni_affine512,
+		.maddrc_fanout	= maddrc_fanout256_gfni_affine512,
+		.maddrc3	= maddrc3_256_gfni_affine512,
+		.mulrc_copy	= mulrc_copy256_gfni_affine512,
+		.maddrc_unaligned	= maddrc_unaligned256_gfni_affine512,
+		.mulrc_unaligned	= mulrc_unaligned256_gfni_affine512,
+		.mulrc_copy_nt	= mulrc_copy_nt256_gfni_affine512,
+		.maddrc3_nt	= maddrc3_nt256_gfni_affine512,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512GFNI,
+	},
+	[MOEPGF256][MOEPGF_GFNI_AFFINE_AVX512VL] = {
+		.maddrc		= maddrc256_gfni_affine_avx512vl,
+		.mulrc		= mulrc256_gfni_affine_avx512vl,
+		.maddrc_multi	= maddrc_multi256_gfni_affine_avx512vl,
+		.maddrc_fanout	= maddrc_fanout256_gfni_affine_avx512vl,
+		.maddrc3	= maddrc3_256_gfni_affine_avx512vl,
+		.mulrc_copy	= mulrc_copy256_gfni_affine_avx512vl,
+		.maddrc_unaligned	= maddrc_unaligned256_gfni_affine_avx512vl,
+		.mulrc_unaligned	= mulrc_unaligned256_gfni_affine_avx512vl,
+		.mulrc_copy_nt	= mulrc_copy_nt256_gfni_affine_avx512vl,
+		.maddrc3_nt	= maddrc3_nt256_gfni_affine_avx512vl,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512GFNI,
+	},
+	[MOEPGF256][MOEPGF_LOOKUP_AVX512VBMI] = {
+		.maddrc		= maddrc256_lookup_avx512vbmi,
+		.mulrc		= mulrc256_lookup_avx512vbmi,
+		.maddrc_multi	= maddrc_multi256_lookup_avx512vbmi,
+		.maddrc3	= maddrc3_256_lookup_avx512vbmi,
+		.mulrc_copy	= mulrc_copy256_lookup_avx512vbmi,
+		.maddrc_unaligned	= maddrc_unaligned256_lookup_avx512vbmi,
+		.mulrc_unaligned	= mulrc_unaligned256_lookup_avx512vbmi,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_AVX512VBMI,
+	},
+#endif
+#ifndef __arm__
+	[MOEPGF256][MOEPGF_SHUFFLE_VECTOR] = {
+		.maddrc		= maddrc256_shuffle_vector,
+		.mulrc		= mulrc256_shuffle_vector,
+		.maddrc_multi	= maddrc_multi256_shuffle_vector,
+		.maddrc_fanout	= maddrc_fanout256_shuffle_vector,
+		.maddrc3	= maddrc3_256_shuffle_vector,
+		.mulrc_copy	= mulrc_copy256_shuffle_vector,
+		.hwcaps		= VECTOR_HWCAPS,
+	},
+#endif
+#ifdef __arm__
+	[MOEPGF256][MOEPGF_IMUL_NEON_64] = {
+		.maddrc		= maddrc256_imul_neon_64,
+		.maddrc3	= maddrc3_256_imul_neon_64,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NEON,
+	},
+	[MOEPGF256][MOEPGF_IMUL_NEON_128] = {
+		.maddrc		= maddrc256_imul_neon_128,
+		.maddrc3	= maddrc3_256_imul_neon_128,
+		.mulrr		= mulrr256_imul_neon_128,
+		.maddrr		= maddrr256_imul_neon_128,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NEON,
+	},
+	[MOEPGF256][MOEPGF_SHUFFLE_NEON_64] = {
+		.maddrc		= maddrc256_shuffle_neon_64,
+		.mulrc		= mulrc256_shuffle_neon_64,
+		.maddrc_multi	= maddrc_multi256_shuffle_neon_64,
+		.maddrc_fanout	= maddrc_fanout256_shuffle_neon_64,
+		.maddrc3	= maddrc3_256_shuffle_neon_64,
+		.mulrc_copy	= mulrc_copy256_shuffle_neon_64,
+		.invr		= invr256_shuffle_neon_64,
+		.divr		= divr256_shuffle_neon_64,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NEON,
+	},
+#endif
+#ifdef __aarch64__
+	[MOEPGF256][MOEPGF_SHUFFLE_NEON_128] = {
+		.maddrc		= maddrc256_shuffle_neon_128,
+		.mulrc		= mulrc256_shuffle_neon_128,
+		.maddrc_multi	= maddrc_multi256_shuffle_neon_128,
+		.maddrc_fanout	= maddrc_fanout256_shuffle_neon_128,
+		.maddrc3	= maddrc3_256_shuffle_neon_128,
+		.mulrc_copy	= mulrc_copy256_shuffle_neon_128,
+		.invr		= invr256_shuffle_neon_128,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NEON,
 	},
+	[MOEPGF256][MOEPGF_PMULL_NEON_128] = {
+		.maddrc		= maddrc256_pmull_neon_128,
+		.mulrc		= mulrc256_pmull_neon_128,
+		.maddrc3	= maddrc3_256_pmull_neon_128,
+		.mulrr		= mulrr256_pmull_neon_128,
+		.maddrr		= maddrr256_pmull_neon_128,
+		.divr		= divr256_pmull_neon_128,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NEON,
+	},
+	[MOEPGF256][MOEPGF_SHUFFLE_NEON_SHA3] = {
+		.maddrc		= maddrc256_shuffle_neon_sha3,
+		.mulrc		= mulrc256_shuffle_neon_128,
+		.maddrc_multi	= maddrc_multi256_shuffle_neon_sha3,
+		.maddrc_fanout	= maddrc_fanout256_shuffle_neon_sha3,
+		.maddrc3	= maddrc3_256_shuffle_neon_sha3,
+		.mulrc_copy	= mulrc_copy256_shuffle_neon_128,
+		.hwcaps		= MOEPGF_HWCAPS_SIMD_NEON_SHA3,
+	},
+#endif
+};
+
+/*
+ * Size in bytes from which the mulrc_copy and maddrc3 functions of GFs
+ * initialized with MOEPGF_ALGORITHM_BEST write with non-temporal stores. Zero
+ * until the first such GF is initialized.
+ */
+static size_t nt_threshold;
+
+/*
+ * Dispatchers used by the mulrc_copy and maddrc3 functions of GFs initialized
+ * with MOEPGF_ALGORITHM_BEST if streaming-store variants are available. The
+ * kernels do not get the GF passed, so there is one dispatcher per field and
+ * hwcaps that calls the temporal or non-temporal kernel of the corresponding
+ * entry of best_algorithms. Neither depends on state that a later
+ * moepgf_init() may change.
+ */
+#define NT_DISPATCH(field, name, h)					\
+static void								\
+mulrc_copy##field##_nt_dispatch_##name(uint8_t *region1,		\
+		const uint8_t *region2, uint8_t constant, size_t length)\
+{									\
+	if (length < __atomic_load_n(&nt_threshold, __ATOMIC_RELAXED))	\
+		best_algorithms[MOEPGF##field][h].mulrc_copy(region1,	\
+					region2, constant, length);	\
+	else								\
+		best_algorithms[MOEPGF##field][h].mulrc_copy_nt(region1,\
+					region2, constant, length);	\
+}									\
+static void								\
+maddrc3_##field##_nt_dispatch_##name(uint8_t *region1,			\
+		const uint8_t *region2, const uint8_t *region3,		\
+		uint8_t constant, size_t length)			\
+{									\
+	if (length < __atomic_load_n(&nt_threshold, __ATOMIC_RELAXED))	\
+		best_algorithms[MOEPGF##field][h].maddrc3(region1,	\
+				region2, region3, constant, length);	\
+	else								\
+		best_algorithms[MOEPGF##field][h].maddrc3_nt(region1,	\
+				region2, region3, constant, length);	\
+}
+
+#define NT_DISPATCHER(field, name, h)					\
+	[MOEPGF##field][h] = {						\
+		mulrc_copy##field##_nt_dispatch_##name,			\
+		maddrc3_##field##_nt_dispatch_##name			\
+	}
+
+#ifdef __x86_64__
+NT_DISPATCH(4, avx2, MOEPGF_HWCAPS_SIMD_AVX2)
+NT_DISPATCH(4, avx512vl, MOEPGF_HWCAPS_SIMD_AVX512VL)
+NT_DISPATCH(4, avx512bw, MOEPGF_HWCAPS_SIMD_AVX512BW)
+NT_DISPATCH(4, avx512gfni, MOEPGF_HWCAPS_SIMD_AVX512GFNI)
+NT_DISPATCH(4, gfni, MOEPGF_HWCAPS_SIMD_GFNI)
+NT_DISPATCH(16, avx2, MOEPGF_HWCAPS_SIMD_AVX2)
+NT_DISPATCH(16, avx512vl, MOEPGF_HWCAPS_SIMD_AVX512VL)
+NT_DISPATCH(16, avx512bw, MOEPGF_HWCAPS_SIMD_AVX512BW)
+NT_DISPATCH(16, avx512gfni, MOEPGF_HWCAPS_SIMD_AVX512GFNI)
+NT_DISPATCH(16, gfni, MOEPGF_HWCAPS_SIMD_GFNI)
+NT_DISPATCH(256, avx2, MOEPGF_HWCAPS_SIMD_AVX2)
+NT_DISPATCH(256, avx512vl, MOEPGF_HWCAPS_SIMD_AVX512VL)
+NT_DISPATCH(256, avx512bw, MOEPGF_HWCAPS_SIMD_AVX512BW)
+NT_DISPATCH(256, avx512gfni, MOEPGF_HWCAPS_SIMD_AVX512GFNI)
+NT_DISPATCH(256, gfni, MOEPGF_HWCAPS_SIMD_GFNI)
+#endif
+
+static const struct {
+	mulrc_copy_t	mulrc_copy;
+	maddrc3_t	maddrc3;
+} nt_dispatchers[MOEPGF_COUNT][MOEPGF_HWCAPS_COUNT] = {
+#ifdef __x86_64__
+	NT_DISPATCHER(4, avx2, MOEPGF_HWCAPS_SIMD_AVX2),
+	NT_DISPATCHER(4, avx512vl, MOEPGF_HWCAPS_SIMD_AVX512VL),
+	NT_DISPATCHER(4, avx512bw, MOEPGF_HWCAPS_SIMD_AVX512BW),
+	NT_DISPATCHER(4, avx512gfni, MOEPGF_HWCAPS_SIMD_AVX512GFNI),
+	NT_DISPATCHER(4, gfni, MOEPGF_HWCAPS_SIMD_GFNI),
+	NT_DISPATCHER(16, avx2, MOEPGF_HWCAPS_SIMD_AVX2),
+	NT_DISPATCHER(16, avx512vl, MOEPGF_HWCAPS_SIMD_AVX512VL),
+	NT_DISPATCHER(16, avx512bw, MOEPGF_HWCAPS_SIMD_AVX512BW),
+	NT_DISPATCHER(16, avx512gfni, MOEPGF_HWCAPS_SIMD_AVX512GFNI),
+	NT_DISPATCHER(16, gfni, MOEPGF_HWCAPS_SIMD_GFNI),
+	NT_DISPATCHER(256, avx2, MOEPGF_HWCAPS_SIMD_AVX2),
+	NT_DISPATCHER(256, avx512vl, MOEPGF_HWCAPS_SIMD_AVX512VL),
+	NT_DISPATCHER(256, avx512bw, MOEPGF_HWCAPS_SIMD_AVX512BW),
+	NT_DISPATCHER(256, avx512gfni, MOEPGF_HWCAPS_SIMD_AVX512GFNI),
+	NT_DISPATCHER(256, gfni, MOEPGF_HWCAPS_SIMD_GFNI),
 #endif
 };
 
+/*
+ * SIMD extensions detected by moepgf_check_available_simd_extensions(). Zero
+ * until the first call since MOEPGF_HWCAPS_SIMD_NONE is always set.
+ */
+static uint32_t hwcaps_cache;
+
+/*
+ * Returns the size of the last level cache in bytes.
+ */
+static size_t
+llc_size()
+{
+	long size = -1;
+
+#ifdef _SC_LEVEL3_CACHE_SIZE
+	size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+#ifdef _SC_LEVEL2_CACHE_SIZE
+	if (size <= 0)
+		size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+	if (size <= 0)
+		return DEFAULT_LLC_SIZE;
+
+	return size;
+}
 
 const char *
 moepgf_a2name(enum MOEPGF_ALGORITHM a)
 {
-	if (a > MOEPGF_ALGORITHM_COUNT-2)
+	if (a >= MOEPGF_ALGORITHM_BEST)
 		return NULL;
 
 	return gf_names[a];
 }
 
+/*
+ * Sets hwcaps, memory layout and function pointers of gf to the entry of
+ * best_algorithms for the given field that fits the given hwcaps best. Entries
+ * whose vectors are wider than max_width bytes are skipped. Neither the
+ * library nor libc is called, i.e., it is safe to use the function in IFUNC
+ * resolvers.
+ */
+void
+best_kernels(struct moepgf *gf, enum MOEPGF_TYPE type, uint32_t hwcaps,
+							size_t max_width)
+{
+	enum MOEPGF_HWCAPS h;
+	size_t i;
+
+	for (i=0; i<sizeof(best_hwcaps)/sizeof(best_hwcaps[0]); i++) {
+		h = best_hwcaps[i];
+		if (!(hwcaps & (1 << h)))
+			continue;
+		if (h != MOEPGF_HWCAPS_SIMD_NONE
+		 && best_layout[h].granularity > max_width)
+			continue;
+		if (best_algorithms[type][h].maddrc)
+			break;
+	}
+	gf->hwcaps = (1 << h);
+	gf->alignment = best_layout[h].alignment;
+	gf->granularity = best_layout[h].granularity;
+	gf->mulrc = best_algorithms[type][h].mulrc;
+	gf->maddrc = best_algorithms[type][h].maddrc;
+	gf->maddrc_multi = best_algorithms[type][h].maddrc_multi;
+	gf->maddrc_fanout = best_algorithms[type][h].maddrc_fanout;
+	gf->maddrc3 = best_algorithms[type][h].maddrc3;
+	gf->mulrc_copy = best_algorithms[type][h].mulrc_copy;
+	gf->mulrr = best_algorithms[type][h].mulrr;
+	gf->maddrr = best_algorithms[type][h].maddrr;
+	gf->invr = best_algorithms[type][h].invr;
+	gf->divr = best_algorithms[type][h].divr;
+	gf->maddrc_unaligned = best_algorithms[type][h].maddrc_unaligned;
+	gf->mulrc_unaligned = best_algorithms[type][h].mulrc_unaligned;
+}
+
 uint32_t
 moepgf_check_available_simd_extensions()
 {
-	uint32_t ret = (1 << MOEPGF_HWCAPS_SIMD_NONE);
+	uint32_t ret;
+
+	/* Detection is only run once, concurrent callers store the same
+	 * value */
+	if ((ret = __atomic_load_n(&hwcaps_cache, __ATOMIC_RELAXED)))
+		return ret;
+
+	ret = (1 << MOEPGF_HWCAPS_SIMD_NONE);
 
 #ifdef __x86_64__
 	ret |= detect_x86_simd();
@@ -241,14 +2327,211 @@ moepgf_check_available_simd_extensions()
 	ret |= detect_arm_neon();
 #endif
 
+#ifdef __aarch64__
+	ret |= detect_aarch64();
+#endif
+
+#if !defined(__x86_64__) && !defined(__arm__) && !defined(__aarch64__)
+	ret |= (1 << MOEPGF_HWCAPS_SIMD_VECTOR);
+#endif
+
+	__atomic_store_n(&hwcaps_cache, ret, __ATOMIC_RELAXED);
+
 	return ret;
 }
 
+/*
+ * Sets the memory layout and function pointers of gf to the reference
+ * implementation of the given field. Returns 0 on success and -1 on error.
+ */
+static int
+selftest_kernels(struct moepgf *gf, enum MOEPGF_TYPE type)
+{
+	gf->alignment = algorithm_layout[MOEPGF_SELFTEST].alignment;
+	gf->granularity = algorithm_layout[MOEPGF_SELFTEST].granularity;
+
+	switch (type) {
+	case MOEPGF2:
+		gf->mulrc = mulrc2;
+		gf->maddrc = maddrc2_scalar;
+		gf->maddrc_multi = maddrc_multi2_scalar;
+		gf->maddrc_fanout = maddrc_fanout2_scalar;
+		gf->maddrc3 = maddrc3_2_scalar;
+		gf->mulrc_copy = mulrc_copy2;
+		gf->mulrr = mulrr2_scalar;
+		gf->maddrr = maddrr2_scalar;
+		gf->invr = invr2;
+		gf->divr = mulrr2_scalar;
+		gf->maddrc_unaligned = maddrc2_scalar;
+		gf->mulrc_unaligned = mulrc2;
+		break;
+	case MOEPGF4:
+		gf->mulrc = mulrc4_imul_scalar;
+		gf->maddrc = maddrc4_imul_scalar;
+		gf->maddrc_multi = maddrc_multi4_imul_scalar;
+		gf->maddrc_fanout = maddrc_fanout4_imul_scalar;
+		gf->maddrc3 = maddrc3_4_imul_scalar;
+		gf->mulrc_copy = mulrc_copy4_imul_scalar;
+		gf->mulrr = mulrr4_flat_table;
+		gf->maddrr = maddrr4_flat_table;
+		gf->invr = invr4_flat_table;
+		gf->divr = divr4_flat_table;
+		gf->maddrc_unaligned = maddrc4_imul_scalar;
+		gf->mulrc_unaligned = mulrc4_imul_scalar;
+		break;
+	case MOEPGF16:
+		gf->mulrc = mulrc16_imul_scalar;
+		gf->maddrc = maddrc16_imul_scalar;
+		gf->maddrc_multi = maddrc_multi16_imul_scalar;
+		gf->maddrc_fanout = maddrc_fanout16_imul_scalar;
+		gf->maddrc3 = maddrc3_16_imul_scalar;
+		gf->mulrc_copy = mulrc_copy16_imul_scalar;
+		gf->mulrr = mulrr16_flat_table;
+		gf->maddrr = maddrr16_flat_table;
+		gf->invr = invr16_flat_table;
+		gf->divr = divr16_flat_table;
+		gf->maddrc_unaligned = maddrc16_imul_scalar;
+		gf->mulrc_unaligned = mulrc16_imul_scalar;
+		break;
+	case MOEPGF256:
+		gf->mulrc = mulrc256_pdiv;
+		gf->maddrc = maddrc256_pdiv;
+		gf->maddrc_multi = maddrc_multi256_pdiv;
+		gf->maddrc_fanout = maddrc_fanout256_pdiv;
+		gf->maddrc3 = maddrc3_256_pdiv;
+		gf->mulrc_copy = mulrc_copy256_pdiv;
+		gf->mulrr = mulrr256_flat_table;
+		gf->maddrr = maddrr256_flat_table;
+		gf->invr = invr256_flat_table;
+		gf->divr = divr256_flat_table;
+		gf->maddrc_unaligned = maddrc256_pdiv;
+		gf->mulrc_unaligned = mulrc256_pdiv;
+		break;
+	default:
+		return -1;
+	}
+
+	return 0;
+}
+
+/*
+ * Sets the memory layout and function pointers of gf to the kernels of the
+ * given algorithm. Operations the algorithm does not implement are taken from
+ * the reference implementation. Returns -1 if the algorithm is not available
+ * for the field or not supported by the given hwcaps.
+ */
+static int
+algorithm_kernels(struct moepgf *gf, enum MOEPGF_TYPE type,
+				enum MOEPGF_ALGORITHM atype, uint32_t hwcaps)
+{
+	const struct moepgf_algorithm *alg;
+
+	if (atype <= MOEPGF_SELFTEST || atype >= MOEPGF_ALGORITHM_BEST)
+		return -1;
+
+	alg = &algorithms[type][atype];
+	if (!alg->maddrc)
+		return -1;
+	if (!(hwcaps & (1 << alg->hwcaps)))
+		return -1;
+
+	if (selftest_kernels(gf, type))
+		return -1;
+
+	gf->hwcaps = (1 << alg->hwcaps);
+	gf->alignment = algorithm_layout[atype].alignment;
+	gf->granularity = algorithm_layout[atype].granularity;
+	gf->maddrc = alg->maddrc;
+	if (alg->mulrc)
+		gf->mulrc = alg->mulrc;
+	if (alg->maddrc_multi)
+		gf->maddrc_multi = alg->maddrc_multi;
+	if (alg->maddrc_fanout)
+		gf->maddrc_fanout = alg->maddrc_fanout;
+	if (alg->maddrc3)
+		gf->maddrc3 = alg->maddrc3;
+	if (alg->mulrc_copy)
+		gf->mulrc_copy = alg->mulrc_copy;
+	if (alg->mulrr)
+		gf->mulrr = alg->mulrr;
+	if (alg->maddrr)
+		gf->maddrr = alg->maddrr;
+	if (alg->invr)
+		gf->invr = alg->invr;
+	if (alg->divr)
+		gf->divr = alg->divr;
+	if (alg->maddrc_unaligned)
+		gf->maddrc_unaligned = alg->maddrc_unaligned;
+	if (alg->mulrc_unaligned)
+		gf->mulrc_unaligned = alg->mulrc_unaligned;
+
+	return 0;
+}
+
+/*
+ * Returns the algorithm forced by the environment variable
+ * MOEPGF<field>_ALGORITHM, e.g., MOEPGF256_ALGORITHM=shuffle_avx2, or atype if
+ * the variable is unset or empty. Returns MOEPGF_ALGORITHM_COUNT if the name
+ * is unknown.
+ */
+static enum MOEPGF_ALGORITHM
+env_algorithm(enum MOEPGF_TYPE type, enum MOEPGF_ALGORITHM atype)
+{
+	static const char *vars[MOEPGF_COUNT] = {
+		[MOEPGF2]	= "MOEPGF2_ALGORITHM",
+		[MOEPGF4]	= "MOEPGF4_ALGORITHM",
+		[MOEPGF16]	= "MOEPGF16_ALGORITHM",
+		[MOEPGF256]	= "MOEPGF256_ALGORITHM",
+	};
+	const char *name;
+	int i;
+
+	if (!(name = getenv(vars[type])) || !*name)
+		return atype;
+
+	if (!strcasecmp(name, "best"))
+		return MOEPGF_ALGORITHM_BEST;
+	if (!strcasecmp(name, "autotune"))
+		return MOEPGF_ALGORITHM_AUTOTUNE;
+
+	for (i=0; i<MOEPGF_ALGORITHM_BEST; i++) {
+		if (!strcasecmp(name, gf_names[i]))
+			return i;
+	}
+
+	return MOEPGF_ALGORITHM_COUNT;
+}
+
+/*
+ * Returns the maximum vector width in bytes given in bits by the environment
+ * variable MOEPGF_MAX_VECTOR_WIDTH, e.g., MOEPGF_MAX_VECTOR_WIDTH=256, or
+ * MOEPGF_MAX_ALIGNMENT if the variable is unset or empty. Returns 0 if the
+ * value is not a number of at least 64.
+ */
+static size_t
+env_max_width()
+{
+	const char *val;
+	char *end;
+	unsigned long bits;
+
+	if (!(val = getenv("MOEPGF_MAX_VECTOR_WIDTH")) || !*val)
+		return MOEPGF_MAX_ALIGNMENT;
+
+	bits = strtoul(val, &end, 10);
+	if (*end || bits < 64)
+		return 0;
+
+	return bits / 8;
+}
+
 int
 moepgf_init(struct moepgf *gf, enum MOEPGF_TYPE type, enum MOEPGF_ALGORITHM atype)
 {
 	int ret = 0;
 	int hwcaps;
+	size_t max_width;
+	enum MOEPGF_HWCAPS h;
 
 	memset(gf, 0, sizeof(*gf));
 
@@ -300,299 +2583,151 @@ moepgf_init(struct moepgf *gf, enum MOEPGF_TYPE type, enum MOEPGF_ALGORITHM atyp
 		return -1;
 	}
 
+	if (atype == MOEPGF_ALGORITHM_BEST || atype == MOEPGF_ALGORITHM_AUTOTUNE)
+		atype = env_algorithm(type, atype);
+
 	switch (atype) {
 	case MOEPGF_SELFTEST:
-		switch (type) {
-		case MOEPGF2:
-			gf->mulrc = mulrc2;
-			gf->maddrc = maddrc2_scalar;
-			break;
-		case MOEPGF4:
-			gf->mulrc = mulrc4_imul_scalar;
-			gf->maddrc = maddrc4_imul_scalar;
-			break;
-		case MOEPGF16:
-			gf->mulrc = mulrc16_imul_scalar;
-			gf->maddrc = maddrc16_imul_scalar;
-			break;
-		case MOEPGF256:
-			gf->mulrc = mulrc256_pdiv;
-			gf->maddrc = maddrc256_pdiv;
-			break;
-		default:
-			return -1;
-		}
+		ret = selftest_kernels(gf, type);
 		break;
 
 	case MOEPGF_ALGORITHM_BEST:
-#ifdef __x86_64__
-		if (hwcaps & (1 << MOEPGF_HWCAPS_SIMD_AVX512GFNI)) {
-			gf->hwcaps = (1 << MOEPGF_HWCAPS_SIMD_AVX512GFNI);
-			gf->mulrc  = best_algorithms[type][MOEPGF_HWCAPS_SIMD_AVX512GFNI].mulrc;
-			gf->maddrc = best_algorithms[type][MOEPGF_HWCAPS_SIMD_AVX512GFNI].maddrc;
-		}
-		else if (hwcaps & (1 << MOEPGF_HWCAPS_SIMD_AVX512)) {
-			gf->hwcaps = (1 << MOEPGF_HWCAPS_SIMD_AVX512);
-			gf->mulrc  = best_algorithms[type][MOEPGF_HWCAPS_SIMD_AVX512].mulrc;
-			gf->maddrc = best_algorithms[type][MOEPGF_HWCAPS_SIMD_AVX512].maddrc;
-		}
-		else if (hwcaps & (1 << MOEPGF_HWCAPS_SIMD_AVX512BW)) {
-			gf->hwcaps = (1 << MOEPGF_HWCAPS_SIMD_AVX512BW);
-			gf->mulrc  = best_algorithms[type][MOEPGF_HWCAPS_SIMD_AVX512BW].mulrc;
-			gf->maddrc = best_algorithms[type][MOEPGF_HWCAPS_SIMD_AVX512BW].maddrc;
-		}
-		else if (hwcaps & (1 << MOEPGF_HWCAPS_SIMD_AVX2)) {
-			gf->hwcaps = (1 << MOEPGF_HWCAPS_SIMD_AVX2);
-			gf->mulrc  = best_algorithms[type][MOEPGF_HWCAPS_SIMD_AVX2].mulrc;
-			gf->maddrc = best_algorithms[type][MOEPGF_HWCAPS_SIMD_AVX2].maddrc;
-		}
-		else if (hwcaps & (1 << MOEPGF_HWCAPS_SIMD_SSSE3)) {
-			gf->hwcaps = (1 << MOEPGF_HWCAPS_SIMD_SSSE3);
-			gf->mulrc  = best_algorithms[type][MOEPGF_HWCAPS_SIMD_SSSE3].mulrc;
-			gf->maddrc = best_algorithms[type][MOEPGF_HWCAPS_SIMD_SSSE3].maddrc;
-		}
-		else if (hwcaps & (1 << MOEPGF_HWCAPS_SIMD_SSE2)) {
-			gf->hwcaps = (1 << MOEPGF_HWCAPS_SIMD_SSE2);
-			gf->mulrc  = best_algorithms[type][MOEPGF_HWCAPS_SIMD_SSE2].mulrc;
-			gf->maddrc = best_algorithms[type][MOEPGF_HWCAPS_SIMD_SSE2].maddrc;
-		}
-#endif
-#ifdef __arm__
-		if (hwcaps & (1 << MOEPGF_HWCAPS_SIMD_NEON)) {
-			gf->hwcaps = (1 << MOEPGF_HWCAPS_SIMD_NEON);
-			gf->mulrc  = best_algorithms[type][MOEPGF_HWCAPS_SIMD_NEON].mulrc;
-			gf->maddrc = best_algorithms[type][MOEPGF_HWCAPS_SIMD_NEON].maddrc;
-		}
-#endif
-#ifdef __powerpc64__
-		if (hwcaps & (1 << MOEPGF_HWCAPS_SIMD_NONE)) {
-			gf->mulrc  = best_algorithms[type][MOEPGF_HWCAPS_SIMD_NONE].mulrc;
-			gf->maddrc = best_algorithms[type][MOEPGF_HWCAPS_SIMD_NONE].maddrc;
-		}
-#endif
-		if (hwcaps & (1 << MOEPGF_HWCAPS_SIMD_NONE)) {
-			gf->mulrc  = best_algorithms[type][MOEPGF_HWCAPS_SIMD_NONE].mulrc;
-			gf->maddrc = best_algorithms[type][MOEPGF_HWCAPS_SIMD_NONE].maddrc;
-		}
-		else {
+	case MOEPGF_ALGORITHM_AUTOTUNE:
+		if (!(max_width = env_max_width()))
 			return -1;
+
+		best_kernels(gf, type, hwcaps, max_width);
+		h = __builtin_ctz(gf->hwcaps);
+
+		if (best_algorithms[type][h].mulrc_copy_nt
+				&& nt_dispatchers[type][h].mulrc_copy) {
+			/* The cache size does not change, concurrent callers
+			 * store the same value */
+			if (!(gf->nt_threshold = __atomic_load_n(&nt_threshold,
+							__ATOMIC_RELAXED))) {
+				gf->nt_threshold = llc_size();
+				__atomic_store_n(&nt_threshold,
+					gf->nt_threshold, __ATOMIC_RELAXED);
+			}
+			gf->mulrc_copy = nt_dispatchers[type][h].mulrc_copy;
+			gf->maddrc3 = nt_dispatchers[type][h].maddrc3;
 		}
+
+		if (atype == MOEPGF_ALGORITHM_AUTOTUNE)
+			ret = autotune(gf, max_width);
 		break;
 
 	default:
-		return -1;
+		ret = algorithm_kernels(gf, type, atype, hwcaps);
+		break;
 	}
 
 	return ret;
 }
 
-static void
-add_algorithm(struct moepgf_algorithm **algs, enum MOEPGF_TYPE gt,
-		enum MOEPGF_ALGORITHM at, enum MOEPGF_HWCAPS hwcaps,
-		maddrc_t maddrc, mulrc_t mulrc)
+struct moepgf_algorithm **
+moepgf_get_algs(enum MOEPGF_TYPE field)
 {
-	struct moepgf_algorithm *alg;
+	struct moepgf_algorithm **algs;
+	int i;
 
-	alg = calloc(1, sizeof(*alg));
+	if (field < 0 || field >= MOEPGF_COUNT)
+		return NULL;
 
-	alg->maddrc = maddrc;
-	alg->mulrc = mulrc;
-	alg->hwcaps = hwcaps;
-	alg->type = at;
-	alg->field = gt;
+	if (!(algs = calloc(MOEPGF_ALGORITHM_COUNT,sizeof(*algs))))
+		return NULL;
 
-	algs[at] = alg;
+	for (i=0; i<MOEPGF_ALGORITHM_COUNT; i++) {
+		if (!algorithms[field][i].maddrc)
+			continue;
+
+		if (!(algs[i] = malloc(sizeof(*algs[i])))) {
+			moepgf_free_algs(algs);
+			return NULL;
+		}
+
+		*algs[i] = algorithms[field][i];
+		algs[i]->type = i;
+		algs[i]->field = field;
+		algs[i]->alignment = algorithm_layout[i].alignment;
+		algs[i]->granularity = algorithm_layout[i].granularity;
+	}
+
+	return algs;
 }
 
-struct moepgf_algorithm **
-moepgf_get_algs(enum MOEPGF_TYPE field)
+void *
+moepgf_alloc(const struct moepgf *gf, size_t len)
 {
-	struct moepgf_algorithm **algs;
+	void *p;
+	size_t align, size;
 
-	if (!(algs = calloc(MOEPGF_ALGORITHM_COUNT,sizeof(*algs))))
+	align = gf->alignment < sizeof(void *) ? sizeof(void *) : gf->alignment;
+	if (len > SIZE_MAX - gf->granularity)
 		return NULL;
 
-	switch (field) {
-	case MOEPGF2:
-		add_algorithm(algs, field, MOEPGF_XOR_GPR32,
-				MOEPGF_HWCAPS_SIMD_NONE,
-				maddrc2_gpr32, NULL);
-		add_algorithm(algs, field, MOEPGF_XOR_GPR64,
-				MOEPGF_HWCAPS_SIMD_NONE,
-				maddrc2_gpr64, NULL);
-#ifdef __x86_64__
-		add_algorithm(algs, field, MOEPGF_XOR_SSE2,
-				MOEPGF_HWCAPS_SIMD_SSE2,
-				maddrc2_sse2, NULL);
-		add_algorithm(algs, field, MOEPGF_XOR_AVX2,
-				MOEPGF_HWCAPS_SIMD_AVX2,
-				maddrc2_avx2, NULL);
-		add_algorithm(algs, field, MOEPGF_XOR_AVX512,
-				MOEPGF_HWCAPS_SIMD_AVX512,
-				maddrc2_avx512, NULL);
-#endif
-#ifdef __arm__
-		add_algorithm(algs, field, MOEPGF_XOR_NEON_128,
-				MOEPGF_HWCAPS_SIMD_NEON,
-				maddrc2_neon, NULL);
-#endif
-#ifdef __mips__
-		add_algorithm(algs, field, MOEPGF_XOR_MSA,
-				MOEPGF_HWCAPS_SIMD_MSA,
-				maddrc2_msa, NULL);
-#endif
-		break;
-	case MOEPGF4:
-		add_algorithm(algs, field, MOEPGF_FLAT_TABLE,
-				MOEPGF_HWCAPS_SIMD_NONE,
-				maddrc4_flat_table, NULL);
-		add_algorithm(algs, field, MOEPGF_IMUL_GPR32,
-				MOEPGF_HWCAPS_SIMD_NONE,
-				maddrc4_imul_gpr32, NULL);
-		add_algorithm(algs, field, MOEPGF_IMUL_GPR64,
-				MOEPGF_HWCAPS_SIMD_NONE,
-				maddrc4_imul_gpr64, NULL);
-#ifdef __x86_64__
-		add_algorithm(algs, field, MOEPGF_IMUL_SSE2,
-				MOEPGF_HWCAPS_SIMD_SSE2,
-				maddrc4_imul_sse2, NULL);
-		add_algorithm(algs, field, MOEPGF_IMUL_AVX2,
-				MOEPGF_HWCAPS_SIMD_AVX2,
-				maddrc4_imul_avx2, NULL);
-		add_algorithm(algs, field, MOEPGF_IMUL_AVX512,
-				MOEPGF_HWCAPS_SIMD_AVX512,
-				maddrc4_imul_avx512, NULL);
-		add_algorithm(algs, field, MOEPGF_SHUFFLE_SSSE3,
-				MOEPGF_HWCAPS_SIMD_SSSE3,
-				maddrc4_shuffle_ssse3, NULL);
-		add_algorithm(algs, field, MOEPGF_SHUFFLE_AVX2,
-				MOEPGF_HWCAPS_SIMD_AVX2,
-				maddrc4_shuffle_avx2, NULL);
-		add_algorithm(algs, field, MOEPGF_SHUFFLE_AVX512,
-				MOEPGF_HWCAPS_SIMD_AVX512BW,
-				maddrc4_shuffle_avx512, NULL);
-#endif
-#ifdef __arm__
-		add_algorithm(algs, field, MOEPGF_IMUL_NEON_64,
-				MOEPGF_HWCAPS_SIMD_NEON,
-				maddrc4_imul_neon_64, NULL);
-		add_algorithm(algs, field, MOEPGF_IMUL_NEON_128,
-				MOEPGF_HWCAPS_SIMD_NEON,
-				maddrc4_imul_neon_128, NULL);
-		add_algorithm(algs, field, MOEPGF_SHUFFLE_NEON_64,
-				MOEPGF_HWCAPS_SIMD_NEON,
-				maddrc4_shuffle_neon_64, NULL);
-#endif
-		break;
-	case MOEPGF16:
-		add_algorithm(algs, field, MOEPGF_FLAT_TABLE,
-				MOEPGF_HWCAPS_SIMD_NONE,
-				maddrc16_flat_table, NULL);
-		add_algorithm(algs, field, MOEPGF_LOG_TABLE,
-				MOEPGF_HWCAPS_SIMD_NONE,
-				maddrc16_log_table, NULL);
-		add_algorithm(algs, field, MOEPGF_IMUL_GPR32,
-				MOEPGF_HWCAPS_SIMD_NONE,
-				maddrc16_imul_gpr32, NULL);
-		add_algorithm(algs, field, MOEPGF_IMUL_GPR64,
-				MOEPGF_HWCAPS_SIMD_NONE,
-				maddrc16_imul_gpr64, NULL);
-#ifdef __x86_64__
-		add_algorithm(algs, field, MOEPGF_IMUL_SSE2,
-				MOEPGF_HWCAPS_SIMD_SSE2,
-				maddrc16_imul_sse2, NULL);
-		add_algorithm(algs, field, MOEPGF_IMUL_AVX2,
-				MOEPGF_HWCAPS_SIMD_AVX2,
-				maddrc16_imul_avx2, NULL);
-		add_algorithm(algs, field, MOEPGF_IMUL_AVX512,
-				MOEPGF_HWCAPS_SIMD_AVX512,
-				maddrc16_imul_avx512, NULL);
-		add_algorithm(algs, field, MOEPGF_SHUFFLE_SSSE3,
-				MOEPGF_HWCAPS_SIMD_SSSE3,
-				maddrc16_shuffle_ssse3, NULL);
-		add_algorithm(algs, field, MOEPGF_SHUFFLE_AVX2,
-				MOEPGF_HWCAPS_SIMD_AVX2,
-				maddrc16_shuffle_avx2, NULL);
-		add_algorithm(algs, field, MOEPGF_SHUFFLE_AVX512,
-				MOEPGF_HWCAPS_SIMD_AVX512BW,
-				maddrc16_shuffle_avx512, NULL);
-#endif
-#ifdef __arm__
-		add_algorithm(algs, field, MOEPGF_IMUL_NEON_64,
-				MOEPGF_HWCAPS_SIMD_NEON,
-				maddrc16_imul_neon_64, NULL);
-		add_algorithm(algs, field, MOEPGF_IMUL_NEON_128,
-				MOEPGF_HWCAPS_SIMD_NEON,
-				maddrc16_imul_neon_128, NULL);
-		add_algorithm(algs, field, MOEPGF_SHUFFLE_NEON_64,
-				MOEPGF_HWCAPS_SIMD_NEON,
-				maddrc16_shuffle_neon_64, NULL);
-#endif
-		break;
-	case MOEPGF256:
-		add_algorithm(algs, field, MOEPGF_FLAT_TABLE,
-				MOEPGF_HWCAPS_SIMD_NONE,
-				maddrc256_flat_table, NULL);
-		add_algorithm(algs, field, MOEPGF_LOG_TABLE,
-				MOEPGF_HWCAPS_SIMD_NONE,
-				maddrc256_log_table, NULL);
-		add_algorithm(algs, field, MOEPGF_IMUL_GPR32,
-				MOEPGF_HWCAPS_SIMD_NONE,
-				maddrc256_imul_gpr32, NULL);
-		add_algorithm(algs, field, MOEPGF_IMUL_GPR64,
-				MOEPGF_HWCAPS_SIMD_NONE,
-				maddrc256_imul_gpr64, NULL);
-#ifdef __x86_64__
-		add_algorithm(algs, field, MOEPGF_IMUL_SSE2,
-				MOEPGF_HWCAPS_SIMD_SSE2,
-				maddrc256_imul_sse2, NULL);
-		add_algorithm(algs, field, MOEPGF_IMUL_AVX2,
-				MOEPGF_HWCAPS_SIMD_AVX2,
-				maddrc256_imul_avx2, NULL);
-		add_algorithm(algs, field, MOEPGF_IMUL_AVX512,
-				MOEPGF_HWCAPS_SIMD_AVX512,
-				maddrc256_imul_avx512, NULL);
-		add_algorithm(algs, field, MOEPGF_SHUFFLE_SSSE3,
-				MOEPGF_HWCAPS_SIMD_SSSE3,
-				maddrc256_shuffle_ssse3, NULL);
-		add_algorithm(algs, field, MOEPGF_SHUFFLE_AVX2,
-				MOEPGF_HWCAPS_SIMD_AVX2,
-				maddrc256_shuffle_avx2, NULL);
-		add_algorithm(algs, field, MOEPGF_SHUFFLE_AVX512,
-				MOEPGF_HWCAPS_SIMD_AVX512BW,
-				maddrc256_shuffle_avx512, NULL);
-#if MOEPGF256_POLYNOMIAL == 283
-		add_algorithm(algs, field, MOEPGF_GFNI128,
-				MOEPGF_HWCAPS_SIMD_AVX512GFNI,
-				maddrc256_gfni128, NULL);
-		add_algorithm(algs, field, MOEPGF_GFNI256,
-				MOEPGF_HWCAPS_SIMD_AVX512GFNI,
-				maddrc256_gfni256, NULL);
-		add_algorithm(algs, field, MOEPGF_GFNI512,
-				MOEPGF_HWCAPS_SIMD_AVX512GFNI,
-				maddrc256_gfni512, NULL);
-#endif
-#endif
-#ifdef __arm__
-		add_algorithm(algs, field, MOEPGF_IMUL_NEON_64,
-				MOEPGF_HWCAPS_SIMD_NEON,
-				maddrc256_imul_neon_64, NULL);
-		add_algorithm(algs, field, MOEPGF_IMUL_NEON_128,
-				MOEPGF_HWCAPS_SIMD_NEON,
-				maddrc256_imul_neon_128, NULL);
-		add_algorithm(algs, field, MOEPGF_SHUFFLE_NEON_64,
-				MOEPGF_HWCAPS_SIMD_NEON,
-				maddrc256_shuffle_neon_64, NULL);
-#endif
-		break;
+	size = (len + gf->granularity - 1) & ~(gf->granularity - 1);
+	if (!size)
+		size = gf->granularity;
 
-	default:
-		// free everything before
-		free(algs);
+	if (posix_memalign(&p, align, size))
 		return NULL;
+
+	memset((uint8_t *)p + len, 0, size - len);
+
+	return p;
+}
+
+void
+moepgf_free(void *p)
+{
+	free(p);
+}
+
+int
+moepgf_matmul(const struct moepgf *gf, uint8_t **out, const uint8_t **in,
+			const uint8_t *coef, int m, int k, size_t len)
+{
+	uint8_t *tout[MATMUL_ROWS];
+	uint8_t c[MATMUL_ROWS];
+	size_t off, tile, tlen;
+	int i, j, r, rows;
+
+	if (m < 0 || k < 0)
+		return -1;
+
+	/* Tile the byte dimension such that the input tiles of all k regions
+	 * and the output tiles of one group of rows fit into L1. For large k
+	 * the tiles do not get smaller than MATMUL_TILE_MIN and are served
+	 * from L2 instead. */
+	tile = MATMUL_L1_SIZE / (k + MATMUL_ROWS);
+	tile -= tile % MATMUL_TILE_MIN;
+	if (tile < MATMUL_TILE_MIN)
+		tile = MATMUL_TILE_MIN;
+
+	for (off=0; off<len; off+=tile) {
+		tlen = len - off < tile ? len - off : tile;
+
+		/* Each input tile is loaded once per group of MATMUL_ROWS
+		 * output rows and added to all of them by maddrc_fanout. */
+		for (i=0; i<m; i+=MATMUL_ROWS) {
+			rows = m - i < MATMUL_ROWS ? m - i : MATMUL_ROWS;
+
+			for (r=0; r<rows; r++) {
+				tout[r] = out[i+r] + off;
+				memset(tout[r], 0, tlen);
+			}
+
+			for (j=0; j<k; j++) {
+				for (r=0; r<rows; r++)
+					c[r] = coef[(i+r)*k + j];
+				gf->maddrc_fanout(tout, in[j] + off, c, rows,
+									tlen);
+			}
+		}
 	}
 
-	return algs;
+	return 0;
 }
 
 void
@@ -200,6 +200,32 @@ mulrc16_imul_scalar(uint8_t *region, uint8_t constant, size_t length)
 	}
 }
 
+void
+mulrc_copy16_imul_scalar(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	const uint8_t *p = pt[constant];
+	uint8_t r[4];
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	for (; length; region1++, region2++, length--) {
+		r[0] = ((*region2 & 0x11) >> 0) * p[0];
+		r[1] = ((*region2 & 0x22) >> 1) * p[1];
+		r[2] = ((*region2 & 0x44) >> 2) * p[2];
+		r[3] = ((*region2 & 0x88) >> 3) * p[3];
+		*region1 = r[0] ^ r[1] ^ r[2] ^ r[3];
+	}
+}
+
 void
 mulrc16_imul_gpr32(uint8_t *region, uint8_t constant, size_t length)
 {
@@ -224,6 +250,33 @@ mulrc16_imul_gpr32(uint8_t *region, uint8_t constant, size_t length)
 	}
 }
 
+void
+mulrc_copy16_imul_gpr32(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	const uint8_t *p = pt[constant];
+	uint32_t r64[4];
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	for (end=region1+length; region1<end; region1+=4, region2+=4) {
+		r64[0] = ((*(uint32_t *)region2 & 0x11111111)>>0)*p[0];
+		r64[1] = ((*(uint32_t *)region2 & 0x22222222)>>1)*p[1];
+		r64[2] = ((*(uint32_t *)region2 & 0x44444444)>>2)*p[2];
+		r64[3] = ((*(uint32_t *)region2 & 0x88888888)>>3)*p[3];
+		*((uint32_t *)region1) = r64[0] ^ r64[1] ^ r64[2] ^ r64[3];
+	}
+}
+
 void
 mulrc16_imul_gpr64(uint8_t *region, uint8_t constant, size_t length)
 {
@@ -248,3 +301,304 @@ mulrc16_imul_gpr64(uint8_t *region, uint8_t constant, size_t length)
 	}
 }
 
+void
+mulrc_copy16_imul_gpr64(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	const uint8_t *p = pt[constant];
+	uint64_t r64[4];
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	for (end=region1+length; region1<end; region1+=8, region2+=8) {
+		r64[0] = ((*(uint64_t *)region2 & 0x1111111111111111)>>0)*p[0];
+		r64[1] = ((*(uint64_t *)region2 & 0x2222222222222222)>>1)*p[1];
+		r64[2] = ((*(uint64_t *)region2 & 0x4444444444444444)>>2)*p[2];
+		r64[3] = ((*(uint64_t *)region2 & 0x8888888888888888)>>3)*p[3];
+		*((uint64_t *)region1) = r64[0] ^ r64[1] ^ r64[2] ^ r64[3];
+	}
+}
+
+void
+maddrc_multi16_imul_scalar(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++)
+		maddrc16_imul_scalar(region1, regions[i], constants[i], length);
+}
+
+void
+maddrc_multi16_imul_gpr64(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++)
+		maddrc16_imul_gpr64(region1, regions[i], constants[i], length);
+}
+
+void
+maddrc_fanout16_imul_scalar(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++)
+		maddrc16_imul_scalar(regions[i], region2, constants[i], length);
+}
+
+void
+maddrc_fanout16_imul_gpr64(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++)
+		maddrc16_imul_gpr64(regions[i], region2, constants[i], length);
+}
+
+void
+maddrc3_16_imul_scalar(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	const uint8_t *p = pt[constant];
+	uint8_t r[4];
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_scalar(region1, region2, region3, length);
+		return;
+	}
+
+	for (; length; region1++, region2++, region3++, length--) {
+		r[0] = ((*region3 & 0x11) >> 0) * p[0];
+		r[1] = ((*region3 & 0x22) >> 1) * p[1];
+		r[2] = ((*region3 & 0x44) >> 2) * p[2];
+		r[3] = ((*region3 & 0x88) >> 3) * p[3];
+		*region1 = *region2 ^ r[0] ^ r[1] ^ r[2] ^ r[3];
+	}
+}
+
+void
+maddrc3_16_imul_gpr32(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	const uint8_t *p = pt[constant];
+	uint32_t r64[4];
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_gpr32(region1, region2, region3, length);
+		return;
+	}
+
+	for (end=region1+length; region1<end;
+			region1+=4, region2+=4, region3+=4) {
+		r64[0] = ((*(uint32_t *)region3 & 0x11111111)>>0)*p[0];
+		r64[1] = ((*(uint32_t *)region3 & 0x22222222)>>1)*p[1];
+		r64[2] = ((*(uint32_t *)region3 & 0x44444444)>>2)*p[2];
+		r64[3] = ((*(uint32_t *)region3 & 0x88888888)>>3)*p[3];
+		*((uint32_t *)region1) = *((uint32_t *)region2)
+					^ r64[0] ^ r64[1] ^ r64[2] ^ r64[3];
+	}
+}
+
+void
+maddrc3_16_imul_gpr64(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	const uint8_t *p = pt[constant];
+	uint64_t r64[4];
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_gpr64(region1, region2, region3, length);
+		return;
+	}
+
+	for (end=region1+length; region1<end;
+			region1+=8, region2+=8, region3+=8) {
+		r64[0] = ((*(uint64_t *)region3 & 0x1111111111111111)>>0)*p[0];
+		r64[1] = ((*(uint64_t *)region3 & 0x2222222222222222)>>1)*p[1];
+		r64[2] = ((*(uint64_t *)region3 & 0x4444444444444444)>>2)*p[2];
+		r64[3] = ((*(uint64_t *)region3 & 0x8888888888888888)>>3)*p[3];
+		*((uint64_t *)region1) = *((uint64_t *)region2)
+					^ r64[0] ^ r64[1] ^ r64[2] ^ r64[3];
+	}
+}
+
+void
+maddrc3_16_flat_table(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_scalar(region1, region2, region3, length);
+		return;
+	}
+
+	for (; length; region1++, region2++, region3++, length--) {
+		*region1 = *region2 ^ multab[constant][*region3];
+	}
+}
+
+void
+maddrc3_16_log_table(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t l;
+	uint8_t tmp,r;
+	int x;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_scalar(region1, region2, region3, length);
+		return ;
+	}
+
+	l = logt[constant];
+
+	for (; length; region1++, region2++, region3++, length--) {
+		tmp = *region3 >> 4;
+
+		r = 0;
+		if (tmp) {
+			x = l + logt[tmp];
+			r = alogt[x] << 4;
+		}
+
+		tmp = *region3 & 0x0f;
+		if (tmp) {
+			x = l + logt[tmp];
+			r |= alogt[x];
+		}
+
+		*region1 = *region2 ^ r;
+	}
+}
+
+void
+mulrr16_flat_table(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	for (; length; region1++, region2++, length--) {
+		*region1 = (multab[*region2 >> 4][*region1] & 0xf0)
+				| (multab[*region2 & 0x0f][*region1] & 0x0f);
+	}
+}
+
+void
+maddrr16_flat_table(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, size_t length)
+{
+	for (; length; region1++, region2++, region3++, length--) {
+		*region1 ^= (multab[*region3 >> 4][*region2] & 0xf0)
+				| (multab[*region3 & 0x0f][*region2] & 0x0f);
+	}
+}
+
+void
+mulrr16_imul_gpr64(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	uint64_t a, b, t, acc, p;
+	int i;
+
+	p = (uint64_t)(MOEPGF16_POLYNOMIAL & MOEPGF16_MASK) * 0x1111111111111111;
+
+	for (end=region1+length; region1<end; region1+=8, region2+=8) {
+		a = *(uint64_t *)region1;
+		b = *(uint64_t *)region2;
+		acc = 0;
+
+		for (i=0; i<MOEPGF16_EXPONENT; i++) {
+			t = b & 0x1111111111111111;
+			acc ^= a & ((t << 4) - t);
+			b >>= 1;
+			t = (a >> 3) & 0x1111111111111111;
+			t = ((t << 4) - t) & p;
+			a = ((a << 1) & 0xeeeeeeeeeeeeeeee) ^ t;
+		}
+
+		*(uint64_t *)region1 = acc;
+	}
+}
+
+void
+maddrr16_imul_gpr64(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, size_t length)
+{
+	uint8_t *end;
+	uint64_t a, b, t, acc, p;
+	int i;
+
+	p = (uint64_t)(MOEPGF16_POLYNOMIAL & MOEPGF16_MASK) * 0x1111111111111111;
+
+	for (end=region1+length; region1<end;
+			region1+=8, region2+=8, region3+=8) {
+		a = *(uint64_t *)region2;
+		b = *(uint64_t *)region3;
+		acc = *(uint64_t *)region1;
+
+		for (i=0; i<MOEPGF16_EXPONENT; i++) {
+			t = b & 0x1111111111111111;
+			acc ^= a & ((t << 4) - t);
+			b >>= 1;
+			t = (a >> 3) & 0x1111111111111111;
+			t = ((t << 4) - t) & p;
+			a = ((a << 1) & 0xeeeeeeeeeeeeeeee) ^ t;
+		}
+
+		*(uint64_t *)region1 = acc;
+	}
+}
+
+void
+invr16_flat_table(uint8_t *region, size_t length)
+{
+	for (; length; region++, length--) {
+		*region = (inverses[*region >> 4] << 4)
+				| inverses[*region & 0x0f];
+	}
+}
+
+void
+divr16_flat_table(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	for (; length; region1++, region2++, length--) {
+		*region1 = (multab[inverses[*region2 >> 4]][*region1] & 0xf0)
+			| (multab[inverses[*region2 & 0x0f]][*region1] & 0x0f);
+	}
+}
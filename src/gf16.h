@@ -35,8 +35,40 @@ void maddrc16_flat_table(uint8_t *region1, const uint8_t *region2, uint8_t const
 void maddrc16_log_table(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 
 void mulrc16_imul_scalar(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy16_imul_scalar(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void mulrc16_imul_gpr32(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy16_imul_gpr32(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void mulrc16_imul_gpr64(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy16_imul_gpr64(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+
+void maddrc_multi16_imul_scalar(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_multi16_imul_gpr64(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+
+void maddrc_fanout16_imul_scalar(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout16_imul_gpr64(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+
+void maddrc3_16_imul_scalar(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_16_log_table(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_16_flat_table(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_16_imul_gpr32(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_16_imul_gpr64(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+
+void mulrr16_flat_table(uint8_t *region1, const uint8_t *region2, size_t length);
+void mulrr16_imul_gpr64(uint8_t *region1, const uint8_t *region2, size_t length);
+void maddrr16_flat_table(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void maddrr16_imul_gpr64(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+
+void invr16_flat_table(uint8_t *region, size_t length);
+void divr16_flat_table(uint8_t *region1, const uint8_t *region2, size_t length);
+
+#ifndef __arm__
+void maddrc16_shuffle_vector(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc16_shuffle_vector(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy16_shuffle_vector(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi16_shuffle_vector(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout16_shuffle_vector(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_16_shuffle_vector(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+#endif
 
 #ifdef __x86_64__
 void maddrc16_imul_sse2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
@@ -45,12 +77,136 @@ void maddrc16_imul_avx512(uint8_t *region1, const uint8_t *region2, uint8_t cons
 void maddrc16_shuffle_ssse3(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void maddrc16_shuffle_avx2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void maddrc16_shuffle_avx512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc16_shuffle_ssse3_x2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc16_shuffle_ssse3_x4(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc16_shuffle_avx2_x2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc16_shuffle_avx2_x4(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc16_shuffle_avx512_x2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc16_shuffle_avx512_x4(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_prefetch16_shuffle_ssse3(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length, size_t distance);
+void maddrc_prefetch16_shuffle_avx2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length, size_t distance);
+void maddrc_prefetch16_shuffle_avx512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length, size_t distance);
 
 void mulrc16_imul_sse2(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy16_imul_sse2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void mulrc16_shuffle_ssse3(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy16_shuffle_ssse3(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void mulrc16_shuffle_avx2(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy16_shuffle_avx2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_copy_nt16_shuffle_avx2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void mulrc16_shuffle_avx512(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy16_shuffle_avx512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_copy_nt16_shuffle_avx512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc16_shuffle_ssse3_x2(uint8_t *region, uint8_t constant, size_t length);
+void mulrc16_shuffle_ssse3_x4(uint8_t *region, uint8_t constant, size_t length);
+void mulrc16_shuffle_avx2_x2(uint8_t *region, uint8_t constant, size_t length);
+void mulrc16_shuffle_avx2_x4(uint8_t *region, uint8_t constant, size_t length);
+void mulrc16_shuffle_avx512_x2(uint8_t *region, uint8_t constant, size_t length);
+void mulrc16_shuffle_avx512_x4(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_prefetch16_shuffle_ssse3(uint8_t *region, uint8_t constant, size_t length, size_t distance);
+void mulrc_prefetch16_shuffle_avx2(uint8_t *region, uint8_t constant, size_t length, size_t distance);
+void mulrc_prefetch16_shuffle_avx512(uint8_t *region, uint8_t constant, size_t length, size_t distance);
 void mulrc16_imul_avx512(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy16_imul_avx512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+
+void maddrc_multi16_imul_sse2(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_multi16_shuffle_ssse3(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_multi16_shuffle_avx2(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_multi16_shuffle_avx512(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+
+void maddrc_fanout16_imul_sse2(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout16_shuffle_ssse3(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout16_shuffle_avx2(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout16_shuffle_avx512(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+
+void maddrc3_16_imul_sse2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_16_imul_avx2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_16_imul_avx512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_16_shuffle_ssse3(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_16_shuffle_avx2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_nt16_shuffle_avx2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_16_shuffle_avx512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_nt16_shuffle_avx512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+
+void mulrr16_imul_sse2(uint8_t *region1, const uint8_t *region2, size_t length);
+void mulrr16_imul_avx2(uint8_t *region1, const uint8_t *region2, size_t length);
+void mulrr16_imul_avx512(uint8_t *region1, const uint8_t *region2, size_t length);
+void maddrr16_imul_sse2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void maddrr16_imul_avx2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void maddrr16_imul_avx512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+
+void invr16_shuffle_ssse3(uint8_t *region, size_t length);
+void invr16_shuffle_avx2(uint8_t *region, size_t length);
+void invr16_shuffle_avx512(uint8_t *region, size_t length);
+void divr16_shuffle_ssse3(uint8_t *region1, const uint8_t *region2, size_t length);
+void divr16_shuffle_avx2(uint8_t *region1, const uint8_t *region2, size_t length);
+void divr16_shuffle_avx512(uint8_t *region1, const uint8_t *region2, size_t length);
+
+void maddrc_unaligned16_shuffle_ssse3(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_unaligned16_shuffle_avx2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_unaligned16_shuffle_avx512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_unaligned16_shuffle_ssse3(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_unaligned16_shuffle_avx2(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_unaligned16_shuffle_avx512(uint8_t *region, uint8_t constant, size_t length);
+
+void maddrc16_gfni_affine128(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc16_gfni_affine128(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy16_gfni_affine128(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi16_gfni_affine128(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout16_gfni_affine128(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_16_gfni_affine128(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc_unaligned16_gfni_affine128(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_unaligned16_gfni_affine128(uint8_t *region, uint8_t constant, size_t length);
+void maddrc16_gfni_affine256(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc16_gfni_affine256(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy16_gfni_affine256(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi16_gfni_affine256(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout16_gfni_affine256(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_16_gfni_affine256(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc_unaligned16_gfni_affine256(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_unaligned16_gfni_affine256(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy_nt16_gfni_affine256(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc3_nt16_gfni_affine256(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc16_gfni_affine512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc16_gfni_affine512(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy16_gfni_affine512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi16_gfni_affine512(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout16_gfni_affine512(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_16_gfni_affine512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc_unaligned16_gfni_affine512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_unaligned16_gfni_affine512(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy_nt16_gfni_affine512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc3_nt16_gfni_affine512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+
+void maddrc16_lookup_avx512vbmi(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc16_lookup_avx512vbmi(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy16_lookup_avx512vbmi(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi16_lookup_avx512vbmi(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc3_16_lookup_avx512vbmi(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc_unaligned16_lookup_avx512vbmi(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_unaligned16_lookup_avx512vbmi(uint8_t *region, uint8_t constant, size_t length);
+
+void maddrc16_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc16_shuffle_avx512vl(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy16_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi16_shuffle_avx512vl(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout16_shuffle_avx512vl(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_16_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc_unaligned16_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_unaligned16_shuffle_avx512vl(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy_nt16_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc3_nt16_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+
+void maddrc16_gfni_affine_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc16_gfni_affine_avx512vl(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy16_gfni_affine_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi16_gfni_affine_avx512vl(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout16_gfni_affine_avx512vl(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_16_gfni_affine_avx512vl(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc_unaligned16_gfni_affine_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_unaligned16_gfni_affine_avx512vl(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy_nt16_gfni_affine_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc3_nt16_gfni_affine_avx512vl(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
 #endif
 
 #ifdef __arm__
@@ -58,6 +214,36 @@ void maddrc16_shuffle_neon_64(uint8_t *region1, const uint8_t *region2, uint8_t
 void maddrc16_imul_neon_64(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void maddrc16_imul_neon_128(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void mulrc16_shuffle_neon_64(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy16_shuffle_neon_64(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+
+void maddrc_multi16_shuffle_neon_64(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+
+void maddrc_fanout16_shuffle_neon_64(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+
+void maddrc3_16_shuffle_neon_64(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_16_imul_neon_64(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_16_imul_neon_128(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+
+void mulrr16_imul_neon_128(uint8_t *region1, const uint8_t *region2, size_t length);
+void maddrr16_imul_neon_128(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+
+void invr16_shuffle_neon_64(uint8_t *region, size_t length);
+void divr16_shuffle_neon_64(uint8_t *region1, const uint8_t *region2, size_t length);
+#endif
+
+#ifdef __aarch64__
+void maddrc16_shuffle_neon_128(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc16_shuffle_neon_128(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy16_shuffle_neon_128(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi16_shuffle_neon_128(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout16_shuffle_neon_128(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_16_shuffle_neon_128(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void invr16_shuffle_neon_128(uint8_t *region, size_t length);
+
+void maddrc16_shuffle_neon_sha3(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi16_shuffle_neon_sha3(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout16_shuffle_neon_sha3(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_16_shuffle_neon_sha3(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
 #endif
 
 #endif
@@ -41,6 +41,7 @@
 static const uint8_t pt[MOEPGF16_SIZE][MOEPGF16_EXPONENT] = MOEPGF16_POLYNOMIAL_DIV_TABLE;
 static const uint8_t tl[MOEPGF16_SIZE][16] = MOEPGF16_SHUFFLE_LOW_TABLE;
 static const uint8_t th[MOEPGF16_SIZE][16] = MOEPGF16_SHUFFLE_HIGH_TABLE;
+static const uint8_t inverses[MOEPGF16_SIZE] = MOEPGF16_INV_TABLE;
 
 void
 maddrc16_shuffle_avx2(uint8_t* region1, const uint8_t* region2,
@@ -160,3 +161,1014 @@ mulrc16_shuffle_avx2(uint8_t *region, uint8_t constant, size_t length)
 	}
 }
 
+void
+mulrc_copy16_shuffle_avx2(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m256i in, out, t1, t2, m1, m2, l, h;
+	register __m128i bc;
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = __builtin_ia32_vbroadcastsi256(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = __builtin_ia32_vbroadcastsi256(bc);
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	for (end=region1+length; region1<end; region1+=32, region2+=32) {
+		in = _mm256_load_si256((void *)region2);
+		l = _mm256_and_si256(in, m1);
+		l = _mm256_shuffle_epi8(t1, l);
+		h = _mm256_and_si256(in, m2);
+		h = _mm256_srli_epi64(h, 4);
+		h = _mm256_shuffle_epi8(t2, h);
+		out = _mm256_xor_si256(h, l);
+		_mm256_store_si256((void *)region1, out);
+	}
+}
+
+void
+maddrc_multi16_shuffle_avx2(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	size_t off;
+	int i;
+	register __m256i t1, t2, m1, m2, in, l, h, acc[4];
+	register __m128i bc;
+
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	for (off=0; off+128<=length; off+=128) {
+		acc[0] = _mm256_load_si256((void *)(region1+off));
+		acc[1] = _mm256_load_si256((void *)(region1+off+32));
+		acc[2] = _mm256_load_si256((void *)(region1+off+64));
+		acc[3] = _mm256_load_si256((void *)(region1+off+96));
+
+		for (i=0; i<count; i++) {
+			if (constants[i] == 0)
+				continue;
+
+			bc = _mm_load_si128((void *)tl[constants[i]]);
+			t1 = __builtin_ia32_vbroadcastsi256(bc);
+			bc = _mm_load_si128((void *)th[constants[i]]);
+			t2 = __builtin_ia32_vbroadcastsi256(bc);
+
+			in = _mm256_load_si256((void *)(regions[i]+off));
+			l = _mm256_and_si256(in, m1);
+			l = _mm256_shuffle_epi8(t1, l);
+			h = _mm256_and_si256(in, m2);
+			h = _mm256_srli_epi64(h, 4);
+			h = _mm256_shuffle_epi8(t2, h);
+			acc[0] = _mm256_xor_si256(acc[0], h);
+			acc[0] = _mm256_xor_si256(acc[0], l);
+
+			in = _mm256_load_si256((void *)(regions[i]+off+32));
+			l = _mm256_and_si256(in, m1);
+			l = _mm256_shuffle_epi8(t1, l);
+			h = _mm256_and_si256(in, m2);
+			h = _mm256_srli_epi64(h, 4);
+			h = _mm256_shuffle_epi8(t2, h);
+			acc[1] = _mm256_xor_si256(acc[1], h);
+			acc[1] = _mm256_xor_si256(acc[1], l);
+
+			in = _mm256_load_si256((void *)(regions[i]+off+64));
+			l = _mm256_and_si256(in, m1);
+			l = _mm256_shuffle_epi8(t1, l);
+			h = _mm256_and_si256(in, m2);
+			h = _mm256_srli_epi64(h, 4);
+			h = _mm256_shuffle_epi8(t2, h);
+			acc[2] = _mm256_xor_si256(acc[2], h);
+			acc[2] = _mm256_xor_si256(acc[2], l);
+
+			in = _mm256_load_si256((void *)(regions[i]+off+96));
+			l = _mm256_and_si256(in, m1);
+			l = _mm256_shuffle_epi8(t1, l);
+			h = _mm256_and_si256(in, m2);
+			h = _mm256_srli_epi64(h, 4);
+			h = _mm256_shuffle_epi8(t2, h);
+			acc[3] = _mm256_xor_si256(acc[3], h);
+			acc[3] = _mm256_xor_si256(acc[3], l);
+		}
+
+		_mm256_store_si256((void *)(region1+off), acc[0]);
+		_mm256_store_si256((void *)(region1+off+32), acc[1]);
+		_mm256_store_si256((void *)(region1+off+64), acc[2]);
+		_mm256_store_si256((void *)(region1+off+96), acc[3]);
+	}
+
+	for (; off<length; off+=32) {
+		acc[0] = _mm256_load_si256((void *)(region1+off));
+
+		for (i=0; i<count; i++) {
+			if (constants[i] == 0)
+				continue;
+
+			bc = _mm_load_si128((void *)tl[constants[i]]);
+			t1 = __builtin_ia32_vbroadcastsi256(bc);
+			bc = _mm_load_si128((void *)th[constants[i]]);
+			t2 = __builtin_ia32_vbroadcastsi256(bc);
+			in = _mm256_load_si256((void *)(regions[i]+off));
+			l = _mm256_and_si256(in, m1);
+			l = _mm256_shuffle_epi8(t1, l);
+			h = _mm256_and_si256(in, m2);
+			h = _mm256_srli_epi64(h, 4);
+			h = _mm256_shuffle_epi8(t2, h);
+			acc[0] = _mm256_xor_si256(acc[0], h);
+			acc[0] = _mm256_xor_si256(acc[0], l);
+		}
+
+		_mm256_store_si256((void *)(region1+off), acc[0]);
+	}
+}
+
+void
+maddrc_fanout16_shuffle_avx2(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	size_t off;
+	int i = 0;
+	uint8_t *r[4];
+	register __m256i t1[4], t2[4], m1, m2, in, l, h, out;
+	register __m128i bc;
+
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	for (; i+4<=count; i+=4) {
+		r[0] = regions[i];
+		r[1] = regions[i+1];
+		r[2] = regions[i+2];
+		r[3] = regions[i+3];
+		bc = _mm_load_si128((void *)tl[constants[i]]);
+		t1[0] = __builtin_ia32_vbroadcastsi256(bc);
+		bc = _mm_load_si128((void *)th[constants[i]]);
+		t2[0] = __builtin_ia32_vbroadcastsi256(bc);
+		bc = _mm_load_si128((void *)tl[constants[i+1]]);
+		t1[1] = __builtin_ia32_vbroadcastsi256(bc);
+		bc = _mm_load_si128((void *)th[constants[i+1]]);
+		t2[1] = __builtin_ia32_vbroadcastsi256(bc);
+		bc = _mm_load_si128((void *)tl[constants[i+2]]);
+		t1[2] = __builtin_ia32_vbroadcastsi256(bc);
+		bc = _mm_load_si128((void *)th[constants[i+2]]);
+		t2[2] = __builtin_ia32_vbroadcastsi256(bc);
+		bc = _mm_load_si128((void *)tl[constants[i+3]]);
+		t1[3] = __builtin_ia32_vbroadcastsi256(bc);
+		bc = _mm_load_si128((void *)th[constants[i+3]]);
+		t2[3] = __builtin_ia32_vbroadcastsi256(bc);
+
+		for (off=0; off<length; off+=32) {
+			in = _mm256_load_si256((void *)(region2+off));
+			l = _mm256_and_si256(in, m1);
+			h = _mm256_and_si256(in, m2);
+			h = _mm256_srli_epi64(h, 4);
+
+			out = _mm256_load_si256((void *)(r[0]+off));
+			out = _mm256_xor_si256(out, _mm256_shuffle_epi8(t1[0], l));
+			out = _mm256_xor_si256(out, _mm256_shuffle_epi8(t2[0], h));
+			_mm256_store_si256((void *)(r[0]+off), out);
+
+			out = _mm256_load_si256((void *)(r[1]+off));
+			out = _mm256_xor_si256(out, _mm256_shuffle_epi8(t1[1], l));
+			out = _mm256_xor_si256(out, _mm256_shuffle_epi8(t2[1], h));
+			_mm256_store_si256((void *)(r[1]+off), out);
+
+			out = _mm256_load_si256((void *)(r[2]+off));
+			out = _mm256_xor_si256(out, _mm256_shuffle_epi8(t1[2], l));
+			out = _mm256_xor_si256(out, _mm256_shuffle_epi8(t2[2], h));
+			_mm256_store_si256((void *)(r[2]+off), out);
+
+			out = _mm256_load_si256((void *)(r[3]+off));
+			out = _mm256_xor_si256(out, _mm256_shuffle_epi8(t1[3], l));
+			out = _mm256_xor_si256(out, _mm256_shuffle_epi8(t2[3], h));
+			_mm256_store_si256((void *)(r[3]+off), out);
+		}
+	}
+
+	for (; i<count; i++)
+		maddrc16_shuffle_avx2(regions[i], region2,
+						constants[i], length);
+}
+
+void
+maddrc3_16_shuffle_avx2(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m256i in1, in2, out, t1, t2, m1, m2, l, h;
+	register __m128i bc;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_avx2(region1, region2, region3, length);
+		return;
+	}
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = __builtin_ia32_vbroadcastsi256(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = __builtin_ia32_vbroadcastsi256(bc);
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	for (end=region1+length; region1<end;
+			region1+=32, region2+=32, region3+=32) {
+		in2 = _mm256_load_si256((void *)region3);
+		in1 = _mm256_load_si256((void *)region2);
+		l = _mm256_and_si256(in2, m1);
+		l = _mm256_shuffle_epi8(t1, l);
+		h = _mm256_and_si256(in2, m2);
+		h = _mm256_srli_epi64(h, 4);
+		h = _mm256_shuffle_epi8(t2, h);
+		out = _mm256_xor_si256(h,l);
+		out = _mm256_xor_si256(out, in1);
+		_mm256_store_si256((void *)region1, out);
+	}
+}
+
+void
+maddrc3_16_imul_avx2(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m256i reg1, reg2, ri[4], sp[4], mi[4];
+	const uint8_t *p = pt[constant];
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_avx2(region1, region2, region3, length);
+		return;
+	}
+	
+	mi[0] = _mm256_set1_epi8(0x11);
+	mi[1] = _mm256_set1_epi8(0x22);
+	mi[2] = _mm256_set1_epi8(0x44);
+	mi[3] = _mm256_set1_epi8(0x88);
+	sp[0] = _mm256_set1_epi16(p[0]);
+	sp[1] = _mm256_set1_epi16(p[1]);
+	sp[2] = _mm256_set1_epi16(p[2]);
+	sp[3] = _mm256_set1_epi16(p[3]);
+
+	for (end=region1+length; region1<end;
+			region1+=32, region2+=32, region3+=32) {
+		reg2 = _mm256_load_si256((void *)region3);
+		reg1 = _mm256_load_si256((void *)region2);
+		ri[0] = _mm256_and_si256(reg2, mi[0]);
+		ri[1] = _mm256_and_si256(reg2, mi[1]);
+		ri[2] = _mm256_and_si256(reg2, mi[2]);
+		ri[3] = _mm256_and_si256(reg2, mi[3]);
+		ri[1] = _mm256_srli_epi16(ri[1], 1);
+		ri[2] = _mm256_srli_epi16(ri[2], 2);
+		ri[3] = _mm256_srli_epi16(ri[3], 3);
+		ri[0] = _mm256_mullo_epi16(ri[0], sp[0]);
+		ri[1] = _mm256_mullo_epi16(ri[1], sp[1]);
+		ri[2] = _mm256_mullo_epi16(ri[2], sp[2]);
+		ri[3] = _mm256_mullo_epi16(ri[3], sp[3]);
+		ri[0] = _mm256_xor_si256(ri[0], ri[1]);
+		ri[2] = _mm256_xor_si256(ri[2], ri[3]);
+		ri[0] = _mm256_xor_si256(ri[0], ri[2]);
+		ri[0] = _mm256_xor_si256(ri[0], reg1);
+		_mm256_store_si256((void *)region1, ri[0]);
+	}
+}
+
+void
+mulrr16_imul_avx2(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	int i;
+	register __m256i a, b, t, acc, l, nl, p;
+
+	l = _mm256_set1_epi8(0x11);
+	nl = _mm256_set1_epi8(0xee);
+	p = _mm256_set1_epi8((MOEPGF16_POLYNOMIAL & MOEPGF16_MASK) * 0x11);
+
+	for (end=region1+length; region1<end; region1+=32, region2+=32) {
+		a = _mm256_load_si256((void *)region1);
+		b = _mm256_load_si256((void *)region2);
+		acc = _mm256_setzero_si256();
+
+		for (i=0; i<MOEPGF16_EXPONENT; i++) {
+			t = _mm256_and_si256(b, l);
+			t = _mm256_sub_epi16(_mm256_slli_epi16(t, 4), t);
+			t = _mm256_and_si256(t, a);
+			acc = _mm256_xor_si256(acc, t);
+			b = _mm256_srli_epi16(b, 1);
+
+			t = _mm256_srli_epi16(a, 3);
+			t = _mm256_and_si256(t, l);
+			t = _mm256_sub_epi16(_mm256_slli_epi16(t, 4), t);
+			t = _mm256_and_si256(t, p);
+			a = _mm256_slli_epi16(a, 1);
+			a = _mm256_and_si256(a, nl);
+			a = _mm256_xor_si256(a, t);
+		}
+
+		_mm256_store_si256((void *)region1, acc);
+	}
+}
+
+void
+maddrr16_imul_avx2(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, size_t length)
+{
+	uint8_t *end;
+	int i;
+	register __m256i a, b, t, acc, l, nl, p;
+
+	l = _mm256_set1_epi8(0x11);
+	nl = _mm256_set1_epi8(0xee);
+	p = _mm256_set1_epi8((MOEPGF16_POLYNOMIAL & MOEPGF16_MASK) * 0x11);
+
+	for (end=region1+length; region1<end;
+			region1+=32, region2+=32, region3+=32) {
+		a = _mm256_load_si256((void *)region2);
+		b = _mm256_load_si256((void *)region3);
+		acc = _mm256_load_si256((void *)region1);
+
+		for (i=0; i<MOEPGF16_EXPONENT; i++) {
+			t = _mm256_and_si256(b, l);
+			t = _mm256_sub_epi16(_mm256_slli_epi16(t, 4), t);
+			t = _mm256_and_si256(t, a);
+			acc = _mm256_xor_si256(acc, t);
+			b = _mm256_srli_epi16(b, 1);
+
+			t = _mm256_srli_epi16(a, 3);
+			t = _mm256_and_si256(t, l);
+			t = _mm256_sub_epi16(_mm256_slli_epi16(t, 4), t);
+			t = _mm256_and_si256(t, p);
+			a = _mm256_slli_epi16(a, 1);
+			a = _mm256_and_si256(a, nl);
+			a = _mm256_xor_si256(a, t);
+		}
+
+		_mm256_store_si256((void *)region1, acc);
+	}
+}
+
+void
+invr16_shuffle_avx2(uint8_t *region, size_t length)
+{
+	uint8_t *end;
+	register __m256i t1, t2, m1, m2, l, h;
+	register __m256i in;
+	register __m128i bc;
+
+	bc = _mm_loadu_si128((void *)(inverses));
+	t1 = __builtin_ia32_vbroadcastsi256(bc);
+	t2 = _mm256_slli_epi64(t1, 4);
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	for (end=region+length; region<end; region+=32) {
+		in = _mm256_load_si256((void *)region);
+		l = _mm256_and_si256(in, m1);
+		l = _mm256_shuffle_epi8(t1, l);
+		h = _mm256_and_si256(in, m2);
+		h = _mm256_srli_epi64(h, 4);
+		h = _mm256_shuffle_epi8(t2, h);
+		in = _mm256_or_si256(h, l);
+		_mm256_store_si256((void *)region, in);
+	}
+}
+
+void
+divr16_shuffle_avx2(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	int i;
+	register __m256i t1, t2, m1, m2, l, h;
+	register __m256i a, b, t, acc, bl, nl, p;
+	register __m128i bc;
+
+	bc = _mm_loadu_si128((void *)(inverses));
+	t1 = __builtin_ia32_vbroadcastsi256(bc);
+	t2 = _mm256_slli_epi64(t1, 4);
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+	bl = _mm256_set1_epi8(0x11);
+	nl = _mm256_set1_epi8(0xee);
+	p = _mm256_set1_epi8((MOEPGF16_POLYNOMIAL & MOEPGF16_MASK) * 0x11);
+
+	for (end=region1+length; region1<end; region1+=32, region2+=32) {
+		a = _mm256_load_si256((void *)region1);
+		b = _mm256_load_si256((void *)region2);
+		l = _mm256_and_si256(b, m1);
+		l = _mm256_shuffle_epi8(t1, l);
+		h = _mm256_and_si256(b, m2);
+		h = _mm256_srli_epi64(h, 4);
+		h = _mm256_shuffle_epi8(t2, h);
+		b = _mm256_or_si256(h, l);
+
+		acc = _mm256_setzero_si256();
+		for (i=0; i<MOEPGF16_EXPONENT; i++) {
+			t = _mm256_and_si256(b, bl);
+			t = _mm256_sub_epi16(_mm256_slli_epi16(t, 4), t);
+			t = _mm256_and_si256(t, a);
+			acc = _mm256_xor_si256(acc, t);
+			b = _mm256_srli_epi16(b, 1);
+
+			t = _mm256_srli_epi16(a, 3);
+			t = _mm256_and_si256(t, bl);
+			t = _mm256_sub_epi16(_mm256_slli_epi16(t, 4), t);
+			t = _mm256_and_si256(t, p);
+			a = _mm256_slli_epi16(a, 1);
+			a = _mm256_and_si256(a, nl);
+			a = _mm256_xor_si256(a, t);
+		}
+
+		_mm256_store_si256((void *)region1, acc);
+	}
+}
+
+void
+maddrc_unaligned16_shuffle_avx2(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	size_t rem;
+	register __m256i t1, t2, m1, m2, in1, in2, out, l, h;
+	register __m256i tail;
+	register __m128i bc;
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_unaligned_avx2(region1, region2, length);
+		return;
+	}
+
+	if (length < 32) {
+		maddrc16_flat_table(region1, region2, constant, length);
+		return;
+	}
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = __builtin_ia32_vbroadcastsi256(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = __builtin_ia32_vbroadcastsi256(bc);
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	/* The last, possibly overlapping vector is computed before the main loop
+	 * modifies region1 and stored after it. */
+	in2 = _mm256_loadu_si256((void *)(region2+length-32));
+	in1 = _mm256_loadu_si256((void *)(region1+length-32));
+	l = _mm256_and_si256(in2, m1);
+	l = _mm256_shuffle_epi8(t1, l);
+	h = _mm256_and_si256(in2, m2);
+	h = _mm256_srli_epi64(h, 4);
+	h = _mm256_shuffle_epi8(t2, h);
+	tail = _mm256_xor_si256(h, l);
+	tail = _mm256_xor_si256(tail, in1);
+	rem = length % 32;
+
+	for (end=region1+length-rem; region1<end; region1+=32, region2+=32) {
+		in2 = _mm256_loadu_si256((void *)region2);
+		in1 = _mm256_loadu_si256((void *)region1);
+		l = _mm256_and_si256(in2, m1);
+		l = _mm256_shuffle_epi8(t1, l);
+		h = _mm256_and_si256(in2, m2);
+		h = _mm256_srli_epi64(h, 4);
+		h = _mm256_shuffle_epi8(t2, h);
+		out = _mm256_xor_si256(h, l);
+		out = _mm256_xor_si256(out, in1);
+		_mm256_storeu_si256((void *)region1, out);
+	}
+
+	_mm256_storeu_si256((void *)(region1+rem-32), tail);
+}
+
+void
+mulrc_unaligned16_shuffle_avx2(uint8_t *region, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	size_t rem;
+	register __m256i t1, t2, m1, m2, in, out, l, h;
+	register __m256i tail;
+	register __m128i bc;
+
+	if (constant == 0) {
+		memset(region, 0, length);
+		return;
+	}
+
+	if (constant == 1)
+		return;
+
+	if (length < 32) {
+		mulrc16_imul_scalar(region, constant, length);
+		return;
+	}
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = __builtin_ia32_vbroadcastsi256(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = __builtin_ia32_vbroadcastsi256(bc);
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	/* The last, possibly overlapping vector is computed before the main loop
+	 * modifies region and stored after it. */
+	in = _mm256_loadu_si256((void *)(region+length-32));
+	l = _mm256_and_si256(in, m1);
+	l = _mm256_shuffle_epi8(t1, l);
+	h = _mm256_and_si256(in, m2);
+	h = _mm256_srli_epi64(h, 4);
+	h = _mm256_shuffle_epi8(t2, h);
+	tail = _mm256_xor_si256(h, l);
+	rem = length % 32;
+
+	for (end=region+length-rem; region<end; region+=32) {
+		in = _mm256_loadu_si256((void *)region);
+		l = _mm256_and_si256(in, m1);
+		l = _mm256_shuffle_epi8(t1, l);
+		h = _mm256_and_si256(in, m2);
+		h = _mm256_srli_epi64(h, 4);
+		h = _mm256_shuffle_epi8(t2, h);
+		out = _mm256_xor_si256(h, l);
+		_mm256_storeu_si256((void *)region, out);
+	}
+
+	_mm256_storeu_si256((void *)(region+rem-32), tail);
+}
+
+void
+mulrc_copy_nt16_shuffle_avx2(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m256i in, out, t1, t2, m1, m2, l, h;
+	register __m128i bc;
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = __builtin_ia32_vbroadcastsi256(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = __builtin_ia32_vbroadcastsi256(bc);
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	for (end=region1+length; region1<end; region1+=32, region2+=32) {
+		in = _mm256_load_si256((void *)region2);
+		l = _mm256_and_si256(in, m1);
+		l = _mm256_shuffle_epi8(t1, l);
+		h = _mm256_and_si256(in, m2);
+		h = _mm256_srli_epi64(h, 4);
+		h = _mm256_shuffle_epi8(t2, h);
+		out = _mm256_xor_si256(h, l);
+		_mm256_stream_si256((void *)region1, out);
+	}
+
+	_mm_sfence();
+}
+
+void
+maddrc3_nt16_shuffle_avx2(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m256i in1, in2, out, t1, t2, m1, m2, l, h;
+	register __m128i bc;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_avx2(region1, region2, region3, length);
+		return;
+	}
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = __builtin_ia32_vbroadcastsi256(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = __builtin_ia32_vbroadcastsi256(bc);
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	for (end=region1+length; region1<end;
+			region1+=32, region2+=32, region3+=32) {
+		in2 = _mm256_load_si256((void *)region3);
+		in1 = _mm256_load_si256((void *)region2);
+		l = _mm256_and_si256(in2, m1);
+		l = _mm256_shuffle_epi8(t1, l);
+		h = _mm256_and_si256(in2, m2);
+		h = _mm256_srli_epi64(h, 4);
+		h = _mm256_shuffle_epi8(t2, h);
+		out = _mm256_xor_si256(h,l);
+		out = _mm256_xor_si256(out, in1);
+		_mm256_stream_si256((void *)region1, out);
+	}
+
+	_mm_sfence();
+}
+
+void
+maddrc16_shuffle_avx2_x2(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m256i t1, t2, m1, m2;
+	register __m256i in1[2], in2[2], out[2], l[2], h[2];
+	register __m128i bc;
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_avx2(region1, region2, length);
+		return;
+	}
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = __builtin_ia32_vbroadcastsi256(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = __builtin_ia32_vbroadcastsi256(bc);
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	for (end=region1+(length & ~(size_t)63); region1<end; region1+=64, region2+=64) {
+		in2[0] = _mm256_load_si256((void *)region2);
+		in2[1] = _mm256_load_si256((void *)(region2+32));
+		in1[0] = _mm256_load_si256((void *)region1);
+		in1[1] = _mm256_load_si256((void *)(region1+32));
+		l[0] = _mm256_and_si256(in2[0], m1);
+		l[1] = _mm256_and_si256(in2[1], m1);
+		l[0] = _mm256_shuffle_epi8(t1, l[0]);
+		l[1] = _mm256_shuffle_epi8(t1, l[1]);
+		h[0] = _mm256_and_si256(in2[0], m2);
+		h[1] = _mm256_and_si256(in2[1], m2);
+		h[0] = _mm256_srli_epi64(h[0], 4);
+		h[1] = _mm256_srli_epi64(h[1], 4);
+		h[0] = _mm256_shuffle_epi8(t2, h[0]);
+		h[1] = _mm256_shuffle_epi8(t2, h[1]);
+		out[0] = _mm256_xor_si256(h[0], l[0]);
+		out[1] = _mm256_xor_si256(h[1], l[1]);
+		out[0] = _mm256_xor_si256(out[0], in1[0]);
+		out[1] = _mm256_xor_si256(out[1], in1[1]);
+		_mm256_store_si256((void *)region1, out[0]);
+		_mm256_store_si256((void *)(region1+32), out[1]);
+	}
+	for (end=region1+(length & 63); region1<end; region1+=32, region2+=32) {
+		in2[0] = _mm256_load_si256((void *)region2);
+		in1[0] = _mm256_load_si256((void *)region1);
+		l[0] = _mm256_and_si256(in2[0], m1);
+		l[0] = _mm256_shuffle_epi8(t1, l[0]);
+		h[0] = _mm256_and_si256(in2[0], m2);
+		h[0] = _mm256_srli_epi64(h[0], 4);
+		h[0] = _mm256_shuffle_epi8(t2, h[0]);
+		out[0] = _mm256_xor_si256(h[0], l[0]);
+		out[0] = _mm256_xor_si256(out[0], in1[0]);
+		_mm256_store_si256((void *)region1, out[0]);
+	}
+}
+
+void
+mulrc16_shuffle_avx2_x2(uint8_t *region, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m256i t1, t2, m1, m2;
+	register __m256i in[2], out[2], l[2], h[2];
+	register __m128i bc;
+
+	if (constant == 0) {
+		memset(region, 0, length);
+		return;
+	}
+
+	if (constant == 1)
+		return;
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = __builtin_ia32_vbroadcastsi256(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = __builtin_ia32_vbroadcastsi256(bc);
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	for (end=region+(length & ~(size_t)63); region<end; region+=64) {
+		in[0] = _mm256_load_si256((void *)region);
+		in[1] = _mm256_load_si256((void *)(region+32));
+		l[0] = _mm256_and_si256(in[0], m1);
+		l[1] = _mm256_and_si256(in[1], m1);
+		l[0] = _mm256_shuffle_epi8(t1, l[0]);
+		l[1] = _mm256_shuffle_epi8(t1, l[1]);
+		h[0] = _mm256_and_si256(in[0], m2);
+		h[1] = _mm256_and_si256(in[1], m2);
+		h[0] = _mm256_srli_epi64(h[0], 4);
+		h[1] = _mm256_srli_epi64(h[1], 4);
+		h[0] = _mm256_shuffle_epi8(t2, h[0]);
+		h[1] = _mm256_shuffle_epi8(t2, h[1]);
+		out[0] = _mm256_xor_si256(h[0], l[0]);
+		out[1] = _mm256_xor_si256(h[1], l[1]);
+		_mm256_store_si256((void *)region, out[0]);
+		_mm256_store_si256((void *)(region+32), out[1]);
+	}
+	for (end=region+(length & 63); region<end; region+=32) {
+		in[0] = _mm256_load_si256((void *)region);
+		l[0] = _mm256_and_si256(in[0], m1);
+		l[0] = _mm256_shuffle_epi8(t1, l[0]);
+		h[0] = _mm256_and_si256(in[0], m2);
+		h[0] = _mm256_srli_epi64(h[0], 4);
+		h[0] = _mm256_shuffle_epi8(t2, h[0]);
+		out[0] = _mm256_xor_si256(h[0], l[0]);
+		_mm256_store_si256((void *)region, out[0]);
+	}
+}
+
+void
+maddrc16_shuffle_avx2_x4(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m256i t1, t2, m1, m2;
+	register __m256i in1[4], in2[4], out[4], l[4], h[4];
+	register __m128i bc;
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_avx2(region1, region2, length);
+		return;
+	}
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = __builtin_ia32_vbroadcastsi256(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = __builtin_ia32_vbroadcastsi256(bc);
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	for (end=region1+(length & ~(size_t)127); region1<end; region1+=128, region2+=128) {
+		in2[0] = _mm256_load_si256((void *)region2);
+		in2[1] = _mm256_load_si256((void *)(region2+32));
+		in2[2] = _mm256_load_si256((void *)(region2+64));
+		in2[3] = _mm256_load_si256((void *)(region2+96));
+		in1[0] = _mm256_load_si256((void *)region1);
+		in1[1] = _mm256_load_si256((void *)(region1+32));
+		in1[2] = _mm256_load_si256((void *)(region1+64));
+		in1[3] = _mm256_load_si256((void *)(region1+96));
+		l[0] = _mm256_and_si256(in2[0], m1);
+		l[1] = _mm256_and_si256(in2[1], m1);
+		l[2] = _mm256_and_si256(in2[2], m1);
+		l[3] = _mm256_and_si256(in2[3], m1);
+		l[0] = _mm256_shuffle_epi8(t1, l[0]);
+		l[1] = _mm256_shuffle_epi8(t1, l[1]);
+		l[2] = _mm256_shuffle_epi8(t1, l[2]);
+		l[3] = _mm256_shuffle_epi8(t1, l[3]);
+		h[0] = _mm256_and_si256(in2[0], m2);
+		h[1] = _mm256_and_si256(in2[1], m2);
+		h[2] = _mm256_and_si256(in2[2], m2);
+		h[3] = _mm256_and_si256(in2[3], m2);
+		h[0] = _mm256_srli_epi64(h[0], 4);
+		h[1] = _mm256_srli_epi64(h[1], 4);
+		h[2] = _mm256_srli_epi64(h[2], 4);
+		h[3] = _mm256_srli_epi64(h[3], 4);
+		h[0] = _mm256_shuffle_epi8(t2, h[0]);
+		h[1] = _mm256_shuffle_epi8(t2, h[1]);
+		h[2] = _mm256_shuffle_epi8(t2, h[2]);
+		h[3] = _mm256_shuffle_epi8(t2, h[3]);
+		out[0] = _mm256_xor_si256(h[0], l[0]);
+		out[1] = _mm256_xor_si256(h[1], l[1]);
+		out[2] = _mm256_xor_si256(h[2], l[2]);
+		out[3] = _mm256_xor_si256(h[3], l[3]);
+		out[0] = _mm256_xor_si256(out[0], in1[0]);
+		out[1] = _mm256_xor_si256(out[1], in1[1]);
+		out[2] = _mm256_xor_si256(out[2], in1[2]);
+		out[3] = _mm256_xor_si256(out[3], in1[3]);
+		_mm256_store_si256((void *)region1, out[0]);
+		_mm256_store_si256((void *)(region1+32), out[1]);
+		_mm256_store_si256((void *)(region1+64), out[2]);
+		_mm256_store_si256((void *)(region1+96), out[3]);
+	}
+	for (end=region1+(length & 127); region1<end; region1+=32, region2+=32) {
+		in2[0] = _mm256_load_si256((void *)region2);
+		in1[0] = _mm256_load_si256((void *)region1);
+		l[0] = _mm256_and_si256(in2[0], m1);
+		l[0] = _mm256_shuffle_epi8(t1, l[0]);
+		h[0] = _mm256_and_si256(in2[0], m2);
+		h[0] = _mm256_srli_epi64(h[0], 4);
+		h[0] = _mm256_shuffle_epi8(t2, h[0]);
+		out[0] = _mm256_xor_si256(h[0], l[0]);
+		out[0] = _mm256_xor_si256(out[0], in1[0]);
+		_mm256_store_si256((void *)region1, out[0]);
+	}
+}
+
+void
+mulrc16_shuffle_avx2_x4(uint8_t *region, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m256i t1, t2, m1, m2;
+	register __m256i in[4], out[4], l[4], h[4];
+	register __m128i bc;
+
+	if (constant == 0) {
+		memset(region, 0, length);
+		return;
+	}
+
+	if (constant == 1)
+		return;
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = __builtin_ia32_vbroadcastsi256(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = __builtin_ia32_vbroadcastsi256(bc);
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	for (end=region+(length & ~(size_t)127); region<end; region+=128) {
+		in[0] = _mm256_load_si256((void *)region);
+		in[1] = _mm256_load_si256((void *)(region+32));
+		in[2] = _mm256_load_si256((void *)(region+64));
+		in[3] = _mm256_load_si256((void *)(region+96));
+		l[0] = _mm256_and_si256(in[0], m1);
+		l[1] = _mm256_and_si256(in[1], m1);
+		l[2] = _mm256_and_si256(in[2], m1);
+		l[3] = _mm256_and_si256(in[3], m1);
+		l[0] = _mm256_shuffle_epi8(t1, l[0]);
+		l[1] = _mm256_shuffle_epi8(t1, l[1]);
+		l[2] = _mm256_shuffle_epi8(t1, l[2]);
+		l[3] = _mm256_shuffle_epi8(t1, l[3]);
+		h[0] = _mm256_and_si256(in[0], m2);
+		h[1] = _mm256_and_si256(in[1], m2);
+		h[2] = _mm256_and_si256(in[2], m2);
+		h[3] = _mm256_and_si256(in[3], m2);
+		h[0] = _mm256_srli_epi64(h[0], 4);
+		h[1] = _mm256_srli_epi64(h[1], 4);
+		h[2] = _mm256_srli_epi64(h[2], 4);
+		h[3] = _mm256_srli_epi64(h[3], 4);
+		h[0] = _mm256_shuffle_epi8(t2, h[0]);
+		h[1] = _mm256_shuffle_epi8(t2, h[1]);
+		h[2] = _mm256_shuffle_epi8(t2, h[2]);
+		h[3] = _mm256_shuffle_epi8(t2, h[3]);
+		out[0] = _mm256_xor_si256(h[0], l[0]);
+		out[1] = _mm256_xor_si256(h[1], l[1]);
+		out[2] = _mm256_xor_si256(h[2], l[2]);
+		out[3] = _mm256_xor_si256(h[3], l[3]);
+		_mm256_store_si256((void *)region, out[0]);
+		_mm256_store_si256((void *)(region+32), out[1]);
+		_mm256_store_si256((void *)(region+64), out[2]);
+		_mm256_store_si256((void *)(region+96), out[3]);
+	}
+	for (end=region+(length & 127); region<end; region+=32) {
+		in[0] = _mm256_load_si256((void *)region);
+		l[0] = _mm256_and_si256(in[0], m1);
+		l[0] = _mm256_shuffle_epi8(t1, l[0]);
+		h[0] = _mm256_and_si256(in[0], m2);
+		h[0] = _mm256_srli_epi64(h[0], 4);
+		h[0] = _mm256_shuffle_epi8(t2, h[0]);
+		out[0] = _mm256_xor_si256(h[0], l[0]);
+		_mm256_store_si256((void *)region, out[0]);
+	}
+}
+
+void
+maddrc_prefetch16_shuffle_avx2(uint8_t *region1, const uint8_t *region2,
+			uint8_t constant, size_t length, size_t distance)
+{
+	uint8_t *end;
+	register __m256i t1, t2, m1, m2;
+	register __m256i in1[2], in2[2], out[2], l[2], h[2];
+	register __m128i bc;
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_prefetch_avx2(region1, region2, length, distance);
+		return;
+	}
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = __builtin_ia32_vbroadcastsi256(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = __builtin_ia32_vbroadcastsi256(bc);
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	for (end=region1+(length & ~(size_t)63); region1<end; region1+=64, region2+=64) {
+		_mm_prefetch((const char *)(region2+distance), _MM_HINT_T0);
+		_mm_prefetch((const char *)(region1+distance), _MM_HINT_T0);
+		in2[0] = _mm256_load_si256((void *)region2);
+		in2[1] = _mm256_load_si256((void *)(region2+32));
+		in1[0] = _mm256_load_si256((void *)region1);
+		in1[1] = _mm256_load_si256((void *)(region1+32));
+		l[0] = _mm256_and_si256(in2[0], m1);
+		l[1] = _mm256_and_si256(in2[1], m1);
+		l[0] = _mm256_shuffle_epi8(t1, l[0]);
+		l[1] = _mm256_shuffle_epi8(t1, l[1]);
+		h[0] = _mm256_and_si256(in2[0], m2);
+		h[1] = _mm256_and_si256(in2[1], m2);
+		h[0] = _mm256_srli_epi64(h[0], 4);
+		h[1] = _mm256_srli_epi64(h[1], 4);
+		h[0] = _mm256_shuffle_epi8(t2, h[0]);
+		h[1] = _mm256_shuffle_epi8(t2, h[1]);
+		out[0] = _mm256_xor_si256(h[0], l[0]);
+		out[1] = _mm256_xor_si256(h[1], l[1]);
+		out[0] = _mm256_xor_si256(out[0], in1[0]);
+		out[1] = _mm256_xor_si256(out[1], in1[1]);
+		_mm256_store_si256((void *)region1, out[0]);
+		_mm256_store_si256((void *)(region1+32), out[1]);
+	}
+	for (end=region1+(length & 63); region1<end; region1+=32, region2+=32) {
+		in2[0] = _mm256_load_si256((void *)region2);
+		in1[0] = _mm256_load_si256((void *)region1);
+		l[0] = _mm256_and_si256(in2[0], m1);
+		l[0] = _mm256_shuffle_epi8(t1, l[0]);
+		h[0] = _mm256_and_si256(in2[0], m2);
+		h[0] = _mm256_srli_epi64(h[0], 4);
+		h[0] = _mm256_shuffle_epi8(t2, h[0]);
+		out[0] = _mm256_xor_si256(h[0], l[0]);
+		out[0] = _mm256_xor_si256(out[0], in1[0]);
+		_mm256_store_si256((void *)region1, out[0]);
+	}
+}
+
+void
+mulrc_prefetch16_shuffle_avx2(uint8_t *region, uint8_t constant, size_t length,
+							size_t distance)
+{
+	uint8_t *end;
+	register __m256i t1, t2, m1, m2;
+	register __m256i in[2], out[2], l[2], h[2];
+	register __m128i bc;
+
+	if (constant == 0) {
+		memset(region, 0, length);
+		return;
+	}
+
+	if (constant == 1)
+		return;
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = __builtin_ia32_vbroadcastsi256(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = __builtin_ia32_vbroadcastsi256(bc);
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	for (end=region+(length & ~(size_t)63); region<end; region+=64) {
+		_mm_prefetch((const char *)(region+distance), _MM_HINT_T0);
+		in[0] = _mm256_load_si256((void *)region);
+		in[1] = _mm256_load_si256((void *)(region+32));
+		l[0] = _mm256_and_si256(in[0], m1);
+		l[1] = _mm256_and_si256(in[1], m1);
+		l[0] = _mm256_shuffle_epi8(t1, l[0]);
+		l[1] = _mm256_shuffle_epi8(t1, l[1]);
+		h[0] = _mm256_and_si256(in[0], m2);
+		h[1] = _mm256_and_si256(in[1], m2);
+		h[0] = _mm256_srli_epi64(h[0], 4);
+		h[1] = _mm256_srli_epi64(h[1], 4);
+		h[0] = _mm256_shuffle_epi8(t2, h[0]);
+		h[1] = _mm256_shuffle_epi8(t2, h[1]);
+		out[0] = _mm256_xor_si256(h[0], l[0]);
+		out[1] = _mm256_xor_si256(h[1], l[1]);
+		_mm256_store_si256((void *)region, out[0]);
+		_mm256_store_si256((void *)(region+32), out[1]);
+	}
+	for (end=region+(length & 63); region<end; region+=32) {
+		in[0] = _mm256_load_si256((void *)region);
+		l[0] = _mm256_and_si256(in[0], m1);
+		l[0] = _mm256_shuffle_epi8(t1, l[0]);
+		h[0] = _mm256_and_si256(in[0], m2);
+		h[0] = _mm256_srli_epi64(h[0], 4);
+		h[0] = _mm256_shuffle_epi8(t2, h[0]);
+		out[0] = _mm256_xor_si256(h[0], l[0]);
+		_mm256_store_si256((void *)region, out[0]);
+	}
+}
@@ -132,3 +132,173 @@ mulrc16_imul_avx512(uint8_t *region, uint8_t constant, size_t length)
 	}
 }
 
+void
+mulrc_copy16_imul_avx512(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m512i reg, ri[4], sp[4], mi[4];
+	const uint8_t *p = pt[constant];
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	mi[0] = _mm512_set1_epi8(0x11);
+	mi[1] = _mm512_set1_epi8(0x22);
+	mi[2] = _mm512_set1_epi8(0x44);
+	mi[3] = _mm512_set1_epi8(0x88);
+	sp[0] = _mm512_set1_epi32(p[0]);
+	sp[1] = _mm512_set1_epi32(p[1]);
+	sp[2] = _mm512_set1_epi32(p[2]);
+	sp[3] = _mm512_set1_epi32(p[3]);
+
+	for (end=region1+length; region1<end; region1+=64, region2+=64) {
+		reg = _mm512_load_si512((void *)region2);
+		ri[0] = _mm512_and_si512(reg, mi[0]);
+		ri[1] = _mm512_and_si512(reg, mi[1]);
+		ri[2] = _mm512_and_si512(reg, mi[2]);
+		ri[3] = _mm512_and_si512(reg, mi[3]);
+		ri[1] = _mm512_srli_epi32(ri[1], 1);
+		ri[2] = _mm512_srli_epi32(ri[2], 2);
+		ri[3] = _mm512_srli_epi32(ri[3], 3);
+		ri[0] = _mm512_mullo_epi32(ri[0], sp[0]);
+		ri[1] = _mm512_mullo_epi32(ri[1], sp[1]);
+		ri[2] = _mm512_mullo_epi32(ri[2], sp[2]);
+		ri[3] = _mm512_mullo_epi32(ri[3], sp[3]);
+		ri[0] = _mm512_xor_si512(ri[0], ri[1]);
+		ri[2] = _mm512_xor_si512(ri[2], ri[3]);
+		ri[0] = _mm512_xor_si512(ri[0], ri[2]);
+		_mm512_store_si512((void *)region1, ri[0]);
+	}
+}
+
+void
+maddrc3_16_imul_avx512(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m512i reg1, reg2, ri[4], sp[4], mi[4];
+	const uint8_t *p = pt[constant];
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_avx512(region1, region2, region3, length);
+		return;
+	}
+
+	mi[0] = _mm512_set1_epi8(0x11);
+	mi[1] = _mm512_set1_epi8(0x22);
+	mi[2] = _mm512_set1_epi8(0x44);
+	mi[3] = _mm512_set1_epi8(0x88);
+	sp[0] = _mm512_set1_epi32(p[0]);
+	sp[1] = _mm512_set1_epi32(p[1]);
+	sp[2] = _mm512_set1_epi32(p[2]);
+	sp[3] = _mm512_set1_epi32(p[3]);
+
+	for (end=region1+length; region1<end;
+			region1+=64, region2+=64, region3+=64) {
+		reg2 = _mm512_load_si512((void *)region3);
+		reg1 = _mm512_load_si512((void *)region2);
+		ri[0] = _mm512_and_si512(reg2, mi[0]);
+		ri[1] = _mm512_and_si512(reg2, mi[1]);
+		ri[2] = _mm512_and_si512(reg2, mi[2]);
+		ri[3] = _mm512_and_si512(reg2, mi[3]);
+		ri[1] = _mm512_srli_epi32(ri[1], 1);
+		ri[2] = _mm512_srli_epi32(ri[2], 2);
+		ri[3] = _mm512_srli_epi32(ri[3], 3);
+		ri[0] = _mm512_mullo_epi32(ri[0], sp[0]);
+		ri[1] = _mm512_mullo_epi32(ri[1], sp[1]);
+		ri[2] = _mm512_mullo_epi32(ri[2], sp[2]);
+		ri[3] = _mm512_mullo_epi32(ri[3], sp[3]);
+		ri[0] = _mm512_xor_si512(ri[0], ri[1]);
+		ri[2] = _mm512_xor_si512(ri[2], ri[3]);
+		ri[0] = _mm512_xor_si512(ri[0], ri[2]);
+		ri[0] = _mm512_xor_si512(ri[0], reg1);
+		_mm512_store_si512((void *)region1, ri[0]);
+	}
+}
+
+void
+mulrr16_imul_avx512(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	int i;
+	register __m512i a, b, t, acc, l, nl, p;
+
+	l = _mm512_set1_epi8(0x11);
+	nl = _mm512_set1_epi8(0xee);
+	p = _mm512_set1_epi8((MOEPGF16_POLYNOMIAL & MOEPGF16_MASK) * 0x11);
+
+	for (end=region1+length; region1<end; region1+=64, region2+=64) {
+		a = _mm512_load_si512((void *)region1);
+		b = _mm512_load_si512((void *)region2);
+		acc = _mm512_setzero_si512();
+
+		for (i=0; i<MOEPGF16_EXPONENT; i++) {
+			t = _mm512_and_si512(b, l);
+			t = _mm512_sub_epi32(_mm512_slli_epi32(t, 4), t);
+			t = _mm512_and_si512(t, a);
+			acc = _mm512_xor_si512(acc, t);
+			b = _mm512_srli_epi32(b, 1);
+
+			t = _mm512_srli_epi32(a, 3);
+			t = _mm512_and_si512(t, l);
+			t = _mm512_sub_epi32(_mm512_slli_epi32(t, 4), t);
+			t = _mm512_and_si512(t, p);
+			a = _mm512_slli_epi32(a, 1);
+			a = _mm512_and_si512(a, nl);
+			a = _mm512_xor_si512(a, t);
+		}
+
+		_mm512_store_si512((void *)region1, acc);
+	}
+}
+
+void
+maddrr16_imul_avx512(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, size_t length)
+{
+	uint8_t *end;
+	int i;
+	register __m512i a, b, t, acc, l, nl, p;
+
+	l = _mm512_set1_epi8(0x11);
+	nl = _mm512_set1_epi8(0xee);
+	p = _mm512_set1_epi8((MOEPGF16_POLYNOMIAL & MOEPGF16_MASK) * 0x11);
+
+	for (end=region1+length; region1<end;
+			region1+=64, region2+=64, region3+=64) {
+		a = _mm512_load_si512((void *)region2);
+		b = _mm512_load_si512((void *)region3);
+		acc = _mm512_load_si512((void *)region1);
+
+		for (i=0; i<MOEPGF16_EXPONENT; i++) {
+			t = _mm512_and_si512(b, l);
+			t = _mm512_sub_epi32(_mm512_slli_epi32(t, 4), t);
+			t = _mm512_and_si512(t, a);
+			acc = _mm512_xor_si512(acc, t);
+			b = _mm512_srli_epi32(b, 1);
+
+			t = _mm512_srli_epi32(a, 3);
+			t = _mm512_and_si512(t, l);
+			t = _mm512_sub_epi32(_mm512_slli_epi32(t, 4), t);
+			t = _mm512_and_si512(t, p);
+			a = _mm512_slli_epi32(a, 1);
+			a = _mm512_and_si512(a, nl);
+			a = _mm512_xor_si512(a, t);
+		}
+
+		_mm512_store_si512((void *)region1, acc);
+	}
+}
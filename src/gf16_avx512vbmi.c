@@ -0,0 +1,349 @@
+/*
+ * This file is part of moep80211gf.
+ *
+ * Copyright (C) 2014   Stephan M. Guenther <moepi@moepi.net>
+ * Copyright (C) 2014   Maximilian Riemensberger <riemensberger@tum.de>
+ * Copyright (C) 2013   Alexander Kurtz <alexander@kurtz.be>
+ *
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 2.1 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library. If not, see <https://www.gnu.org/licenses/>
+ *
+ */
+
+#include <immintrin.h>
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <moepgf/moepgf.h>
+
+#include "gf16.h"
+#include "xor.h"
+
+#if MOEPGF16_POLYNOMIAL == 19
+#include "gf16tables19.h"
+#else
+#error "Invalid prime polynomial or tables not available."
+#endif
+
+/*
+ * Products of each constant with all 256 bytes, i.e., with both packed
+ * elements of a byte at once.
+ */
+static const uint8_t mt[MOEPGF16_SIZE][256] = MOEPGF16_LOOKUP_TABLE;
+
+void
+maddrc16_lookup_avx512vbmi(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m512i in1, in2, out, t0, t1, t2, t3, lo, hi;
+	__mmask64 sel;
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_avx512(region1, region2, length);
+		return;
+	}
+
+	t0 = _mm512_loadu_si512((void *)&mt[constant][0]);
+	t1 = _mm512_loadu_si512((void *)&mt[constant][64]);
+	t2 = _mm512_loadu_si512((void *)&mt[constant][128]);
+	t3 = _mm512_loadu_si512((void *)&mt[constant][192]);
+
+	for (end=region1+length; region1<end; region1+=64, region2+=64) {
+		in2 = _mm512_load_si512((void *)region2);
+		in1 = _mm512_load_si512((void *)region1);
+		sel = _mm512_movepi8_mask(in2);
+		lo = _mm512_permutex2var_epi8(t0, in2, t1);
+		hi = _mm512_permutex2var_epi8(t2, in2, t3);
+		out = _mm512_mask_blend_epi8(sel, lo, hi);
+		out = _mm512_xor_si512(out, in1);
+		_mm512_store_si512((void *)region1, out);
+	}
+}
+
+void
+mulrc16_lookup_avx512vbmi(uint8_t *region, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m512i in, out, t0, t1, t2, t3, lo, hi;
+	__mmask64 sel;
+
+	if (constant == 0) {
+		memset(region, 0, length);
+		return;
+	}
+
+	if (constant == 1)
+		return;
+
+	t0 = _mm512_loadu_si512((void *)&mt[constant][0]);
+	t1 = _mm512_loadu_si512((void *)&mt[constant][64]);
+	t2 = _mm512_loadu_si512((void *)&mt[constant][128]);
+	t3 = _mm512_loadu_si512((void *)&mt[constant][192]);
+
+	for (end=region+length; region<end; region+=64) {
+		in = _mm512_load_si512((void *)region);
+		t0 = _mm512_loadu_si512((void *)&mt[constant][0]);
+		t1 = _mm512_loadu_si512((void *)&mt[constant][64]);
+		t2 = _mm512_loadu_si512((void *)&mt[constant][128]);
+		t3 = _mm512_loadu_si512((void *)&mt[constant][192]);
+		sel = _mm512_movepi8_mask(in);
+		lo = _mm512_permutex2var_epi8(t0, in, t1);
+		hi = _mm512_permutex2var_epi8(t2, in, t3);
+		out = _mm512_mask_blend_epi8(sel, lo, hi);
+		_mm512_store_si512((void *)region, out);
+	}
+}
+
+void
+mulrc_copy16_lookup_avx512vbmi(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m512i in, out, t0, t1, t2, t3, lo, hi;
+	__mmask64 sel;
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	t0 = _mm512_loadu_si512((void *)&mt[constant][0]);
+	t1 = _mm512_loadu_si512((void *)&mt[constant][64]);
+	t2 = _mm512_loadu_si512((void *)&mt[constant][128]);
+	t3 = _mm512_loadu_si512((void *)&mt[constant][192]);
+
+	for (end=region1+length; region1<end; region1+=64, region2+=64) {
+		in = _mm512_load_si512((void *)region2);
+		sel = _mm512_movepi8_mask(in);
+		lo = _mm512_permutex2var_epi8(t0, in, t1);
+		hi = _mm512_permutex2var_epi8(t2, in, t3);
+		out = _mm512_mask_blend_epi8(sel, lo, hi);
+		_mm512_store_si512((void *)region1, out);
+	}
+}
+
+void
+maddrc_multi16_lookup_avx512vbmi(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	size_t off;
+	int i;
+	register __m512i in, t0, t1, t2, t3, lo, hi, acc[4];
+	__mmask64 sel;
+
+	for (off=0; off+256<=length; off+=256) {
+		acc[0] = _mm512_load_si512((void *)(region1+off));
+		acc[1] = _mm512_load_si512((void *)(region1+off+64));
+		acc[2] = _mm512_load_si512((void *)(region1+off+128));
+		acc[3] = _mm512_load_si512((void *)(region1+off+192));
+
+		for (i=0; i<count; i++) {
+			if (constants[i] == 0)
+				continue;
+
+			t0 = _mm512_loadu_si512((void *)&mt[constants[i]][0]);
+			t1 = _mm512_loadu_si512((void *)&mt[constants[i]][64]);
+			t2 = _mm512_loadu_si512((void *)&mt[constants[i]][128]);
+			t3 = _mm512_loadu_si512((void *)&mt[constants[i]][192]);
+			in = _mm512_load_si512((void *)(regions[i]+off));
+			sel = _mm512_movepi8_mask(in);
+			lo = _mm512_permutex2var_epi8(t0, in, t1);
+			hi = _mm512_permutex2var_epi8(t2, in, t3);
+			in = _mm512_mask_blend_epi8(sel, lo, hi);
+			acc[0] = _mm512_xor_si512(acc[0], in);
+			in = _mm512_load_si512((void *)(regions[i]+off+64));
+			sel = _mm512_movepi8_mask(in);
+			lo = _mm512_permutex2var_epi8(t0, in, t1);
+			hi = _mm512_permutex2var_epi8(t2, in, t3);
+			in = _mm512_mask_blend_epi8(sel, lo, hi);
+			acc[1] = _mm512_xor_si512(acc[1], in);
+			in = _mm512_load_si512((void *)(regions[i]+off+128));
+			sel = _mm512_movepi8_mask(in);
+			lo = _mm512_permutex2var_epi8(t0, in, t1);
+			hi = _mm512_permutex2var_epi8(t2, in, t3);
+			in = _mm512_mask_blend_epi8(sel, lo, hi);
+			acc[2] = _mm512_xor_si512(acc[2], in);
+			in = _mm512_load_si512((void *)(regions[i]+off+192));
+			sel = _mm512_movepi8_mask(in);
+			lo = _mm512_permutex2var_epi8(t0, in, t1);
+			hi = _mm512_permutex2var_epi8(t2, in, t3);
+			in = _mm512_mask_blend_epi8(sel, lo, hi);
+			acc[3] = _mm512_xor_si512(acc[3], in);
+		}
+
+		_mm512_store_si512((void *)(region1+off), acc[0]);
+		_mm512_store_si512((void *)(region1+off+64), acc[1]);
+		_mm512_store_si512((void *)(region1+off+128), acc[2]);
+		_mm512_store_si512((void *)(region1+off+192), acc[3]);
+	}
+
+	for (; off<length; off+=64) {
+		acc[0] = _mm512_load_si512((void *)(region1+off));
+
+		for (i=0; i<count; i++) {
+			if (constants[i] == 0)
+				continue;
+
+			t0 = _mm512_loadu_si512((void *)&mt[constants[i]][0]);
+			t1 = _mm512_loadu_si512((void *)&mt[constants[i]][64]);
+			t2 = _mm512_loadu_si512((void *)&mt[constants[i]][128]);
+			t3 = _mm512_loadu_si512((void *)&mt[constants[i]][192]);
+			in = _mm512_load_si512((void *)(regions[i]+off));
+			sel = _mm512_movepi8_mask(in);
+			lo = _mm512_permutex2var_epi8(t0, in, t1);
+			hi = _mm512_permutex2var_epi8(t2, in, t3);
+			in = _mm512_mask_blend_epi8(sel, lo, hi);
+			acc[0] = _mm512_xor_si512(acc[0], in);
+		}
+
+		_mm512_store_si512((void *)(region1+off), acc[0]);
+	}
+}
+
+void
+maddrc3_16_lookup_avx512vbmi(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m512i in1, in2, out, t0, t1, t2, t3, lo, hi;
+	__mmask64 sel;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_avx512(region1, region2, region3, length);
+		return;
+	}
+
+	t0 = _mm512_loadu_si512((void *)&mt[constant][0]);
+	t1 = _mm512_loadu_si512((void *)&mt[constant][64]);
+	t2 = _mm512_loadu_si512((void *)&mt[constant][128]);
+	t3 = _mm512_loadu_si512((void *)&mt[constant][192]);
+
+	for (end=region1+length; region1<end;
+			region1+=64, region2+=64, region3+=64) {
+		in2 = _mm512_load_si512((void *)region3);
+		in1 = _mm512_load_si512((void *)region2);
+		sel = _mm512_movepi8_mask(in2);
+		lo = _mm512_permutex2var_epi8(t0, in2, t1);
+		hi = _mm512_permutex2var_epi8(t2, in2, t3);
+		out = _mm512_mask_blend_epi8(sel, lo, hi);
+		out = _mm512_xor_si512(out, in1);
+		_mm512_store_si512((void *)region1, out);
+	}
+}
+
+void
+maddrc_unaligned16_lookup_avx512vbmi(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	__mmask64 k;
+	register __m512i in1, in2, out, t0, t1, t2, t3, lo, hi;
+	__mmask64 sel;
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_unaligned_avx512(region1, region2, length);
+		return;
+	}
+
+	t0 = _mm512_loadu_si512((void *)&mt[constant][0]);
+	t1 = _mm512_loadu_si512((void *)&mt[constant][64]);
+	t2 = _mm512_loadu_si512((void *)&mt[constant][128]);
+	t3 = _mm512_loadu_si512((void *)&mt[constant][192]);
+
+	for (end=region1+(length & ~63); region1<end; region1+=64, region2+=64) {
+		in2 = _mm512_loadu_si512((void *)region2);
+		in1 = _mm512_loadu_si512((void *)region1);
+		sel = _mm512_movepi8_mask(in2);
+		lo = _mm512_permutex2var_epi8(t0, in2, t1);
+		hi = _mm512_permutex2var_epi8(t2, in2, t3);
+		out = _mm512_mask_blend_epi8(sel, lo, hi);
+		out = _mm512_xor_si512(out, in1);
+		_mm512_storeu_si512((void *)region1, out);
+	}
+
+	if (!(length & 63))
+		return;
+
+	k = ((__mmask64)1 << (length & 63)) - 1;
+	in2 = _mm512_maskz_loadu_epi8(k, (void *)region2);
+	in1 = _mm512_maskz_loadu_epi8(k, (void *)region1);
+	sel = _mm512_movepi8_mask(in2);
+	lo = _mm512_permutex2var_epi8(t0, in2, t1);
+	hi = _mm512_permutex2var_epi8(t2, in2, t3);
+	out = _mm512_mask_blend_epi8(sel, lo, hi);
+	out = _mm512_xor_si512(out, in1);
+	_mm512_mask_storeu_epi8((void *)region1, k, out);
+}
+
+void
+mulrc_unaligned16_lookup_avx512vbmi(uint8_t *region, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	__mmask64 k;
+	register __m512i in, out, t0, t1, t2, t3, lo, hi;
+	__mmask64 sel;
+
+	if (constant == 0) {
+		memset(region, 0, length);
+		return;
+	}
+
+	if (constant == 1)
+		return;
+
+	t0 = _mm512_loadu_si512((void *)&mt[constant][0]);
+	t1 = _mm512_loadu_si512((void *)&mt[constant][64]);
+	t2 = _mm512_loadu_si512((void *)&mt[constant][128]);
+	t3 = _mm512_loadu_si512((void *)&mt[constant][192]);
+
+	for (end=region+(length & ~63); region<end; region+=64) {
+		in = _mm512_loadu_si512((void *)region);
+		sel = _mm512_movepi8_mask(in);
+		lo = _mm512_permutex2var_epi8(t0, in, t1);
+		hi = _mm512_permutex2var_epi8(t2, in, t3);
+		out = _mm512_mask_blend_epi8(sel, lo, hi);
+		_mm512_storeu_si512((void *)region, out);
+	}
+
+	if (!(length & 63))
+		return;
+
+	k = ((__mmask64)1 << (length & 63)) - 1;
+	in = _mm512_maskz_loadu_epi8(k, (void *)region);
+	sel = _mm512_movepi8_mask(in);
+	lo = _mm512_permutex2var_epi8(t0, in, t1);
+	hi = _mm512_permutex2var_epi8(t2, in, t3);
+	out = _mm512_mask_blend_epi8(sel, lo, hi);
+	_mm512_mask_storeu_epi8((void *)region, k, out);
+}
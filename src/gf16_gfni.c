@@ -0,0 +1,787 @@
+/*
+ * This file is part of moep80211gf.
+ *
+ * Copyright (C) 2014   Stephan M. Guenther <moepi@moepi.net>
+ * Copyright (C) 2014   Maximilian Riemensberger <riemensberger@tum.de>
+ * Copyright (C) 2013   Alexander Kurtz <alexander@kurtz.be>
+ *
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 2.1 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library. If not, see <https://www.gnu.org/licenses/>
+ *
+ */
+
+#include <immintrin.h>
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <moepgf/moepgf.h>
+
+#include "gf16.h"
+#include "xor.h"
+
+#if MOEPGF16_POLYNOMIAL == 19
+#include "gf16tables19.h"
+#else
+#error "Invalid prime polynomial or tables not available."
+#endif
+
+/*
+ * Bit matrices for gf2p8affineqb, i.e., at[c] multiplies each of the packed
+ * elements of a byte by c.
+ */
+static const uint64_t at[MOEPGF16_SIZE] = MOEPGF16_AFFINE_TABLE;
+
+void
+maddrc16_gfni_affine128(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m128i in1, in2, out, bc;
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_sse2(region1, region2, length);
+		return;
+	}
+
+	bc = _mm_set1_epi64x(at[constant]);
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		in2 = _mm_load_si128((void *)region2);
+		in1 = _mm_load_si128((void *)region1);
+		out = _mm_gf2p8affine_epi64_epi8(in2, bc, 0);
+		out = _mm_xor_si128(out, in1);
+		_mm_store_si128((void *)region1, out);
+	}
+}
+
+void
+mulrc16_gfni_affine128(uint8_t *region, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m128i in, out, bc;
+
+	if (constant == 0) {
+		memset(region, 0, length);
+		return;
+	}
+
+	if (constant == 1)
+		return;
+
+	bc = _mm_set1_epi64x(at[constant]);
+
+	for (end=region+length; region<end; region+=16) {
+		in = _mm_load_si128((void *)region);
+		bc = _mm_set1_epi64x(at[constant]);
+		out = _mm_gf2p8affine_epi64_epi8(in, bc, 0);
+		_mm_store_si128((void *)region, out);
+	}
+}
+
+void
+mulrc_copy16_gfni_affine128(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m128i in, out, bc;
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	bc = _mm_set1_epi64x(at[constant]);
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		in = _mm_load_si128((void *)region2);
+		out = _mm_gf2p8affine_epi64_epi8(in, bc, 0);
+		_mm_store_si128((void *)region1, out);
+	}
+}
+
+void
+maddrc_multi16_gfni_affine128(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	size_t off;
+	int i;
+	register __m128i in, bc, acc[4];
+
+	for (off=0; off+64<=length; off+=64) {
+		acc[0] = _mm_load_si128((void *)(region1+off));
+		acc[1] = _mm_load_si128((void *)(region1+off+16));
+		acc[2] = _mm_load_si128((void *)(region1+off+32));
+		acc[3] = _mm_load_si128((void *)(region1+off+48));
+
+		for (i=0; i<count; i++) {
+			if (constants[i] == 0)
+				continue;
+
+			bc = _mm_set1_epi64x(at[constants[i]]);
+			in = _mm_load_si128((void *)(regions[i]+off));
+			in = _mm_gf2p8affine_epi64_epi8(in, bc, 0);
+			acc[0] = _mm_xor_si128(acc[0], in);
+			in = _mm_load_si128((void *)(regions[i]+off+16));
+			in = _mm_gf2p8affine_epi64_epi8(in, bc, 0);
+			acc[1] = _mm_xor_si128(acc[1], in);
+			in = _mm_load_si128((void *)(regions[i]+off+32));
+			in = _mm_gf2p8affine_epi64_epi8(in, bc, 0);
+			acc[2] = _mm_xor_si128(acc[2], in);
+			in = _mm_load_si128((void *)(regions[i]+off+48));
+			in = _mm_gf2p8affine_epi64_epi8(in, bc, 0);
+			acc[3] = _mm_xor_si128(acc[3], in);
+		}
+
+		_mm_store_si128((void *)(region1+off), acc[0]);
+		_mm_store_si128((void *)(region1+off+16), acc[1]);
+		_mm_store_si128((void *)(region1+off+32), acc[2]);
+		_mm_store_si128((void *)(region1+off+48), acc[3]);
+	}
+
+	for (; off<length; off+=16) {
+		acc[0] = _mm_load_si128((void *)(region1+off));
+
+		for (i=0; i<count; i++) {
+			if (constants[i] == 0)
+				continue;
+
+			bc = _mm_set1_epi64x(at[constants[i]]);
+			in = _mm_load_si128((void *)(regions[i]+off));
+			in = _mm_gf2p8affine_epi64_epi8(in, bc, 0);
+			acc[0] = _mm_xor_si128(acc[0], in);
+		}
+
+		_mm_store_si128((void *)(region1+off), acc[0]);
+	}
+}
+
+void
+maddrc_fanout16_gfni_affine128(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	size_t off;
+	int i = 0;
+	uint8_t *r[8];
+	register __m128i bc[8], in, out;
+
+	for (; i+8<=count; i+=8) {
+		r[0] = regions[i];
+		r[1] = regions[i+1];
+		r[2] = regions[i+2];
+		r[3] = regions[i+3];
+		r[4] = regions[i+4];
+		r[5] = regions[i+5];
+		r[6] = regions[i+6];
+		r[7] = regions[i+7];
+		bc[0] = _mm_set1_epi64x(at[constants[i]]);
+		bc[1] = _mm_set1_epi64x(at[constants[i+1]]);
+		bc[2] = _mm_set1_epi64x(at[constants[i+2]]);
+		bc[3] = _mm_set1_epi64x(at[constants[i+3]]);
+		bc[4] = _mm_set1_epi64x(at[constants[i+4]]);
+		bc[5] = _mm_set1_epi64x(at[constants[i+5]]);
+		bc[6] = _mm_set1_epi64x(at[constants[i+6]]);
+		bc[7] = _mm_set1_epi64x(at[constants[i+7]]);
+
+		for (off=0; off<length; off+=16) {
+			in = _mm_load_si128((void *)(region2+off));
+
+			out = _mm_load_si128((void *)(r[0]+off));
+			out = _mm_xor_si128(out, _mm_gf2p8affine_epi64_epi8(in, bc[0], 0));
+			_mm_store_si128((void *)(r[0]+off), out);
+
+			out = _mm_load_si128((void *)(r[1]+off));
+			out = _mm_xor_si128(out, _mm_gf2p8affine_epi64_epi8(in, bc[1], 0));
+			_mm_store_si128((void *)(r[1]+off), out);
+
+			out = _mm_load_si128((void *)(r[2]+off));
+			out = _mm_xor_si128(out, _mm_gf2p8affine_epi64_epi8(in, bc[2], 0));
+			_mm_store_si128((void *)(r[2]+off), out);
+
+			out = _mm_load_si128((void *)(r[3]+off));
+			out = _mm_xor_si128(out, _mm_gf2p8affine_epi64_epi8(in, bc[3], 0));
+			_mm_store_si128((void *)(r[3]+off), out);
+
+			out = _mm_load_si128((void *)(r[4]+off));
+			out = _mm_xor_si128(out, _mm_gf2p8affine_epi64_epi8(in, bc[4], 0));
+			_mm_store_si128((void *)(r[4]+off), out);
+
+			out = _mm_load_si128((void *)(r[5]+off));
+			out = _mm_xor_si128(out, _mm_gf2p8affine_epi64_epi8(in, bc[5], 0));
+			_mm_store_si128((void *)(r[5]+off), out);
+
+			out = _mm_load_si128((void *)(r[6]+off));
+			out = _mm_xor_si128(out, _mm_gf2p8affine_epi64_epi8(in, bc[6], 0));
+			_mm_store_si128((void *)(r[6]+off), out);
+
+			out = _mm_load_si128((void *)(r[7]+off));
+			out = _mm_xor_si128(out, _mm_gf2p8affine_epi64_epi8(in, bc[7], 0));
+			_mm_store_si128((void *)(r[7]+off), out);
+		}
+	}
+
+	for (; i+4<=count; i+=4) {
+		r[0] = regions[i];
+		r[1] = regions[i+1];
+		r[2] = regions[i+2];
+		r[3] = regions[i+3];
+		bc[0] = _mm_set1_epi64x(at[constants[i]]);
+		bc[1] = _mm_set1_epi64x(at[constants[i+1]]);
+		bc[2] = _mm_set1_epi64x(at[constants[i+2]]);
+		bc[3] = _mm_set1_epi64x(at[constants[i+3]]);
+
+		for (off=0; off<length; off+=16) {
+			in = _mm_load_si128((void *)(region2+off));
+
+			out = _mm_load_si128((void *)(r[0]+off));
+			out = _mm_xor_si128(out, _mm_gf2p8affine_epi64_epi8(in, bc[0], 0));
+			_mm_store_si128((void *)(r[0]+off), out);
+
+			out = _mm_load_si128((void *)(r[1]+off));
+			out = _mm_xor_si128(out, _mm_gf2p8affine_epi64_epi8(in, bc[1], 0));
+			_mm_store_si128((void *)(r[1]+off), out);
+
+			out = _mm_load_si128((void *)(r[2]+off));
+			out = _mm_xor_si128(out, _mm_gf2p8affine_epi64_epi8(in, bc[2], 0));
+			_mm_store_si128((void *)(r[2]+off), out);
+
+			out = _mm_load_si128((void *)(r[3]+off));
+			out = _mm_xor_si128(out, _mm_gf2p8affine_epi64_epi8(in, bc[3], 0));
+			_mm_store_si128((void *)(r[3]+off), out);
+		}
+	}
+
+	for (; i<count; i++)
+		maddrc16_gfni_affine128(regions[i], region2, constants[i], length);
+}
+
+void
+maddrc3_16_gfni_affine128(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m128i in1, in2, out, bc;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_sse2(region1, region2, region3, length);
+		return;
+	}
+
+	bc = _mm_set1_epi64x(at[constant]);
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16) {
+		in2 = _mm_load_si128((void *)region3);
+		in1 = _mm_load_si128((void *)region2);
+		out = _mm_gf2p8affine_epi64_epi8(in2, bc, 0);
+		out = _mm_xor_si128(out, in1);
+		_mm_store_si128((void *)region1, out);
+	}
+}
+
+void
+maddrc_unaligned16_gfni_affine128(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	size_t rem;
+	register __m128i in1, in2, out, bc;
+	register __m128i tail;
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_unaligned_sse2(region1, region2, length);
+		return;
+	}
+
+	if (length < 16) {
+		maddrc16_flat_table(region1, region2, constant, length);
+		return;
+	}
+
+	bc = _mm_set1_epi64x(at[constant]);
+
+	/* The last, possibly overlapping vector is computed before the main loop
+	 * modifies region1 and stored after it. */
+	in2 = _mm_loadu_si128((void *)(region2+length-16));
+	in1 = _mm_loadu_si128((void *)(region1+length-16));
+	tail = _mm_gf2p8affine_epi64_epi8(in2, bc, 0);
+	tail = _mm_xor_si128(tail, in1);
+	rem = length % 16;
+
+	for (end=region1+length-rem; region1<end; region1+=16, region2+=16) {
+		in2 = _mm_loadu_si128((void *)region2);
+		in1 = _mm_loadu_si128((void *)region1);
+		out = _mm_gf2p8affine_epi64_epi8(in2, bc, 0);
+		out = _mm_xor_si128(out, in1);
+		_mm_storeu_si128((void *)region1, out);
+	}
+
+	_mm_storeu_si128((void *)(region1+rem-16), tail);
+}
+
+void
+mulrc_unaligned16_gfni_affine128(uint8_t *region, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	size_t rem;
+	register __m128i in, out, bc;
+	register __m128i tail;
+
+	if (constant == 0) {
+		memset(region, 0, length);
+		return;
+	}
+
+	if (constant == 1)
+		return;
+
+	if (length < 16) {
+		mulrc16_imul_scalar(region, constant, length);
+		return;
+	}
+
+	bc = _mm_set1_epi64x(at[constant]);
+
+	/* The last, possibly overlapping vector is computed before the main loop
+	 * modifies region and stored after it. */
+	in = _mm_loadu_si128((void *)(region+length-16));
+	tail = _mm_gf2p8affine_epi64_epi8(in, bc, 0);
+	rem = length % 16;
+
+	for (end=region+length-rem; region<end; region+=16) {
+		in = _mm_loadu_si128((void *)region);
+		out = _mm_gf2p8affine_epi64_epi8(in, bc, 0);
+		_mm_storeu_si128((void *)region, out);
+	}
+
+	_mm_storeu_si128((void *)(region+rem-16), tail);
+}
+
+void
+maddrc16_gfni_affine256(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m256i in1, in2, out, bc;
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_avx2(region1, region2, length);
+		return;
+	}
+
+	bc = _mm256_set1_epi64x(at[constant]);
+
+	for (end=region1+length; region1<end; region1+=32, region2+=32) {
+		in2 = _mm256_load_si256((void *)region2);
+		in1 = _mm256_load_si256((void *)region1);
+		out = _mm256_gf2p8affine_epi64_epi8(in2, bc, 0);
+		out = _mm256_xor_si256(out, in1);
+		_mm256_store_si256((void *)region1, out);
+	}
+}
+
+void
+mulrc16_gfni_affine256(uint8_t *region, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m256i in, out, bc;
+
+	if (constant == 0) {
+		memset(region, 0, length);
+		return;
+	}
+
+	if (constant == 1)
+		return;
+
+	bc = _mm256_set1_epi64x(at[constant]);
+
+	for (end=region+length; region<end; region+=32) {
+		in = _mm256_load_si256((void *)region);
+		bc = _mm256_set1_epi64x(at[constant]);
+		out = _mm256_gf2p8affine_epi64_epi8(in, bc, 0);
+		_mm256_store_si256((void *)region, out);
+	}
+}
+
+void
+mulrc_copy16_gfni_affine256(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m256i in, out, bc;
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	bc = _mm256_set1_epi64x(at[constant]);
+
+	for (end=region1+length; region1<end; region1+=32, region2+=32) {
+		in = _mm256_load_si256((void *)region2);
+		out = _mm256_gf2p8affine_epi64_epi8(in, bc, 0);
+		_mm256_store_si256((void *)region1, out);
+	}
+}
+
+void
+maddrc_multi16_gfni_affine256(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	size_t off;
+	int i;
+	register __m256i in, bc, acc[4];
+
+	for (off=0; off+128<=length; off+=128) {
+		acc[0] = _mm256_load_si256((void *)(region1+off));
+		acc[1] = _mm256_load_si256((void *)(region1+off+32));
+		acc[2] = _mm256_load_si256((void *)(region1+off+64));
+		acc[3] = _mm256_load_si256((void *)(region1+off+96));
+
+		for (i=0; i<count; i++) {
+			if (constants[i] == 0)
+				continue;
+
+			bc = _mm256_set1_epi64x(at[constants[i]]);
+			in = _mm256_load_si256((void *)(regions[i]+off));
+			in = _mm256_gf2p8affine_epi64_epi8(in, bc, 0);
+			acc[0] = _mm256_xor_si256(acc[0], in);
+			in = _mm256_load_si256((void *)(regions[i]+off+32));
+			in = _mm256_gf2p8affine_epi64_epi8(in, bc, 0);
+			acc[1] = _mm256_xor_si256(acc[1], in);
+			in = _mm256_load_si256((void *)(regions[i]+off+64));
+			in = _mm256_gf2p8affine_epi64_epi8(in, bc, 0);
+			acc[2] = _mm256_xor_si256(acc[2], in);
+			in = _mm256_load_si256((void *)(regions[i]+off+96));
+			in = _mm256_gf2p8affine_epi64_epi8(in, bc, 0);
+			acc[3] = _mm256_xor_si256(acc[3], in);
+		}
+
+		_mm256_store_si256((void *)(region1+off), acc[0]);
+		_mm256_store_si256((void *)(region1+off+32), acc[1]);
+		_mm256_store_si256((void *)(region1+off+64), acc[2]);
+		_mm256_store_si256((void *)(region1+off+96), acc[3]);
+	}
+
+	for (; off<length; off+=32) {
+		acc[0] = _mm256_load_si256((void *)(region1+off));
+
+		for (i=0; i<count; i++) {
+			if (constants[i] == 0)
+				continue;
+
+			bc = _mm256_set1_epi64x(at[constants[i]]);
+			in = _mm256_load_si256((void *)(regions[i]+off));
+			in = _mm256_gf2p8affine_epi64_epi8(in, bc, 0);
+			acc[0] = _mm256_xor_si256(acc[0], in);
+		}
+
+		_mm256_store_si256((void *)(region1+off), acc[0]);
+	}
+}
+
+void
+maddrc_fanout16_gfni_affine256(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	size_t off;
+	int i = 0;
+	uint8_t *r[8];
+	register __m256i bc[8], in, out;
+
+	for (; i+8<=count; i+=8) {
+		r[0] = regions[i];
+		r[1] = regions[i+1];
+		r[2] = regions[i+2];
+		r[3] = regions[i+3];
+		r[4] = regions[i+4];
+		r[5] = regions[i+5];
+		r[6] = regions[i+6];
+		r[7] = regions[i+7];
+		bc[0] = _mm256_set1_epi64x(at[constants[i]]);
+		bc[1] = _mm256_set1_epi64x(at[constants[i+1]]);
+		bc[2] = _mm256_set1_epi64x(at[constants[i+2]]);
+		bc[3] = _mm256_set1_epi64x(at[constants[i+3]]);
+		bc[4] = _mm256_set1_epi64x(at[constants[i+4]]);
+		bc[5] = _mm256_set1_epi64x(at[constants[i+5]]);
+		bc[6] = _mm256_set1_epi64x(at[constants[i+6]]);
+		bc[7] = _mm256_set1_epi64x(at[constants[i+7]]);
+
+		for (off=0; off<length; off+=32) {
+			in = _mm256_load_si256((void *)(region2+off));
+
+			out = _mm256_load_si256((void *)(r[0]+off));
+			out = _mm256_xor_si256(out, _mm256_gf2p8affine_epi64_epi8(in, bc[0], 0));
+			_mm256_store_si256((void *)(r[0]+off), out);
+
+			out = _mm256_load_si256((void *)(r[1]+off));
+			out = _mm256_xor_si256(out, _mm256_gf2p8affine_epi64_epi8(in, bc[1], 0));
+			_mm256_store_si256((void *)(r[1]+off), out);
+
+			out = _mm256_load_si256((void *)(r[2]+off));
+			out = _mm256_xor_si256(out, _mm256_gf2p8affine_epi64_epi8(in, bc[2], 0));
+			_mm256_store_si256((void *)(r[2]+off), out);
+
+			out = _mm256_load_si256((void *)(r[3]+off));
+			out = _mm256_xor_si256(out, _mm256_gf2p8affine_epi64_epi8(in, bc[3], 0));
+			_mm256_store_si256((void *)(r[3]+off), out);
+
+			out = _mm256_load_si256((void *)(r[4]+off));
+			out = _mm256_xor_si256(out, _mm256_gf2p8affine_epi64_epi8(in, bc[4], 0));
+			_mm256_store_si256((void *)(r[4]+off), out);
+
+			out = _mm256_load_si256((void *)(r[5]+off));
+			out = _mm256_xor_si256(out, _mm256_gf2p8affine_epi64_epi8(in, bc[5], 0));
+			_mm256_store_si256((void *)(r[5]+off), out);
+
+			out = _mm256_load_si256((void *)(r[6]+off));
+			out = _mm256_xor_si256(out, _mm256_gf2p8affine_epi64_epi8(in, bc[6], 0));
+			_mm256_store_si256((void *)(r[6]+off), out);
+
+			out = _mm256_load_si256((void *)(r[7]+off));
+			out = _mm256_xor_si256(out, _mm256_gf2p8affine_epi64_epi8(in, bc[7], 0));
+			_mm256_store_si256((void *)(r[7]+off), out);
+		}
+	}
+
+	for (; i+4<=count; i+=4) {
+		r[0] = regions[i];
+		r[1] = regions[i+1];
+		r[2] = regions[i+2];
+		r[3] = regions[i+3];
+		bc[0] = _mm256_set1_epi64x(at[constants[i]]);
+		bc[1] = _mm256_set1_epi64x(at[constants[i+1]]);
+		bc[2] = _mm256_set1_epi64x(at[constants[i+2]]);
+		bc[3] = _mm256_set1_epi64x(at[constants[i+3]]);
+
+		for (off=0; off<length; off+=32) {
+			in = _mm256_load_si256((void *)(region2+off));
+
+			out = _mm256_load_si256((void *)(r[0]+off));
+			out = _mm256_xor_si256(out, _mm256_gf2p8affine_epi64_epi8(in, bc[0], 0));
+			_mm256_store_si256((void *)(r[0]+off), out);
+
+			out = _mm256_load_si256((void *)(r[1]+off));
+			out = _mm256_xor_si256(out, _mm256_gf2p8affine_epi64_epi8(in, bc[1], 0));
+			_mm256_store_si256((void *)(r[1]+off), out);
+
+			out = _mm256_load_si256((void *)(r[2]+off));
+			out = _mm256_xor_si256(out, _mm256_gf2p8affine_epi64_epi8(in, bc[2], 0));
+			_mm256_store_si256((void *)(r[2]+off), out);
+
+			out = _mm256_load_si256((void *)(r[3]+off));
+			out = _mm256_xor_si256(out, _mm256_gf2p8affine_epi64_epi8(in, bc[3], 0));
+			_mm256_store_si256((void *)(r[3]+off), out);
+		}
+	}
+
+	for (; i<count; i++)
+		maddrc16_gfni_affine256(regions[i], region2, constants[i], length);
+}
+
+void
+maddrc3_16_gfni_affine256(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m256i in1, in2, out, bc;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_avx2(region1, region2, region3, length);
+		return;
+	}
+
+	bc = _mm256_set1_epi64x(at[constant]);
+
+	for (end=region1+length; region1<end;
+			region1+=32, region2+=32, region3+=32) {
+		in2 = _mm256_load_si256((void *)region3);
+		in1 = _mm256_load_si256((void *)region2);
+		out = _mm256_gf2p8affine_epi64_epi8(in2, bc, 0);
+		out = _mm256_xor_si256(out, in1);
+		_mm256_store_si256((void *)region1, out);
+	}
+}
+
+void
+maddrc_unaligned16_gfni_affine256(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	size_t rem;
+	register __m256i in1, in2, out, bc;
+	register __m256i tail;
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_unaligned_avx2(region1, region2, length);
+		return;
+	}
+
+	if (length < 32) {
+		maddrc16_flat_table(region1, region2, constant, length);
+		return;
+	}
+
+	bc = _mm256_set1_epi64x(at[constant]);
+
+	/* The last, possibly overlapping vector is computed before the main loop
+	 * modifies region1 and stored after it. */
+	in2 = _mm256_loadu_si256((void *)(region2+length-32));
+	in1 = _mm256_loadu_si256((void *)(region1+length-32));
+	tail = _mm256_gf2p8affine_epi64_epi8(in2, bc, 0);
+	tail = _mm256_xor_si256(tail, in1);
+	rem = length % 32;
+
+	for (end=region1+length-rem; region1<end; region1+=32, region2+=32) {
+		in2 = _mm256_loadu_si256((void *)region2);
+		in1 = _mm256_loadu_si256((void *)region1);
+		out = _mm256_gf2p8affine_epi64_epi8(in2, bc, 0);
+		out = _mm256_xor_si256(out, in1);
+		_mm256_storeu_si256((void *)region1, out);
+	}
+
+	_mm256_storeu_si256((void *)(region1+rem-32), tail);
+}
+
+void
+mulrc_unaligned16_gfni_affine256(uint8_t *region, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	size_t rem;
+	register __m256i in, out, bc;
+	register __m256i tail;
+
+	if (constant == 0) {
+		memset(region, 0, length);
+		return;
+	}
+
+	if (constant == 1)
+		return;
+
+	if (length < 32) {
+		mulrc16_imul_scalar(region, constant, length);
+		return;
+	}
+
+	bc = _mm256_set1_epi64x(at[constant]);
+
+	/* The last, possibly overlapping vector is computed before the main loop
+	 * modifies region and stored after it. */
+	in = _mm256_loadu_si256((void *)(region+length-32));
+	tail = _mm256_gf2p8affine_epi64_epi8(in, bc, 0);
+	rem = length % 32;
+
+	for (end=region+length-rem; region<end; region+=32) {
+		in = _mm256_loadu_si256((void *)region);
+		out = _mm256_gf2p8affine_epi64_epi8(in, bc, 0);
+		_mm256_storeu_si256((void *)region, out);
+	}
+
+	_mm256_storeu_si256((void *)(region+rem-32), tail);
+}
+
+void
+mulrc_copy_nt16_gfni_affine256(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m256i in, out, bc;
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	bc = _mm256_set1_epi64x(at[constant]);
+
+	for (end=region1+length; region1<end; region1+=32, region2+=32) {
+		in = _mm256_load_si256((void *)region2);
+		out = _mm256_gf2p8affine_epi64_epi8(in, bc, 0);
+		_mm256_stream_si256((void *)region1, out);
+	}
+
+	_mm_sfence();
+}
+
+void
+maddrc3_nt16_gfni_affine256(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m256i in1, in2, out, bc;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_avx2(region1, region2, region3, length);
+		return;
+	}
+
+	bc = _mm256_set1_epi64x(at[constant]);
+
+	for (end=region1+length; region1<end;
+			region1+=32, region2+=32, region3+=32) {
+		in2 = _mm256_load_si256((void *)region3);
+		in1 = _mm256_load_si256((void *)region2);
+		out = _mm256_gf2p8affine_epi64_epi8(in2, bc, 0);
+		out = _mm256_xor_si256(out, in1);
+		_mm256_stream_si256((void *)region1, out);
+	}
+
+	_mm_sfence();
+}
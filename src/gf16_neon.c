@@ -41,6 +41,7 @@
 static const uint8_t pt[MOEPGF16_SIZE][MOEPGF16_EXPONENT] = MOEPGF16_POLYNOMIAL_DIV_TABLE;
 static const uint8_t tl[MOEPGF16_SIZE][16] = MOEPGF16_SHUFFLE_LOW_TABLE;
 static const uint8_t th[MOEPGF16_SIZE][16] = MOEPGF16_SHUFFLE_HIGH_TABLE;
+static const uint8_t inverses[MOEPGF16_SIZE] = MOEPGF16_INV_TABLE;
 
 void
 maddrc16_shuffle_neon_64(uint8_t* region1, const uint8_t* region2,
@@ -215,3 +216,379 @@ mulrc16_shuffle_neon_64(uint8_t *region, uint8_t constant, size_t length)
 	}
 }
 
+void
+mulrc_copy16_shuffle_neon_64(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register uint8x8x2_t t1, t2;
+	register uint8x8_t m1, m2, in, out, l, h;
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	t1 = vld2_u8((void *)tl[constant]);
+	t2 = vld2_u8((void *)th[constant]);
+	m1 = vdup_n_u8(0x0f);
+	m2 = vdup_n_u8(0xf0);
+
+	for (end=region1+length; region1<end; region1+=8, region2+=8) {
+		in = vld1_u8((void *)region2);
+		l = vand_u8(in, m1);
+		l = vtbl2_u8(t1, l);
+		h = vand_u8(in, m2);
+		h = vshr_n_u8(h, 4);
+		h = vtbl2_u8(t2, h);
+		out = veor_u8(h, l);
+		vst1_u8((void *)region1, out);
+	}
+}
+
+void
+maddrc_multi16_shuffle_neon_64(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	size_t off;
+	int i;
+	register uint8x8x2_t t1, t2;
+	register uint8x8_t m1, m2, in, acc, l, h;
+
+	m1 = vdup_n_u8(0x0f);
+	m2 = vdup_n_u8(0xf0);
+
+	for (off=0; off<length; off+=8) {
+		acc = vld1_u8((void *)(region1+off));
+
+		for (i=0; i<count; i++) {
+			if (constants[i] == 0)
+				continue;
+
+			t1 = vld2_u8((void *)tl[constants[i]]);
+			t2 = vld2_u8((void *)th[constants[i]]);
+			in = vld1_u8((void *)(regions[i]+off));
+			l = vand_u8(in, m1);
+			l = vtbl2_u8(t1, l);
+			h = vand_u8(in, m2);
+			h = vshr_n_u8(h, 4);
+			h = vtbl2_u8(t2, h);
+			acc = veor_u8(acc, h);
+			acc = veor_u8(acc, l);
+		}
+
+		vst1_u8(region1+off, acc);
+	}
+}
+
+void
+maddrc_fanout16_shuffle_neon_64(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++)
+		maddrc16_shuffle_neon_64(regions[i], region2, constants[i], length);
+}
+
+void
+maddrc3_16_shuffle_neon_64(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register uint8x8x2_t t1, t2;
+	register uint8x8_t m1, m2, in1, in2, out, l, h;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_neon_128(region1, region2, region3, length);
+		return;
+	}
+
+	t1 = vld2_u8((void *)tl[constant]);
+	t2 = vld2_u8((void *)th[constant]);
+	m1 = vdup_n_u8(0x0f);
+	m2 = vdup_n_u8(0xf0);
+
+	for (end=region1+length; region1<end;
+			region1+=8, region2+=8, region3+=8) {
+		in2 = vld1_u8((void *)region3);
+		in1 = vld1_u8((void *)region2);
+		l = vand_u8(in2, m1);
+		l = vtbl2_u8(t1, l);
+		h = vand_u8(in2, m2);
+		h = vshr_n_u8(h, 4);
+		h = vtbl2_u8(t2, h);
+		out = veor_u8(h, l);
+		out = veor_u8(out, in1);
+		vst1_u8(region1, out);
+	}
+}
+
+void
+maddrc3_16_imul_neon_64(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	const uint8_t *p = pt[constant];
+	register uint8x8_t mi[4], sp[4], ri[4], reg1, reg2;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_neon_64(region1, region2, region3, length);
+		return;
+	}
+
+	mi[0] = vdup_n_u8(0x11);
+	mi[1] = vdup_n_u8(0x22);
+	mi[2] = vdup_n_u8(0x44);
+	mi[3] = vdup_n_u8(0x88);
+
+	sp[0] = vdup_n_u8(p[0]);
+	sp[1] = vdup_n_u8(p[1]);
+	sp[2] = vdup_n_u8(p[2]);
+	sp[3] = vdup_n_u8(p[3]);
+
+	for (end=region1+length; region1<end;
+			region1+=8, region2+=8, region3+=8) {
+		reg2 = vld1_u8((void *)region3);
+		reg1 = vld1_u8((void *)region2);
+
+		ri[0] = vand_u8(reg2, mi[0]);
+		ri[1] = vand_u8(reg2, mi[1]);
+		ri[2] = vand_u8(reg2, mi[2]);
+		ri[3] = vand_u8(reg2, mi[3]);
+
+		ri[1] = vshr_n_u8(ri[1], 1);
+		ri[2] = vshr_n_u8(ri[2], 2);
+		ri[3] = vshr_n_u8(ri[3], 3);
+
+		ri[0] = vmul_u8(ri[0], sp[0]);
+		ri[1] = vmul_u8(ri[1], sp[1]);
+		ri[2] = vmul_u8(ri[2], sp[2]);
+		ri[3] = vmul_u8(ri[3], sp[3]);
+
+		ri[0] = veor_u8(ri[0], ri[1]);
+		ri[2] = veor_u8(ri[2], ri[3]);
+		ri[0] = veor_u8(ri[0], ri[2]);
+		ri[0] = veor_u8(ri[0], reg1);
+
+		vst1_u8(region1, ri[0]);
+	}
+}
+
+void
+maddrc3_16_imul_neon_128(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	const uint8_t *p = pt[constant];
+	register uint8x16_t mi[4], sp[4], ri[4], reg1, reg2;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_neon_128(region1, region2, region3, length);
+		return;
+	}
+
+	mi[0] = vdupq_n_u8(0x11);
+	mi[1] = vdupq_n_u8(0x22);
+	mi[2] = vdupq_n_u8(0x44);
+	mi[3] = vdupq_n_u8(0x88);
+
+	sp[0] = vdupq_n_u8(p[0]);
+	sp[1] = vdupq_n_u8(p[1]);
+	sp[2] = vdupq_n_u8(p[2]);
+	sp[3] = vdupq_n_u8(p[3]);
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16) {
+		reg2 = vld1q_u8((void *)region3);
+		reg1 = vld1q_u8((void *)region2);
+
+		ri[0] = vandq_u8(reg2, mi[0]);
+		ri[1] = vandq_u8(reg2, mi[1]);
+		ri[2] = vandq_u8(reg2, mi[2]);
+		ri[3] = vandq_u8(reg2, mi[3]);
+
+		ri[1] = vshrq_n_u8(ri[1], 1);
+		ri[2] = vshrq_n_u8(ri[2], 2);
+		ri[3] = vshrq_n_u8(ri[3], 3);
+
+		ri[0] = vmulq_u8(ri[0], sp[0]);
+		ri[1] = vmulq_u8(ri[1], sp[1]);
+		ri[2] = vmulq_u8(ri[2], sp[2]);
+		ri[3] = vmulq_u8(ri[3], sp[3]);
+
+		ri[0] = veorq_u8(ri[0], ri[1]);
+		ri[2] = veorq_u8(ri[2], ri[3]);
+		ri[0] = veorq_u8(ri[0], ri[2]);
+		ri[0] = veorq_u8(ri[0], reg1);
+
+		vst1q_u8(region1, ri[0]);
+	}
+}
+
+void
+mulrr16_imul_neon_128(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	int i;
+	register uint8x16_t a, b, t, acc, l, nl, p;
+
+	l = vdupq_n_u8(0x11);
+	nl = vdupq_n_u8(0xee);
+	p = vdupq_n_u8((MOEPGF16_POLYNOMIAL & MOEPGF16_MASK) * 0x11);
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		a = vld1q_u8(region1);
+		b = vld1q_u8(region2);
+		acc = vdupq_n_u8(0);
+
+		for (i=0; i<MOEPGF16_EXPONENT; i++) {
+			t = vandq_u8(b, l);
+			t = vsubq_u8(vshlq_n_u8(t, 4), t);
+			t = vandq_u8(t, a);
+			acc = veorq_u8(acc, t);
+			b = vshrq_n_u8(b, 1);
+
+			t = vshrq_n_u8(a, 3);
+			t = vandq_u8(t, l);
+			t = vsubq_u8(vshlq_n_u8(t, 4), t);
+			t = vandq_u8(t, p);
+			a = vshlq_n_u8(a, 1);
+			a = vandq_u8(a, nl);
+			a = veorq_u8(a, t);
+		}
+
+		vst1q_u8(region1, acc);
+	}
+}
+
+void
+maddrr16_imul_neon_128(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, size_t length)
+{
+	uint8_t *end;
+	int i;
+	register uint8x16_t a, b, t, acc, l, nl, p;
+
+	l = vdupq_n_u8(0x11);
+	nl = vdupq_n_u8(0xee);
+	p = vdupq_n_u8((MOEPGF16_POLYNOMIAL & MOEPGF16_MASK) * 0x11);
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16) {
+		a = vld1q_u8(region2);
+		b = vld1q_u8(region3);
+		acc = vld1q_u8(region1);
+
+		for (i=0; i<MOEPGF16_EXPONENT; i++) {
+			t = vandq_u8(b, l);
+			t = vsubq_u8(vshlq_n_u8(t, 4), t);
+			t = vandq_u8(t, a);
+			acc = veorq_u8(acc, t);
+			b = vshrq_n_u8(b, 1);
+
+			t = vshrq_n_u8(a, 3);
+			t = vandq_u8(t, l);
+			t = vsubq_u8(vshlq_n_u8(t, 4), t);
+			t = vandq_u8(t, p);
+			a = vshlq_n_u8(a, 1);
+			a = vandq_u8(a, nl);
+			a = veorq_u8(a, t);
+		}
+
+		vst1q_u8(region1, acc);
+	}
+}
+
+void
+invr16_shuffle_neon_64(uint8_t *region, size_t length)
+{
+	uint8_t *end;
+	register uint8x8x2_t t1, t2;
+	register uint8x8_t m1, l, h;
+	register uint8x8_t in;
+
+	t1.val[0] = vld1_u8(inverses);
+	t1.val[1] = vld1_u8(inverses + 8);
+	t2.val[0] = vshl_n_u8(t1.val[0], 4);
+	t2.val[1] = vshl_n_u8(t1.val[1], 4);
+	m1 = vdup_n_u8(0x0f);
+
+	for (end=region+length; region<end; region+=8) {
+		in = vld1_u8(region);
+		l = vand_u8(in, m1);
+		l = vtbl2_u8(t1, l);
+		h = vshr_n_u8(in, 4);
+		h = vtbl2_u8(t2, h);
+		in = vorr_u8(h, l);
+		vst1_u8(region, in);
+	}
+}
+
+void
+divr16_shuffle_neon_64(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	int i;
+	register uint8x8x2_t t1, t2;
+	register uint8x8_t m1, l, h;
+	register uint8x8_t a, b, t, acc, bl, nl, p;
+
+	t1.val[0] = vld1_u8(inverses);
+	t1.val[1] = vld1_u8(inverses + 8);
+	t2.val[0] = vshl_n_u8(t1.val[0], 4);
+	t2.val[1] = vshl_n_u8(t1.val[1], 4);
+	m1 = vdup_n_u8(0x0f);
+	bl = vdup_n_u8(0x11);
+	nl = vdup_n_u8(0xee);
+	p = vdup_n_u8((MOEPGF16_POLYNOMIAL & MOEPGF16_MASK) * 0x11);
+
+	for (end=region1+length; region1<end; region1+=8, region2+=8) {
+		a = vld1_u8(region1);
+		b = vld1_u8(region2);
+		l = vand_u8(b, m1);
+		l = vtbl2_u8(t1, l);
+		h = vshr_n_u8(b, 4);
+		h = vtbl2_u8(t2, h);
+		b = vorr_u8(h, l);
+
+		acc = vdup_n_u8(0);
+		for (i=0; i<MOEPGF16_EXPONENT; i++) {
+			t = vand_u8(b, bl);
+			t = vsub_u8(vshl_n_u8(t, 4), t);
+			t = vand_u8(t, a);
+			acc = veor_u8(acc, t);
+			b = vshr_n_u8(b, 1);
+
+			t = vshr_n_u8(a, 3);
+			t = vand_u8(t, bl);
+			t = vsub_u8(vshl_n_u8(t, 4), t);
+			t = vand_u8(t, p);
+			a = vshl_n_u8(a, 1);
+			a = vand_u8(a, nl);
+			a = veor_u8(a, t);
+		}
+
+		vst1_u8(region1, acc);
+	}
+}
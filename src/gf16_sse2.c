@@ -131,3 +131,193 @@ mulrc16_imul_sse2(uint8_t *region, uint8_t constant, size_t length)
 	}
 }
 
+void
+mulrc_copy16_imul_sse2(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m128i reg, ri[4], sp[4], mi[4];
+	const uint8_t *p = pt[constant];
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	mi[0] = _mm_set1_epi8(0x11);
+	mi[1] = _mm_set1_epi8(0x22);
+	mi[2] = _mm_set1_epi8(0x44);
+	mi[3] = _mm_set1_epi8(0x88);
+	sp[0] = _mm_set1_epi16(p[0]);
+	sp[1] = _mm_set1_epi16(p[1]);
+	sp[2] = _mm_set1_epi16(p[2]);
+	sp[3] = _mm_set1_epi16(p[3]);
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		reg = _mm_load_si128((void *)region2);
+		ri[0] = _mm_and_si128(reg, mi[0]);
+		ri[1] = _mm_and_si128(reg, mi[1]);
+		ri[2] = _mm_and_si128(reg, mi[2]);
+		ri[3] = _mm_and_si128(reg, mi[3]);
+		ri[1] = _mm_srli_epi16(ri[1], 1);
+		ri[2] = _mm_srli_epi16(ri[2], 2);
+		ri[3] = _mm_srli_epi16(ri[3], 3);
+		ri[0] = _mm_mullo_epi16(ri[0], sp[0]);
+		ri[1] = _mm_mullo_epi16(ri[1], sp[1]);
+		ri[2] = _mm_mullo_epi16(ri[2], sp[2]);
+		ri[3] = _mm_mullo_epi16(ri[3], sp[3]);
+		ri[0] = _mm_xor_si128(ri[0], ri[1]);
+		ri[2] = _mm_xor_si128(ri[2], ri[3]);
+		ri[0] = _mm_xor_si128(ri[0], ri[2]);
+		_mm_store_si128((void *)region1, ri[0]);
+	}
+}
+
+void
+maddrc_multi16_imul_sse2(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++)
+		maddrc16_imul_sse2(region1, regions[i], constants[i], length);
+}
+
+void
+maddrc_fanout16_imul_sse2(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++)
+		maddrc16_imul_sse2(regions[i], region2, constants[i], length);
+}
+
+void
+maddrc3_16_imul_sse2(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m128i reg1, reg2, ri[4], sp[4], mi[4];
+	const uint8_t *p = pt[constant];
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_sse2(region1, region2, region3, length);
+		return;
+	}
+	
+	mi[0] = _mm_set1_epi8(0x11);
+	mi[1] = _mm_set1_epi8(0x22);
+	mi[2] = _mm_set1_epi8(0x44);
+	mi[3] = _mm_set1_epi8(0x88);
+	sp[0] = _mm_set1_epi16(p[0]);
+	sp[1] = _mm_set1_epi16(p[1]);
+	sp[2] = _mm_set1_epi16(p[2]);
+	sp[3] = _mm_set1_epi16(p[3]);
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16) {
+		reg2 = _mm_load_si128((void *)region3);
+		reg1 = _mm_load_si128((void *)region2);
+		ri[0] = _mm_and_si128(reg2, mi[0]);
+		ri[1] = _mm_and_si128(reg2, mi[1]);
+		ri[2] = _mm_and_si128(reg2, mi[2]);
+		ri[3] = _mm_and_si128(reg2, mi[3]);
+		ri[1] = _mm_srli_epi16(ri[1], 1);
+		ri[2] = _mm_srli_epi16(ri[2], 2);
+		ri[3] = _mm_srli_epi16(ri[3], 3);
+		ri[0] = _mm_mullo_epi16(ri[0], sp[0]);
+		ri[1] = _mm_mullo_epi16(ri[1], sp[1]);
+		ri[2] = _mm_mullo_epi16(ri[2], sp[2]);
+		ri[3] = _mm_mullo_epi16(ri[3], sp[3]);
+		ri[0] = _mm_xor_si128(ri[0], ri[1]);
+		ri[2] = _mm_xor_si128(ri[2], ri[3]);
+		ri[0] = _mm_xor_si128(ri[0], ri[2]);
+		ri[0] = _mm_xor_si128(ri[0], reg1);
+		_mm_store_si128((void *)region1, ri[0]);
+	}
+}
+
+void
+mulrr16_imul_sse2(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	int i;
+	register __m128i a, b, t, acc, l, nl, p;
+
+	l = _mm_set1_epi8(0x11);
+	nl = _mm_set1_epi8(0xee);
+	p = _mm_set1_epi8((MOEPGF16_POLYNOMIAL & MOEPGF16_MASK) * 0x11);
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		a = _mm_load_si128((void *)region1);
+		b = _mm_load_si128((void *)region2);
+		acc = _mm_setzero_si128();
+
+		for (i=0; i<MOEPGF16_EXPONENT; i++) {
+			t = _mm_and_si128(b, l);
+			t = _mm_sub_epi16(_mm_slli_epi16(t, 4), t);
+			t = _mm_and_si128(t, a);
+			acc = _mm_xor_si128(acc, t);
+			b = _mm_srli_epi16(b, 1);
+
+			t = _mm_srli_epi16(a, 3);
+			t = _mm_and_si128(t, l);
+			t = _mm_sub_epi16(_mm_slli_epi16(t, 4), t);
+			t = _mm_and_si128(t, p);
+			a = _mm_slli_epi16(a, 1);
+			a = _mm_and_si128(a, nl);
+			a = _mm_xor_si128(a, t);
+		}
+
+		_mm_store_si128((void *)region1, acc);
+	}
+}
+
+void
+maddrr16_imul_sse2(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, size_t length)
+{
+	uint8_t *end;
+	int i;
+	register __m128i a, b, t, acc, l, nl, p;
+
+	l = _mm_set1_epi8(0x11);
+	nl = _mm_set1_epi8(0xee);
+	p = _mm_set1_epi8((MOEPGF16_POLYNOMIAL & MOEPGF16_MASK) * 0x11);
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16) {
+		a = _mm_load_si128((void *)region2);
+		b = _mm_load_si128((void *)region3);
+		acc = _mm_load_si128((void *)region1);
+
+		for (i=0; i<MOEPGF16_EXPONENT; i++) {
+			t = _mm_and_si128(b, l);
+			t = _mm_sub_epi16(_mm_slli_epi16(t, 4), t);
+			t = _mm_and_si128(t, a);
+			acc = _mm_xor_si128(acc, t);
+			b = _mm_srli_epi16(b, 1);
+
+			t = _mm_srli_epi16(a, 3);
+			t = _mm_and_si128(t, l);
+			t = _mm_sub_epi16(_mm_slli_epi16(t, 4), t);
+			t = _mm_and_si128(t, p);
+			a = _mm_slli_epi16(a, 1);
+			a = _mm_and_si128(a, nl);
+			a = _mm_xor_si128(a, t);
+		}
+
+		_mm_store_si128((void *)region1, acc);
+	}
+}
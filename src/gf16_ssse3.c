@@ -39,6 +39,7 @@
 #endif
 
 static const uint8_t tl[MOEPGF16_SIZE][16] = MOEPGF16_SHUFFLE_LOW_TABLE;
+static const uint8_t inverses[MOEPGF16_SIZE] = MOEPGF16_INV_TABLE;
 
 void
 maddrc16_shuffle_ssse3(uint8_t* region1, const uint8_t* region2,
@@ -105,3 +106,797 @@ mulrc16_shuffle_ssse3(uint8_t *region, uint8_t constant, size_t length)
 	}
 }
 
+void
+mulrc_copy16_shuffle_ssse3(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m128i in, out, t1, t2, m1, m2, l, h;
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	t1 = _mm_loadu_si128((void *)tl[constant]);
+	t2 = _mm_slli_epi64(t1, 4);
+	m1 = _mm_set1_epi8(0x0f);
+	m2 = _mm_set1_epi8(0xf0);
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		in = _mm_load_si128((void *)region2);
+		l = _mm_and_si128(in, m1);
+		l = _mm_shuffle_epi8(t1, l);
+		h = _mm_and_si128(in, m2);
+		h = _mm_srli_epi64(h, 4);
+		h = _mm_shuffle_epi8(t2, h);
+		out = _mm_xor_si128(h, l);
+		_mm_store_si128((void *)region1, out);
+	}
+}
+
+void
+maddrc_multi16_shuffle_ssse3(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	size_t off;
+	int i;
+	register __m128i t1, t2, m1, m2, in, l, h, acc[4];
+
+	m1 = _mm_set1_epi8(0x0f);
+	m2 = _mm_set1_epi8(0xf0);
+
+	for (off=0; off+64<=length; off+=64) {
+		acc[0] = _mm_load_si128((void *)(region1+off));
+		acc[1] = _mm_load_si128((void *)(region1+off+16));
+		acc[2] = _mm_load_si128((void *)(region1+off+32));
+		acc[3] = _mm_load_si128((void *)(region1+off+48));
+
+		for (i=0; i<count; i++) {
+			if (constants[i] == 0)
+				continue;
+
+			t1 = _mm_loadu_si128((void *)tl[constants[i]]);
+			t2 = _mm_slli_epi64(t1, 4);
+
+			in = _mm_load_si128((void *)(regions[i]+off));
+			l = _mm_and_si128(in, m1);
+			l = _mm_shuffle_epi8(t1, l);
+			h = _mm_and_si128(in, m2);
+			h = _mm_srli_epi64(h, 4);
+			h = _mm_shuffle_epi8(t2, h);
+			acc[0] = _mm_xor_si128(acc[0], h);
+			acc[0] = _mm_xor_si128(acc[0], l);
+
+			in = _mm_load_si128((void *)(regions[i]+off+16));
+			l = _mm_and_si128(in, m1);
+			l = _mm_shuffle_epi8(t1, l);
+			h = _mm_and_si128(in, m2);
+			h = _mm_srli_epi64(h, 4);
+			h = _mm_shuffle_epi8(t2, h);
+			acc[1] = _mm_xor_si128(acc[1], h);
+			acc[1] = _mm_xor_si128(acc[1], l);
+
+			in = _mm_load_si128((void *)(regions[i]+off+32));
+			l = _mm_and_si128(in, m1);
+			l = _mm_shuffle_epi8(t1, l);
+			h = _mm_and_si128(in, m2);
+			h = _mm_srli_epi64(h, 4);
+			h = _mm_shuffle_epi8(t2, h);
+			acc[2] = _mm_xor_si128(acc[2], h);
+			acc[2] = _mm_xor_si128(acc[2], l);
+
+			in = _mm_load_si128((void *)(regions[i]+off+48));
+			l = _mm_and_si128(in, m1);
+			l = _mm_shuffle_epi8(t1, l);
+			h = _mm_and_si128(in, m2);
+			h = _mm_srli_epi64(h, 4);
+			h = _mm_shuffle_epi8(t2, h);
+			acc[3] = _mm_xor_si128(acc[3], h);
+			acc[3] = _mm_xor_si128(acc[3], l);
+		}
+
+		_mm_store_si128((void *)(region1+off), acc[0]);
+		_mm_store_si128((void *)(region1+off+16), acc[1]);
+		_mm_store_si128((void *)(region1+off+32), acc[2]);
+		_mm_store_si128((void *)(region1+off+48), acc[3]);
+	}
+
+	for (; off<length; off+=16) {
+		acc[0] = _mm_load_si128((void *)(region1+off));
+
+		for (i=0; i<count; i++) {
+			if (constants[i] == 0)
+				continue;
+
+			t1 = _mm_loadu_si128((void *)tl[constants[i]]);
+			t2 = _mm_slli_epi64(t1, 4);
+			in = _mm_load_si128((void *)(regions[i]+off));
+			l = _mm_and_si128(in, m1);
+			l = _mm_shuffle_epi8(t1, l);
+			h = _mm_and_si128(in, m2);
+			h = _mm_srli_epi64(h, 4);
+			h = _mm_shuffle_epi8(t2, h);
+			acc[0] = _mm_xor_si128(acc[0], h);
+			acc[0] = _mm_xor_si128(acc[0], l);
+		}
+
+		_mm_store_si128((void *)(region1+off), acc[0]);
+	}
+}
+
+void
+maddrc_fanout16_shuffle_ssse3(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	size_t off;
+	int i = 0;
+	uint8_t *r[4];
+	register __m128i t1[4], t2[4], m1, m2, in, l, h, out;
+
+	m1 = _mm_set1_epi8(0x0f);
+	m2 = _mm_set1_epi8(0xf0);
+
+	for (; i+4<=count; i+=4) {
+		r[0] = regions[i];
+		r[1] = regions[i+1];
+		r[2] = regions[i+2];
+		r[3] = regions[i+3];
+		t1[0] = _mm_loadu_si128((void *)tl[constants[i]]);
+		t2[0] = _mm_slli_epi64(t1[0], 4);
+		t1[1] = _mm_loadu_si128((void *)tl[constants[i+1]]);
+		t2[1] = _mm_slli_epi64(t1[1], 4);
+		t1[2] = _mm_loadu_si128((void *)tl[constants[i+2]]);
+		t2[2] = _mm_slli_epi64(t1[2], 4);
+		t1[3] = _mm_loadu_si128((void *)tl[constants[i+3]]);
+		t2[3] = _mm_slli_epi64(t1[3], 4);
+
+		for (off=0; off<length; off+=16) {
+			in = _mm_load_si128((void *)(region2+off));
+			l = _mm_and_si128(in, m1);
+			h = _mm_and_si128(in, m2);
+			h = _mm_srli_epi64(h, 4);
+
+			out = _mm_load_si128((void *)(r[0]+off));
+			out = _mm_xor_si128(out, _mm_shuffle_epi8(t1[0], l));
+			out = _mm_xor_si128(out, _mm_shuffle_epi8(t2[0], h));
+			_mm_store_si128((void *)(r[0]+off), out);
+
+			out = _mm_load_si128((void *)(r[1]+off));
+			out = _mm_xor_si128(out, _mm_shuffle_epi8(t1[1], l));
+			out = _mm_xor_si128(out, _mm_shuffle_epi8(t2[1], h));
+			_mm_store_si128((void *)(r[1]+off), out);
+
+			out = _mm_load_si128((void *)(r[2]+off));
+			out = _mm_xor_si128(out, _mm_shuffle_epi8(t1[2], l));
+			out = _mm_xor_si128(out, _mm_shuffle_epi8(t2[2], h));
+			_mm_store_si128((void *)(r[2]+off), out);
+
+			out = _mm_load_si128((void *)(r[3]+off));
+			out = _mm_xor_si128(out, _mm_shuffle_epi8(t1[3], l));
+			out = _mm_xor_si128(out, _mm_shuffle_epi8(t2[3], h));
+			_mm_store_si128((void *)(r[3]+off), out);
+		}
+	}
+
+	for (; i<count; i++)
+		maddrc16_shuffle_ssse3(regions[i], region2,
+						constants[i], length);
+}
+
+void
+maddrc3_16_shuffle_ssse3(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m128i in1, in2, out, t1, t2, m1, m2, l, h;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_sse2(region1, region2, region3, length);
+		return;
+	}
+	
+	t1 = _mm_loadu_si128((void *)tl[constant]);
+	t2 = _mm_slli_epi64(t1, 4);
+	m1 = _mm_set1_epi8(0x0f);
+	m2 = _mm_set1_epi8(0xf0);
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16) {
+		in2 = _mm_load_si128((void *)region3);
+		in1 = _mm_load_si128((void *)region2);
+		l = _mm_and_si128(in2, m1);
+		l = _mm_shuffle_epi8(t1, l);
+		h = _mm_and_si128(in2, m2);
+		h = _mm_srli_epi64(h, 4);
+		h = _mm_shuffle_epi8(t2, h);
+		out = _mm_xor_si128(h,l);
+		out = _mm_xor_si128(out, in1);
+		_mm_store_si128((void *)region1, out);
+	}
+}
+
+void
+invr16_shuffle_ssse3(uint8_t *region, size_t length)
+{
+	uint8_t *end;
+	register __m128i t1, t2, m1, m2, l, h;
+	register __m128i in;
+
+	t1 = _mm_loadu_si128((void *)(inverses));
+	t2 = _mm_slli_epi64(t1, 4);
+	m1 = _mm_set1_epi8(0x0f);
+	m2 = _mm_set1_epi8(0xf0);
+
+	for (end=region+length; region<end; region+=16) {
+		in = _mm_load_si128((void *)region);
+		l = _mm_and_si128(in, m1);
+		l = _mm_shuffle_epi8(t1, l);
+		h = _mm_and_si128(in, m2);
+		h = _mm_srli_epi64(h, 4);
+		h = _mm_shuffle_epi8(t2, h);
+		in = _mm_or_si128(h, l);
+		_mm_store_si128((void *)region, in);
+	}
+}
+
+void
+divr16_shuffle_ssse3(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	int i;
+	register __m128i t1, t2, m1, m2, l, h;
+	register __m128i a, b, t, acc, bl, nl, p;
+
+	t1 = _mm_loadu_si128((void *)(inverses));
+	t2 = _mm_slli_epi64(t1, 4);
+	m1 = _mm_set1_epi8(0x0f);
+	m2 = _mm_set1_epi8(0xf0);
+	bl = _mm_set1_epi8(0x11);
+	nl = _mm_set1_epi8(0xee);
+	p = _mm_set1_epi8((MOEPGF16_POLYNOMIAL & MOEPGF16_MASK) * 0x11);
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		a = _mm_load_si128((void *)region1);
+		b = _mm_load_si128((void *)region2);
+		l = _mm_and_si128(b, m1);
+		l = _mm_shuffle_epi8(t1, l);
+		h = _mm_and_si128(b, m2);
+		h = _mm_srli_epi64(h, 4);
+		h = _mm_shuffle_epi8(t2, h);
+		b = _mm_or_si128(h, l);
+
+		acc = _mm_setzero_si128();
+		for (i=0; i<MOEPGF16_EXPONENT; i++) {
+			t = _mm_and_si128(b, bl);
+			t = _mm_sub_epi16(_mm_slli_epi16(t, 4), t);
+			t = _mm_and_si128(t, a);
+			acc = _mm_xor_si128(acc, t);
+			b = _mm_srli_epi16(b, 1);
+
+			t = _mm_srli_epi16(a, 3);
+			t = _mm_and_si128(t, bl);
+			t = _mm_sub_epi16(_mm_slli_epi16(t, 4), t);
+			t = _mm_and_si128(t, p);
+			a = _mm_slli_epi16(a, 1);
+			a = _mm_and_si128(a, nl);
+			a = _mm_xor_si128(a, t);
+		}
+
+		_mm_store_si128((void *)region1, acc);
+	}
+}
+
+void
+maddrc_unaligned16_shuffle_ssse3(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	size_t rem;
+	register __m128i t1, t2, m1, m2, in1, in2, out, l, h;
+	register __m128i tail;
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_unaligned_sse2(region1, region2, length);
+		return;
+	}
+
+	if (length < 16) {
+		maddrc16_flat_table(region1, region2, constant, length);
+		return;
+	}
+
+	t1 = _mm_loadu_si128((void *)tl[constant]);
+	t2 = _mm_slli_epi64(t1, 4);
+	m1 = _mm_set1_epi8(0x0f);
+	m2 = _mm_set1_epi8(0xf0);
+
+	/* The last, possibly overlapping vector is computed before the main loop
+	 * modifies region1 and stored after it. */
+	in2 = _mm_loadu_si128((void *)(region2+length-16));
+	in1 = _mm_loadu_si128((void *)(region1+length-16));
+	l = _mm_and_si128(in2, m1);
+	l = _mm_shuffle_epi8(t1, l);
+	h = _mm_and_si128(in2, m2);
+	h = _mm_srli_epi64(h, 4);
+	h = _mm_shuffle_epi8(t2, h);
+	tail = _mm_xor_si128(h, l);
+	tail = _mm_xor_si128(tail, in1);
+	rem = length % 16;
+
+	for (end=region1+length-rem; region1<end; region1+=16, region2+=16) {
+		in2 = _mm_loadu_si128((void *)region2);
+		in1 = _mm_loadu_si128((void *)region1);
+		l = _mm_and_si128(in2, m1);
+		l = _mm_shuffle_epi8(t1, l);
+		h = _mm_and_si128(in2, m2);
+		h = _mm_srli_epi64(h, 4);
+		h = _mm_shuffle_epi8(t2, h);
+		out = _mm_xor_si128(h, l);
+		out = _mm_xor_si128(out, in1);
+		_mm_storeu_si128((void *)region1, out);
+	}
+
+	_mm_storeu_si128((void *)(region1+rem-16), tail);
+}
+
+void
+mulrc_unaligned16_shuffle_ssse3(uint8_t *region, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	size_t rem;
+	register __m128i t1, t2, m1, m2, in, out, l, h;
+	register __m128i tail;
+
+	if (constant == 0) {
+		memset(region, 0, length);
+		return;
+	}
+
+	if (constant == 1)
+		return;
+
+	if (length < 16) {
+		mulrc16_imul_scalar(region, constant, length);
+		return;
+	}
+
+	t1 = _mm_loadu_si128((void *)tl[constant]);
+	t2 = _mm_slli_epi64(t1, 4);
+	m1 = _mm_set1_epi8(0x0f);
+	m2 = _mm_set1_epi8(0xf0);
+
+	/* The last, possibly overlapping vector is computed before the main loop
+	 * modifies region and stored after it. */
+	in = _mm_loadu_si128((void *)(region+length-16));
+	l = _mm_and_si128(in, m1);
+	l = _mm_shuffle_epi8(t1, l);
+	h = _mm_and_si128(in, m2);
+	h = _mm_srli_epi64(h, 4);
+	h = _mm_shuffle_epi8(t2, h);
+	tail = _mm_xor_si128(h, l);
+	rem = length % 16;
+
+	for (end=region+length-rem; region<end; region+=16) {
+		in = _mm_loadu_si128((void *)region);
+		l = _mm_and_si128(in, m1);
+		l = _mm_shuffle_epi8(t1, l);
+		h = _mm_and_si128(in, m2);
+		h = _mm_srli_epi64(h, 4);
+		h = _mm_shuffle_epi8(t2, h);
+		out = _mm_xor_si128(h, l);
+		_mm_storeu_si128((void *)region, out);
+	}
+
+	_mm_storeu_si128((void *)(region+rem-16), tail);
+}
+
+void
+maddrc16_shuffle_ssse3_x2(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m128i t1, t2, m1, m2;
+	register __m128i in1[2], in2[2], out[2], l[2], h[2];
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_sse2(region1, region2, length);
+		return;
+	}
+
+	t1 = _mm_loadu_si128((void *)tl[constant]);
+	t2 = _mm_slli_epi64(t1, 4);
+	m1 = _mm_set1_epi8(0x0f);
+	m2 = _mm_set1_epi8(0xf0);
+
+	for (end=region1+(length & ~(size_t)31); region1<end; region1+=32, region2+=32) {
+		in2[0] = _mm_load_si128((void *)region2);
+		in2[1] = _mm_load_si128((void *)(region2+16));
+		in1[0] = _mm_load_si128((void *)region1);
+		in1[1] = _mm_load_si128((void *)(region1+16));
+		l[0] = _mm_and_si128(in2[0], m1);
+		l[1] = _mm_and_si128(in2[1], m1);
+		l[0] = _mm_shuffle_epi8(t1, l[0]);
+		l[1] = _mm_shuffle_epi8(t1, l[1]);
+		h[0] = _mm_and_si128(in2[0], m2);
+		h[1] = _mm_and_si128(in2[1], m2);
+		h[0] = _mm_srli_epi64(h[0], 4);
+		h[1] = _mm_srli_epi64(h[1], 4);
+		h[0] = _mm_shuffle_epi8(t2, h[0]);
+		h[1] = _mm_shuffle_epi8(t2, h[1]);
+		out[0] = _mm_xor_si128(h[0], l[0]);
+		out[1] = _mm_xor_si128(h[1], l[1]);
+		out[0] = _mm_xor_si128(out[0], in1[0]);
+		out[1] = _mm_xor_si128(out[1], in1[1]);
+		_mm_store_si128((void *)region1, out[0]);
+		_mm_store_si128((void *)(region1+16), out[1]);
+	}
+	for (end=region1+(length & 31); region1<end; region1+=16, region2+=16) {
+		in2[0] = _mm_load_si128((void *)region2);
+		in1[0] = _mm_load_si128((void *)region1);
+		l[0] = _mm_and_si128(in2[0], m1);
+		l[0] = _mm_shuffle_epi8(t1, l[0]);
+		h[0] = _mm_and_si128(in2[0], m2);
+		h[0] = _mm_srli_epi64(h[0], 4);
+		h[0] = _mm_shuffle_epi8(t2, h[0]);
+		out[0] = _mm_xor_si128(h[0], l[0]);
+		out[0] = _mm_xor_si128(out[0], in1[0]);
+		_mm_store_si128((void *)region1, out[0]);
+	}
+}
+
+void
+mulrc16_shuffle_ssse3_x2(uint8_t *region, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m128i t1, t2, m1, m2;
+	register __m128i in[2], out[2], l[2], h[2];
+
+	if (constant == 0) {
+		memset(region, 0, length);
+		return;
+	}
+
+	if (constant == 1)
+		return;
+
+	t1 = _mm_loadu_si128((void *)tl[constant]);
+	t2 = _mm_slli_epi64(t1, 4);
+	m1 = _mm_set1_epi8(0x0f);
+	m2 = _mm_set1_epi8(0xf0);
+
+	for (end=region+(length & ~(size_t)31); region<end; region+=32) {
+		in[0] = _mm_load_si128((void *)region);
+		in[1] = _mm_load_si128((void *)(region+16));
+		l[0] = _mm_and_si128(in[0], m1);
+		l[1] = _mm_and_si128(in[1], m1);
+		l[0] = _mm_shuffle_epi8(t1, l[0]);
+		l[1] = _mm_shuffle_epi8(t1, l[1]);
+		h[0] = _mm_and_si128(in[0], m2);
+		h[1] = _mm_and_si128(in[1], m2);
+		h[0] = _mm_srli_epi64(h[0], 4);
+		h[1] = _mm_srli_epi64(h[1], 4);
+		h[0] = _mm_shuffle_epi8(t2, h[0]);
+		h[1] = _mm_shuffle_epi8(t2, h[1]);
+		out[0] = _mm_xor_si128(h[0], l[0]);
+		out[1] = _mm_xor_si128(h[1], l[1]);
+		_mm_store_si128((void *)region, out[0]);
+		_mm_store_si128((void *)(region+16), out[1]);
+	}
+	for (end=region+(length & 31); region<end; region+=16) {
+		in[0] = _mm_load_si128((void *)region);
+		l[0] = _mm_and_si128(in[0], m1);
+		l[0] = _mm_shuffle_epi8(t1, l[0]);
+		h[0] = _mm_and_si128(in[0], m2);
+		h[0] = _mm_srli_epi64(h[0], 4);
+		h[0] = _mm_shuffle_epi8(t2, h[0]);
+		out[0] = _mm_xor_si128(h[0], l[0]);
+		_mm_store_si128((void *)region, out[0]);
+	}
+}
+
+void
+maddrc16_shuffle_ssse3_x4(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m128i t1, t2, m1, m2;
+	register __m128i in1[4], in2[4], out[4], l[4], h[4];
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_sse2(region1, region2, length);
+		return;
+	}
+
+	t1 = _mm_loadu_si128((void *)tl[constant]);
+	t2 = _mm_slli_epi64(t1, 4);
+	m1 = _mm_set1_epi8(0x0f);
+	m2 = _mm_set1_epi8(0xf0);
+
+	for (end=region1+(length & ~(size_t)63); region1<end; region1+=64, region2+=64) {
+		in2[0] = _mm_load_si128((void *)region2);
+		in2[1] = _mm_load_si128((void *)(region2+16));
+		in2[2] = _mm_load_si128((void *)(region2+32));
+		in2[3] = _mm_load_si128((void *)(region2+48));
+		in1[0] = _mm_load_si128((void *)region1);
+		in1[1] = _mm_load_si128((void *)(region1+16));
+		in1[2] = _mm_load_si128((void *)(region1+32));
+		in1[3] = _mm_load_si128((void *)(region1+48));
+		l[0] = _mm_and_si128(in2[0], m1);
+		l[1] = _mm_and_si128(in2[1], m1);
+		l[2] = _mm_and_si128(in2[2], m1);
+		l[3] = _mm_and_si128(in2[3], m1);
+		l[0] = _mm_shuffle_epi8(t1, l[0]);
+		l[1] = _mm_shuffle_epi8(t1, l[1]);
+		l[2] = _mm_shuffle_epi8(t1, l[2]);
+		l[3] = _mm_shuffle_epi8(t1, l[3]);
+		h[0] = _mm_and_si128(in2[0], m2);
+		h[1] = _mm_and_si128(in2[1], m2);
+		h[2] = _mm_and_si128(in2[2], m2);
+		h[3] = _mm_and_si128(in2[3], m2);
+		h[0] = _mm_srli_epi64(h[0], 4);
+		h[1] = _mm_srli_epi64(h[1], 4);
+		h[2] = _mm_srli_epi64(h[2], 4);
+		h[3] = _mm_srli_epi64(h[3], 4);
+		h[0] = _mm_shuffle_epi8(t2, h[0]);
+		h[1] = _mm_shuffle_epi8(t2, h[1]);
+		h[2] = _mm_shuffle_epi8(t2, h[2]);
+		h[3] = _mm_shuffle_epi8(t2, h[3]);
+		out[0] = _mm_xor_si128(h[0], l[0]);
+		out[1] = _mm_xor_si128(h[1], l[1]);
+		out[2] = _mm_xor_si128(h[2], l[2]);
+		out[3] = _mm_xor_si128(h[3], l[3]);
+		out[0] = _mm_xor_si128(out[0], in1[0]);
+		out[1] = _mm_xor_si128(out[1], in1[1]);
+		out[2] = _mm_xor_si128(out[2], in1[2]);
+		out[3] = _mm_xor_si128(out[3], in1[3]);
+		_mm_store_si128((void *)region1, out[0]);
+		_mm_store_si128((void *)(region1+16), out[1]);
+		_mm_store_si128((void *)(region1+32), out[2]);
+		_mm_store_si128((void *)(region1+48), out[3]);
+	}
+	for (end=region1+(length & 63); region1<end; region1+=16, region2+=16) {
+		in2[0] = _mm_load_si128((void *)region2);
+		in1[0] = _mm_load_si128((void *)region1);
+		l[0] = _mm_and_si128(in2[0], m1);
+		l[0] = _mm_shuffle_epi8(t1, l[0]);
+		h[0] = _mm_and_si128(in2[0], m2);
+		h[0] = _mm_srli_epi64(h[0], 4);
+		h[0] = _mm_shuffle_epi8(t2, h[0]);
+		out[0] = _mm_xor_si128(h[0], l[0]);
+		out[0] = _mm_xor_si128(out[0], in1[0]);
+		_mm_store_si128((void *)region1, out[0]);
+	}
+}
+
+void
+mulrc16_shuffle_ssse3_x4(uint8_t *region, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m128i t1, t2, m1, m2;
+	register __m128i in[4], out[4], l[4], h[4];
+
+	if (constant == 0) {
+		memset(region, 0, length);
+		return;
+	}
+
+	if (constant == 1)
+		return;
+
+	t1 = _mm_loadu_si128((void *)tl[constant]);
+	t2 = _mm_slli_epi64(t1, 4);
+	m1 = _mm_set1_epi8(0x0f);
+	m2 = _mm_set1_epi8(0xf0);
+
+	for (end=region+(length & ~(size_t)63); region<end; region+=64) {
+		in[0] = _mm_load_si128((void *)region);
+		in[1] = _mm_load_si128((void *)(region+16));
+		in[2] = _mm_load_si128((void *)(region+32));
+		in[3] = _mm_load_si128((void *)(region+48));
+		l[0] = _mm_and_si128(in[0], m1);
+		l[1] = _mm_and_si128(in[1], m1);
+		l[2] = _mm_and_si128(in[2], m1);
+		l[3] = _mm_and_si128(in[3], m1);
+		l[0] = _mm_shuffle_epi8(t1, l[0]);
+		l[1] = _mm_shuffle_epi8(t1, l[1]);
+		l[2] = _mm_shuffle_epi8(t1, l[2]);
+		l[3] = _mm_shuffle_epi8(t1, l[3]);
+		h[0] = _mm_and_si128(in[0], m2);
+		h[1] = _mm_and_si128(in[1], m2);
+		h[2] = _mm_and_si128(in[2], m2);
+		h[3] = _mm_and_si128(in[3], m2);
+		h[0] = _mm_srli_epi64(h[0], 4);
+		h[1] = _mm_srli_epi64(h[1], 4);
+		h[2] = _mm_srli_epi64(h[2], 4);
+		h[3] = _mm_srli_epi64(h[3], 4);
+		h[0] = _mm_shuffle_epi8(t2, h[0]);
+		h[1] = _mm_shuffle_epi8(t2, h[1]);
+		h[2] = _mm_shuffle_epi8(t2, h[2]);
+		h[3] = _mm_shuffle_epi8(t2, h[3]);
+		out[0] = _mm_xor_si128(h[0], l[0]);
+		out[1] = _mm_xor_si128(h[1], l[1]);
+		out[2] = _mm_xor_si128(h[2], l[2]);
+		out[3] = _mm_xor_si128(h[3], l[3]);
+		_mm_store_si128((void *)region, out[0]);
+		_mm_store_si128((void *)(region+16), out[1]);
+		_mm_store_si128((void *)(region+32), out[2]);
+		_mm_store_si128((void *)(region+48), out[3]);
+	}
+	for (end=region+(length & 63); region<end; region+=16) {
+		in[0] = _mm_load_si128((void *)region);
+		l[0] = _mm_and_si128(in[0], m1);
+		l[0] = _mm_shuffle_epi8(t1, l[0]);
+		h[0] = _mm_and_si128(in[0], m2);
+		h[0] = _mm_srli_epi64(h[0], 4);
+		h[0] = _mm_shuffle_epi8(t2, h[0]);
+		out[0] = _mm_xor_si128(h[0], l[0]);
+		_mm_store_si128((void *)region, out[0]);
+	}
+}
+
+void
+maddrc_prefetch16_shuffle_ssse3(uint8_t *region1, const uint8_t *region2,
+			uint8_t constant, size_t length, size_t distance)
+{
+	uint8_t *end;
+	register __m128i t1, t2, m1, m2;
+	register __m128i in1[4], in2[4], out[4], l[4], h[4];
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_prefetch_sse2(region1, region2, length, distance);
+		return;
+	}
+
+	t1 = _mm_loadu_si128((void *)tl[constant]);
+	t2 = _mm_slli_epi64(t1, 4);
+	m1 = _mm_set1_epi8(0x0f);
+	m2 = _mm_set1_epi8(0xf0);
+
+	for (end=region1+(length & ~(size_t)63); region1<end; region1+=64, region2+=64) {
+		_mm_prefetch((const char *)(region2+distance), _MM_HINT_T0);
+		_mm_prefetch((const char *)(region1+distance), _MM_HINT_T0);
+		in2[0] = _mm_load_si128((void *)region2);
+		in2[1] = _mm_load_si128((void *)(region2+16));
+		in2[2] = _mm_load_si128((void *)(region2+32));
+		in2[3] = _mm_load_si128((void *)(region2+48));
+		in1[0] = _mm_load_si128((void *)region1);
+		in1[1] = _mm_load_si128((void *)(region1+16));
+		in1[2] = _mm_load_si128((void *)(region1+32));
+		in1[3] = _mm_load_si128((void *)(region1+48));
+		l[0] = _mm_and_si128(in2[0], m1);
+		l[1] = _mm_and_si128(in2[1], m1);
+		l[2] = _mm_and_si128(in2[2], m1);
+		l[3] = _mm_and_si128(in2[3], m1);
+		l[0] = _mm_shuffle_epi8(t1, l[0]);
+		l[1] = _mm_shuffle_epi8(t1, l[1]);
+		l[2] = _mm_shuffle_epi8(t1, l[2]);
+		l[3] = _mm_shuffle_epi8(t1, l[3]);
+		h[0] = _mm_and_si128(in2[0], m2);
+		h[1] = _mm_and_si128(in2[1], m2);
+		h[2] = _mm_and_si128(in2[2], m2);
+		h[3] = _mm_and_si128(in2[3], m2);
+		h[0] = _mm_srli_epi64(h[0], 4);
+		h[1] = _mm_srli_epi64(h[1], 4);
+		h[2] = _mm_srli_epi64(h[2], 4);
+		h[3] = _mm_srli_epi64(h[3], 4);
+		h[0] = _mm_shuffle_epi8(t2, h[0]);
+		h[1] = _mm_shuffle_epi8(t2, h[1]);
+		h[2] = _mm_shuffle_epi8(t2, h[2]);
+		h[3] = _mm_shuffle_epi8(t2, h[3]);
+		out[0] = _mm_xor_si128(h[0], l[0]);
+		out[1] = _mm_xor_si128(h[1], l[1]);
+		out[2] = _mm_xor_si128(h[2], l[2]);
+		out[3] = _mm_xor_si128(h[3], l[3]);
+		out[0] = _mm_xor_si128(out[0], in1[0]);
+		out[1] = _mm_xor_si128(out[1], in1[1]);
+		out[2] = _mm_xor_si128(out[2], in1[2]);
+		out[3] = _mm_xor_si128(out[3], in1[3]);
+		_mm_store_si128((void *)region1, out[0]);
+		_mm_store_si128((void *)(region1+16), out[1]);
+		_mm_store_si128((void *)(region1+32), out[2]);
+		_mm_store_si128((void *)(region1+48), out[3]);
+	}
+	for (end=region1+(length & 63); region1<end; region1+=16, region2+=16) {
+		in2[0] = _mm_load_si128((void *)region2);
+		in1[0] = _mm_load_si128((void *)region1);
+		l[0] = _mm_and_si128(in2[0], m1);
+		l[0] = _mm_shuffle_epi8(t1, l[0]);
+		h[0] = _mm_and_si128(in2[0], m2);
+		h[0] = _mm_srli_epi64(h[0], 4);
+		h[0] = _mm_shuffle_epi8(t2, h[0]);
+		out[0] = _mm_xor_si128(h[0], l[0]);
+		out[0] = _mm_xor_si128(out[0], in1[0]);
+		_mm_store_si128((void *)region1, out[0]);
+	}
+}
+
+void
+mulrc_prefetch16_shuffle_ssse3(uint8_t *region, uint8_t constant, size_t length,
+							size_t distance)
+{
+	uint8_t *end;
+	register __m128i t1, t2, m1, m2;
+	register __m128i in[4], out[4], l[4], h[4];
+
+	if (constant == 0) {
+		memset(region, 0, length);
+		return;
+	}
+
+	if (constant == 1)
+		return;
+
+	t1 = _mm_loadu_si128((void *)tl[constant]);
+	t2 = _mm_slli_epi64(t1, 4);
+	m1 = _mm_set1_epi8(0x0f);
+	m2 = _mm_set1_epi8(0xf0);
+
+	for (end=region+(length & ~(size_t)63); region<end; region+=64) {
+		_mm_prefetch((const char *)(region+distance), _MM_HINT_T0);
+		in[0] = _mm_load_si128((void *)region);
+		in[1] = _mm_load_si128((void *)(region+16));
+		in[2] = _mm_load_si128((void *)(region+32));
+		in[3] = _mm_load_si128((void *)(region+48));
+		l[0] = _mm_and_si128(in[0], m1);
+		l[1] = _mm_and_si128(in[1], m1);
+		l[2] = _mm_and_si128(in[2], m1);
+		l[3] = _mm_and_si128(in[3], m1);
+		l[0] = _mm_shuffle_epi8(t1, l[0]);
+		l[1] = _mm_shuffle_epi8(t1, l[1]);
+		l[2] = _mm_shuffle_epi8(t1, l[2]);
+		l[3] = _mm_shuffle_epi8(t1, l[3]);
+		h[0] = _mm_and_si128(in[0], m2);
+		h[1] = _mm_and_si128(in[1], m2);
+		h[2] = _mm_and_si128(in[2], m2);
+		h[3] = _mm_and_si128(in[3], m2);
+		h[0] = _mm_srli_epi64(h[0], 4);
+		h[1] = _mm_srli_epi64(h[1], 4);
+		h[2] = _mm_srli_epi64(h[2], 4);
+		h[3] = _mm_srli_epi64(h[3], 4);
+		h[0] = _mm_shuffle_epi8(t2, h[0]);
+		h[1] = _mm_shuffle_epi8(t2, h[1]);
+		h[2] = _mm_shuffle_epi8(t2, h[2]);
+		h[3] = _mm_shuffle_epi8(t2, h[3]);
+		out[0] = _mm_xor_si128(h[0], l[0]);
+		out[1] = _mm_xor_si128(h[1], l[1]);
+		out[2] = _mm_xor_si128(h[2], l[2]);
+		out[3] = _mm_xor_si128(h[3], l[3]);
+		_mm_store_si128((void *)region, out[0]);
+		_mm_store_si128((void *)(region+16), out[1]);
+		_mm_store_si128((void *)(region+32), out[2]);
+		_mm_store_si128((void *)(region+48), out[3]);
+	}
+	for (end=region+(length & 63); region<end; region+=16) {
+		in[0] = _mm_load_si128((void *)region);
+		l[0] = _mm_and_si128(in[0], m1);
+		l[0] = _mm_shuffle_epi8(t1, l[0]);
+		h[0] = _mm_and_si128(in[0], m2);
+		h[0] = _mm_srli_epi64(h[0], 4);
+		h[0] = _mm_shuffle_epi8(t2, h[0]);
+		out[0] = _mm_xor_si128(h[0], l[0]);
+		_mm_store_si128((void *)region, out[0]);
+	}
+}
@@ -321,7 +321,7 @@
 0xa0,0xaf,0xad,0xa2,0xa9,0xa6,0xa4,0xab,0xa1,0xae,0xac,0xa3,0xa8,0xa7,0xa5,0xaa}\
 }
 
-#ifdef __x86_64__
+#ifndef __arm__
 #define MOEPGF16_SHUFFLE_LOW_TABLE { \
 {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},\
 {0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f},\
@@ -358,7 +358,13 @@
 {0x00,0xe0,0xf0,0x10,0xd0,0x30,0x20,0xc0,0x90,0x70,0x60,0x80,0x40,0xa0,0xb0,0x50},\
 {0x00,0xf0,0xd0,0x20,0x90,0x60,0x40,0xb0,0x10,0xe0,0xc0,0x30,0x80,0x70,0x50,0xa0}\
 }
-#endif //__x86_64__
+#define MOEPGF16_AFFINE_TABLE { \
+0x0000000000000000,0x0102040810204080,0x0809020480902040,0x090b060c90b060c0,\
+0x040c090240c09020,0x050e0d0a50e0d0a0,0x0c050b06c050b060,0x0d070f0ed070f0e0,\
+0x02060c092060c090,0x0304080130408010,0x0a0f0e0da0f0e0d0,0x0b0d0a05b0d0a050,\
+0x060a050b60a050b0,0x0708010370801030,0x0e03070fe03070f0,0x0f010307f0103070\
+}
+#endif //!__arm__
 
 #ifdef __arm__
 #define MOEPGF16_SHUFFLE_LOW_TABLE { \
@@ -27,6 +27,38 @@
 #include "gf2.h"
 #include "xor.h"
 
+/*
+ * Number of source regions passed to a multi-input xor at once. Regions with
+ * zero constants are dropped, the remaining ones are xored into region1 in
+ * batches so that region1 is read and written once per batch instead of once
+ * per source region.
+ */
+#define XORR_MULTI_BATCH	32
+
+typedef void (*xorr_multi_t)(uint8_t *, const uint8_t **, int, size_t);
+
+static inline void
+maddrc_multi2_batched(xorr_multi_t xorr_multi, uint8_t *region1,
+			const uint8_t **regions, const uint8_t *constants,
+			int count, size_t length)
+{
+	const uint8_t *batch[XORR_MULTI_BATCH];
+	int i, n = 0;
+
+	for (i=0; i<count; i++) {
+		if (constants[i] == 0)
+			continue;
+		batch[n++] = regions[i];
+		if (n == XORR_MULTI_BATCH) {
+			xorr_multi(region1, batch, n, length);
+			n = 0;
+		}
+	}
+
+	if (n > 0)
+		xorr_multi(region1, batch, n, length);
+}
+
 inline uint8_t
 inv2(uint8_t element)
 {
@@ -64,6 +96,147 @@ mulrc2(uint8_t *region, uint8_t constant, size_t length)
 		memset(region, 0, length);
 }
 
+inline void
+mulrc_copy2(uint8_t *region1, const uint8_t *region2, uint8_t constant,
+								size_t length)
+{
+	if (constant == 0)
+		memset(region1, 0, length);
+	else
+		memmove(region1, region2, length);
+}
+
+inline void
+invr2(uint8_t *region, size_t length)
+{
+	(void) region;
+	(void) length;
+}
+
+inline void
+maddrc_multi2_scalar(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++) {
+		if (constants[i] != 0)
+			xorr_scalar(region1, regions[i], length);
+	}
+}
+
+inline void
+maddrc_multi2_gpr32(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++) {
+		if (constants[i] != 0)
+			xorr_gpr32(region1, regions[i], length);
+	}
+}
+
+inline void
+maddrc_multi2_gpr64(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	maddrc_multi2_batched(xorr_multi_gpr64, region1, regions, constants,
+								count, length);
+}
+
+inline void
+maddrc_fanout2_scalar(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++) {
+		if (constants[i] != 0)
+			xorr_scalar(regions[i], region2, length);
+	}
+}
+
+inline void
+maddrc_fanout2_gpr32(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++) {
+		if (constants[i] != 0)
+			xorr_gpr32(regions[i], region2, length);
+	}
+}
+
+inline void
+maddrc_fanout2_gpr64(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++) {
+		if (constants[i] != 0)
+			xorr_gpr64(regions[i], region2, length);
+	}
+}
+
+inline void
+maddrc3_2_scalar(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	if (constant == 0)
+		memmove(region1, region2, length);
+	else
+		xorr3_scalar(region1, region2, region3, length);
+}
+
+inline void
+maddrc3_2_gpr32(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	if (constant == 0)
+		memmove(region1, region2, length);
+	else
+		xorr3_gpr32(region1, region2, region3, length);
+}
+
+inline void
+maddrc3_2_gpr64(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	if (constant == 0)
+		memmove(region1, region2, length);
+	else
+		xorr3_gpr64(region1, region2, region3, length);
+}
+
+inline void
+mulrr2_scalar(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	andr_scalar(region1, region2, length);
+}
+
+inline void
+maddrr2_scalar(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, size_t length)
+{
+	xorandr_scalar(region1, region2, region3, length);
+}
+
+inline void
+mulrr2_gpr64(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	andr_gpr64(region1, region2, length);
+}
+
+inline void
+maddrr2_gpr64(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, size_t length)
+{
+	xorandr_gpr64(region1, region2, region3, length);
+}
+
 #ifdef __x86_64__
 inline void
 maddrc2_sse2(uint8_t *region1, const uint8_t *region2,
@@ -88,9 +261,191 @@ maddrc2_avx512(uint8_t *region1, const uint8_t *region2,
 	if (constant != 0)
 		xorr_avx512(region1, region2, length);
 }
+
+inline void
+maddrc_prefetch2_sse2(uint8_t *region1, const uint8_t *region2,
+			uint8_t constant, size_t length, size_t distance)
+{
+	if (constant != 0)
+		xorr_prefetch_sse2(region1, region2, length, distance);
+}
+
+inline void
+maddrc_prefetch2_avx2(uint8_t *region1, const uint8_t *region2,
+			uint8_t constant, size_t length, size_t distance)
+{
+	if (constant != 0)
+		xorr_prefetch_avx2(region1, region2, length, distance);
+}
+
+inline void
+maddrc_prefetch2_avx512(uint8_t *region1, const uint8_t *region2,
+			uint8_t constant, size_t length, size_t distance)
+{
+	if (constant != 0)
+		xorr_prefetch_avx512(region1, region2, length, distance);
+}
+
+inline void
+maddrc_multi2_sse2(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++) {
+		if (constants[i] != 0)
+			xorr_sse2(region1, regions[i], length);
+	}
+}
+
+inline void
+maddrc_multi2_avx2(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	maddrc_multi2_batched(xorr_multi_avx2, region1, regions, constants,
+								count, length);
+}
+
+inline void
+maddrc_multi2_avx512(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	maddrc_multi2_batched(xorr_multi_avx512, region1, regions, constants,
+								count, length);
+}
+
+inline void
+maddrc_fanout2_sse2(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++) {
+		if (constants[i] != 0)
+			xorr_sse2(regions[i], region2, length);
+	}
+}
+
+inline void
+maddrc_fanout2_avx2(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++) {
+		if (constants[i] != 0)
+			xorr_avx2(regions[i], region2, length);
+	}
+}
+
+inline void
+maddrc_fanout2_avx512(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++) {
+		if (constants[i] != 0)
+			xorr_avx512(regions[i], region2, length);
+	}
+}
+
+inline void
+maddrc3_2_sse2(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	if (constant == 0)
+		memmove(region1, region2, length);
+	else
+		xorr3_sse2(region1, region2, region3, length);
+}
+
+inline void
+maddrc3_2_avx2(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	if (constant == 0)
+		memmove(region1, region2, length);
+	else
+		xorr3_avx2(region1, region2, region3, length);
+}
+
+inline void
+maddrc3_2_avx512(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	if (constant == 0)
+		memmove(region1, region2, length);
+	else
+		xorr3_avx512(region1, region2, region3, length);
+}
+
+inline void
+mulrr2_sse2(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	andr_sse2(region1, region2, length);
+}
+
+inline void
+maddrr2_sse2(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, size_t length)
+{
+	xorandr_sse2(region1, region2, region3, length);
+}
+
+inline void
+mulrr2_avx2(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	andr_avx2(region1, region2, length);
+}
+
+inline void
+maddrr2_avx2(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, size_t length)
+{
+	xorandr_avx2(region1, region2, region3, length);
+}
+
+inline void
+mulrr2_avx512(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	andr_avx512(region1, region2, length);
+}
+
+inline void
+maddrr2_avx512(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, size_t length)
+{
+	xorandr_avx512(region1, region2, region3, length);
+}
+
+inline void
+maddrc_unaligned2_sse2(uint8_t *region1, const uint8_t *region2,
+				uint8_t constant, size_t length)
+{
+	if (constant != 0)
+		xorr_unaligned_sse2(region1, region2, length);
+}
+
+inline void
+maddrc_unaligned2_avx2(uint8_t *region1, const uint8_t *region2,
+				uint8_t constant, size_t length)
+{
+	if (constant != 0)
+		xorr_unaligned_avx2(region1, region2, length);
+}
+
+inline void
+maddrc_unaligned2_avx512(uint8_t *region1, const uint8_t *region2,
+				uint8_t constant, size_t length)
+{
+	if (constant != 0)
+		xorr_unaligned_avx512(region1, region2, length);
+}
+
 #endif
 
-#ifdef __arm__
+#if defined(__arm__) || defined(__aarch64__)
 inline void
 maddrc2_neon(uint8_t *region1, const uint8_t *region2,
 				uint8_t constant, size_t length)
@@ -98,5 +453,62 @@ maddrc2_neon(uint8_t *region1, const uint8_t *region2,
 	if (constant != 0)
 		xorr_neon_128(region1, region2, length);
 }
+
+inline void
+maddrc_multi2_neon(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++) {
+		if (constants[i] != 0)
+			xorr_neon_128(region1, regions[i], length);
+	}
+}
+
+inline void
+maddrc_fanout2_neon(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++) {
+		if (constants[i] != 0)
+			xorr_neon_128(regions[i], region2, length);
+	}
+}
+
+inline void
+maddrc3_2_neon(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	if (constant == 0)
+		memmove(region1, region2, length);
+	else
+		xorr3_neon_128(region1, region2, region3, length);
+}
+
+inline void
+mulrr2_neon(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	andr_neon_128(region1, region2, length);
+}
+
+inline void
+maddrr2_neon(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, size_t length)
+{
+	xorandr_neon_128(region1, region2, region3, length);
+}
+#endif
+
+#ifdef __aarch64__
+inline void
+maddrc_multi2_neon_sha3(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	maddrc_multi2_batched(xorr_multi_neon_sha3, region1, regions, constants,
+								count, length);
+}
 #endif
 
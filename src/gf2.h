@@ -33,15 +33,73 @@ void maddrc2_gpr32(uint8_t *region1, const uint8_t *region2, uint8_t constant, s
 void maddrc2_gpr64(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 
 void mulrc2(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void invr2(uint8_t *region, size_t length);
+
+void maddrc_multi2_scalar(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_multi2_gpr32(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_multi2_gpr64(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+
+void maddrc_fanout2_scalar(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout2_gpr32(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout2_gpr64(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+
+void maddrc3_2_scalar(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_2_gpr32(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_2_gpr64(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+
+void mulrr2_scalar(uint8_t *region1, const uint8_t *region2, size_t length);
+void mulrr2_gpr64(uint8_t *region1, const uint8_t *region2, size_t length);
+void maddrr2_scalar(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void maddrr2_gpr64(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
 
 #ifdef __x86_64__
 void maddrc2_sse2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void maddrc2_avx2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void maddrc2_avx512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_prefetch2_sse2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length, size_t distance);
+void maddrc_prefetch2_avx2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length, size_t distance);
+void maddrc_prefetch2_avx512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length, size_t distance);
+
+void maddrc_multi2_sse2(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_multi2_avx2(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_multi2_avx512(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+
+void maddrc_fanout2_sse2(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout2_avx2(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout2_avx512(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+
+void maddrc3_2_sse2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_2_avx2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_2_avx512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+
+void mulrr2_sse2(uint8_t *region1, const uint8_t *region2, size_t length);
+void mulrr2_avx2(uint8_t *region1, const uint8_t *region2, size_t length);
+void mulrr2_avx512(uint8_t *region1, const uint8_t *region2, size_t length);
+void maddrr2_sse2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void maddrr2_avx2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void maddrr2_avx512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+
+void maddrc_unaligned2_sse2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_unaligned2_avx2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_unaligned2_avx512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 #endif
 
-#ifdef __arm__
+#if defined(__arm__) || defined(__aarch64__)
 void maddrc2_neon(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+
+void maddrc_multi2_neon(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+
+void maddrc_fanout2_neon(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+
+void maddrc3_2_neon(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+
+void mulrr2_neon(uint8_t *region1, const uint8_t *region2, size_t length);
+void maddrr2_neon(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+#endif
+
+#ifdef __aarch64__
+void maddrc_multi2_neon_sha3(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
 #endif
 
 #endif
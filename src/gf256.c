@@ -208,6 +208,36 @@ void mulrc256_pdiv(uint8_t *region, uint8_t constant, size_t length)
 	}
 }
 
+void
+mulrc_copy256_pdiv(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	const uint8_t *p = pt[constant];
+	uint8_t r[8];
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	for (; length; region1++, region2++, length--) {
+		r[0] = (*region2 &   1) ? p[0] : 0;
+		r[1] = (*region2 &   2) ? p[1] : 0;
+		r[2] = (*region2 &   4) ? p[2] : 0;
+		r[3] = (*region2 &   8) ? p[3] : 0;
+		r[4] = (*region2 &  16) ? p[4] : 0;
+		r[5] = (*region2 &  32) ? p[5] : 0;
+		r[6] = (*region2 &  64) ? p[6] : 0;
+		r[7] = (*region2 & 128) ? p[7] : 0;
+		*region1 = r[0]^r[1]^r[2]^r[3]^r[4]^r[5]^r[6]^r[7];
+	}
+}
+
 void
 mulrc256_imul_gpr32(uint8_t *region, uint8_t constant, size_t length)
 {
@@ -237,6 +267,38 @@ mulrc256_imul_gpr32(uint8_t *region, uint8_t constant, size_t length)
 	}
 }
 
+void
+mulrc_copy256_imul_gpr32(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	const uint8_t *p = pt[constant];
+	uint32_t r32[8];
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	for (end=region1+length; region1<end; region1+=4, region2+=4) {
+		r32[0] = ((*(uint32_t *)region2 & 0x01010101)>>0)*p[0];
+		r32[1] = ((*(uint32_t *)region2 & 0x02020202)>>1)*p[1];
+		r32[2] = ((*(uint32_t *)region2 & 0x04040404)>>2)*p[2];
+		r32[3] = ((*(uint32_t *)region2 & 0x08080808)>>3)*p[3];
+		r32[4] = ((*(uint32_t *)region2 & 0x10101010)>>4)*p[4];
+		r32[5] = ((*(uint32_t *)region2 & 0x20202020)>>5)*p[5];
+		r32[6] = ((*(uint32_t *)region2 & 0x40404040)>>6)*p[6];
+		r32[7] = ((*(uint32_t *)region2 & 0x80808080)>>7)*p[7];
+		*(uint32_t *)region1 =
+			r32[0]^r32[1]^r32[2]^r32[3]^r32[4]^r32[5]^r32[6]^r32[7];
+	}
+}
+
 void
 mulrc256_imul_gpr64(uint8_t *region, uint8_t constant, size_t length)
 {
@@ -266,3 +328,309 @@ mulrc256_imul_gpr64(uint8_t *region, uint8_t constant, size_t length)
 	}
 }
 
+void
+mulrc_copy256_imul_gpr64(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	const uint8_t *p = pt[constant];
+	uint64_t r64[8];
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	for (end=region1+length; region1<end; region1+=8, region2+=8) {
+		r64[0] = ((*(uint64_t *)region2 & 0x0101010101010101)>>0)*p[0];
+		r64[1] = ((*(uint64_t *)region2 & 0x0202020202020202)>>1)*p[1];
+		r64[2] = ((*(uint64_t *)region2 & 0x0404040404040404)>>2)*p[2];
+		r64[3] = ((*(uint64_t *)region2 & 0x0808080808080808)>>3)*p[3];
+		r64[4] = ((*(uint64_t *)region2 & 0x1010101010101010)>>4)*p[4];
+		r64[5] = ((*(uint64_t *)region2 & 0x2020202020202020)>>5)*p[5];
+		r64[6] = ((*(uint64_t *)region2 & 0x4040404040404040)>>6)*p[6];
+		r64[7] = ((*(uint64_t *)region2 & 0x8080808080808080)>>7)*p[7];
+		*(uint64_t *)region1 =
+			r64[0]^r64[1]^r64[2]^r64[3]^r64[4]^r64[5]^r64[6]^r64[7];
+	}
+}
+
+void
+maddrc_multi256_pdiv(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++)
+		maddrc256_pdiv(region1, regions[i], constants[i], length);
+}
+
+void
+maddrc_multi256_imul_gpr64(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++)
+		maddrc256_imul_gpr64(region1, regions[i], constants[i], length);
+}
+
+void
+maddrc_fanout256_pdiv(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++)
+		maddrc256_pdiv(regions[i], region2, constants[i], length);
+}
+
+void
+maddrc_fanout256_imul_gpr64(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++)
+		maddrc256_imul_gpr64(regions[i], region2, constants[i], length);
+}
+
+void
+maddrc3_256_pdiv(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	const uint8_t *p = pt[constant];
+	uint8_t r[8];
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_scalar(region1, region2, region3, length);
+		return ;
+	}
+
+	for (; length; region1++, region2++, region3++, length--) {
+		r[0] = (*region3 &   1) ? p[0] : 0;
+		r[1] = (*region3 &   2) ? p[1] : 0;
+		r[2] = (*region3 &   4) ? p[2] : 0;
+		r[3] = (*region3 &   8) ? p[3] : 0;
+		r[4] = (*region3 &  16) ? p[4] : 0;
+		r[5] = (*region3 &  32) ? p[5] : 0;
+		r[6] = (*region3 &  64) ? p[6] : 0;
+		r[7] = (*region3 & 128) ? p[7] : 0;
+		*region1 = *region2 ^ r[0]^r[1]^r[2]^r[3]^r[4]^r[5]^r[6]^r[7];
+	}
+}
+
+void
+maddrc3_256_log_table(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t l;
+	int x;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_scalar(region1, region2, region3, length);
+		return ;
+	}
+
+	l = logt[constant];
+
+	for (; length; region1++, region2++, region3++, length--) {
+		if (*region3 == 0) {
+			*region1 = *region2;
+			continue;
+		}
+		x = l + logt[*region3];
+		*region1 = *region2 ^ alogt[x];
+	}
+}
+
+void
+maddrc3_256_flat_table(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_scalar(region1, region2, region3, length);
+		return ;
+	}
+
+	for (; length; region1++, region2++, region3++, length--) {
+		*region1 = *region2 ^ mult[constant][*region3];
+	}
+}
+
+void
+maddrc3_256_imul_gpr32(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	const uint8_t *p = pt[constant];
+	uint32_t r32[8];
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_gpr32(region1, region2, region3, length);
+		return;
+	}
+
+	for (end=region1+length; region1<end;
+			region1+=4, region2+=4, region3+=4) {
+		r32[0] = ((*(uint32_t *)region3 & 0x01010101)>>0)*p[0];
+		r32[1] = ((*(uint32_t *)region3 & 0x02020202)>>1)*p[1];
+		r32[2] = ((*(uint32_t *)region3 & 0x04040404)>>2)*p[2];
+		r32[3] = ((*(uint32_t *)region3 & 0x08080808)>>3)*p[3];
+		r32[4] = ((*(uint32_t *)region3 & 0x10101010)>>4)*p[4];
+		r32[5] = ((*(uint32_t *)region3 & 0x20202020)>>5)*p[5];
+		r32[6] = ((*(uint32_t *)region3 & 0x40404040)>>6)*p[6];
+		r32[7] = ((*(uint32_t *)region3 & 0x80808080)>>7)*p[7];
+		*(uint32_t *)region1 = *(uint32_t *)region2
+					^r32[0]^r32[1]^r32[2]^r32[3]
+					^r32[4]^r32[5]^r32[6]^r32[7];
+	}
+}
+
+void
+maddrc3_256_imul_gpr64(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	const uint8_t *p = pt[constant];
+	uint64_t r64[8];
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_gpr64(region1, region2, region3, length);
+		return;
+	}
+
+	for (end=region1+length; region1<end;
+			region1+=8, region2+=8, region3+=8) {
+		r64[0] = ((*(uint64_t *)region3 & 0x0101010101010101)>>0)*p[0];
+		r64[1] = ((*(uint64_t *)region3 & 0x0202020202020202)>>1)*p[1];
+		r64[2] = ((*(uint64_t *)region3 & 0x0404040404040404)>>2)*p[2];
+		r64[3] = ((*(uint64_t *)region3 & 0x0808080808080808)>>3)*p[3];
+		r64[4] = ((*(uint64_t *)region3 & 0x1010101010101010)>>4)*p[4];
+		r64[5] = ((*(uint64_t *)region3 & 0x2020202020202020)>>5)*p[5];
+		r64[6] = ((*(uint64_t *)region3 & 0x4040404040404040)>>6)*p[6];
+		r64[7] = ((*(uint64_t *)region3 & 0x8080808080808080)>>7)*p[7];
+		*(uint64_t *)region1 = *(uint64_t *)region2
+					^r64[0]^r64[1]^r64[2]^r64[3]
+					^r64[4]^r64[5]^r64[6]^r64[7];
+	}
+}
+
+void
+mulrr256_flat_table(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	for (; length; region1++, region2++, length--) {
+		*region1 = mult[*region1][*region2];
+	}
+}
+
+void
+maddrr256_flat_table(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, size_t length)
+{
+	for (; length; region1++, region2++, region3++, length--) {
+		*region1 ^= mult[*region2][*region3];
+	}
+}
+
+void
+mulrr256_imul_gpr64(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	uint64_t a, b, t, acc, p;
+	int i;
+
+	p = (uint64_t)(MOEPGF256_POLYNOMIAL & MOEPGF256_MASK) * 0x0101010101010101;
+
+	for (end=region1+length; region1<end; region1+=8, region2+=8) {
+		a = *(uint64_t *)region1;
+		b = *(uint64_t *)region2;
+		acc = 0;
+
+		for (i=0; i<MOEPGF256_EXPONENT; i++) {
+			t = b & 0x0101010101010101;
+			acc ^= a & ((t << 8) - t);
+			b >>= 1;
+			t = (a >> 7) & 0x0101010101010101;
+			t = ((t << 8) - t) & p;
+			a = ((a << 1) & 0xfefefefefefefefe) ^ t;
+		}
+
+		*(uint64_t *)region1 = acc;
+	}
+}
+
+void
+maddrr256_imul_gpr64(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, size_t length)
+{
+	uint8_t *end;
+	uint64_t a, b, t, acc, p;
+	int i;
+
+	p = (uint64_t)(MOEPGF256_POLYNOMIAL & MOEPGF256_MASK) * 0x0101010101010101;
+
+	for (end=region1+length; region1<end;
+			region1+=8, region2+=8, region3+=8) {
+		a = *(uint64_t *)region2;
+		b = *(uint64_t *)region3;
+		acc = *(uint64_t *)region1;
+
+		for (i=0; i<MOEPGF256_EXPONENT; i++) {
+			t = b & 0x0101010101010101;
+			acc ^= a & ((t << 8) - t);
+			b >>= 1;
+			t = (a >> 7) & 0x0101010101010101;
+			t = ((t << 8) - t) & p;
+			a = ((a << 1) & 0xfefefefefefefefe) ^ t;
+		}
+
+		*(uint64_t *)region1 = acc;
+	}
+}
+
+void
+invr256_flat_table(uint8_t *region, size_t length)
+{
+	for (; length; region++, length--) {
+		*region = inverses[*region];
+	}
+}
+
+void
+divr256_flat_table(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	for (; length; region1++, region2++, length--) {
+		*region1 = mult[*region1][inverses[*region2]];
+	}
+}
@@ -35,9 +35,42 @@ void maddrc256_imul_gpr32(uint8_t *region1, const uint8_t *region2, uint8_t cons
 void maddrc256_imul_gpr64(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 
 void mulrc256_pdiv(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy256_pdiv(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void mulrc256_imul_gpr32(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy256_imul_gpr32(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void mulrc256_imul_gpr64(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy256_imul_gpr64(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void mulrc256_imul_avx512(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy256_imul_avx512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+
+void maddrc_multi256_pdiv(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_multi256_imul_gpr64(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+
+void maddrc_fanout256_pdiv(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout256_imul_gpr64(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+
+void maddrc3_256_pdiv(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_256_log_table(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_256_flat_table(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_256_imul_gpr32(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_256_imul_gpr64(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+
+void mulrr256_flat_table(uint8_t *region1, const uint8_t *region2, size_t length);
+void mulrr256_imul_gpr64(uint8_t *region1, const uint8_t *region2, size_t length);
+void maddrr256_flat_table(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void maddrr256_imul_gpr64(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+
+void invr256_flat_table(uint8_t *region, size_t length);
+void divr256_flat_table(uint8_t *region1, const uint8_t *region2, size_t length);
+
+#ifndef __arm__
+void maddrc256_shuffle_vector(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc256_shuffle_vector(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy256_shuffle_vector(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi256_shuffle_vector(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout256_shuffle_vector(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_256_shuffle_vector(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+#endif
 
 #ifdef __x86_64__
 void maddrc256_imul_sse2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
@@ -46,17 +79,174 @@ void maddrc256_imul_avx512(uint8_t *region1, const uint8_t *region2, uint8_t con
 void maddrc256_shuffle_ssse3(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void maddrc256_shuffle_avx2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void maddrc256_shuffle_avx512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc256_shuffle_ssse3_x2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc256_shuffle_ssse3_x4(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc256_shuffle_avx2_x2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc256_shuffle_avx2_x4(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc256_shuffle_avx512_x2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc256_shuffle_avx512_x4(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_prefetch256_shuffle_ssse3(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length, size_t distance);
+void maddrc_prefetch256_shuffle_avx2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length, size_t distance);
+void maddrc_prefetch256_shuffle_avx512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length, size_t distance);
 void maddrc256_gfni128(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void maddrc256_gfni256(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void maddrc256_gfni512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 
 void mulrc256_imul_sse2(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy256_imul_sse2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void mulrc256_shuffle_ssse3(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy256_shuffle_ssse3(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void mulrc256_shuffle_avx2(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy256_shuffle_avx2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_copy_nt256_shuffle_avx2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void mulrc256_shuffle_avx512(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy256_shuffle_avx512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_copy_nt256_shuffle_avx512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc256_shuffle_ssse3_x2(uint8_t *region, uint8_t constant, size_t length);
+void mulrc256_shuffle_ssse3_x4(uint8_t *region, uint8_t constant, size_t length);
+void mulrc256_shuffle_avx2_x2(uint8_t *region, uint8_t constant, size_t length);
+void mulrc256_shuffle_avx2_x4(uint8_t *region, uint8_t constant, size_t length);
+void mulrc256_shuffle_avx512_x2(uint8_t *region, uint8_t constant, size_t length);
+void mulrc256_shuffle_avx512_x4(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_prefetch256_shuffle_ssse3(uint8_t *region, uint8_t constant, size_t length, size_t distance);
+void mulrc_prefetch256_shuffle_avx2(uint8_t *region, uint8_t constant, size_t length, size_t distance);
+void mulrc_prefetch256_shuffle_avx512(uint8_t *region, uint8_t constant, size_t length, size_t distance);
 void mulrc256_gfni128(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy256_gfni128(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void mulrc256_gfni256(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy256_gfni256(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_copy_nt256_gfni256(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void mulrc256_gfni512(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy256_gfni512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_copy_nt256_gfni512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+
+void maddrc_multi256_imul_sse2(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_multi256_shuffle_ssse3(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_multi256_shuffle_avx2(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_multi256_shuffle_avx512(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_multi256_gfni128(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_multi256_gfni256(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_multi256_gfni512(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+
+void maddrc_fanout256_imul_sse2(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout256_shuffle_ssse3(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout256_shuffle_avx2(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout256_shuffle_avx512(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout256_gfni128(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout256_gfni256(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout256_gfni512(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+
+void maddrc3_256_imul_sse2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_256_imul_avx2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_256_imul_avx512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_256_shuffle_ssse3(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_256_shuffle_avx2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_nt256_shuffle_avx2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_256_shuffle_avx512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_nt256_shuffle_avx512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_256_gfni128(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_256_gfni256(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_nt256_gfni256(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_256_gfni512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_nt256_gfni512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+
+void mulrr256_imul_sse2(uint8_t *region1, const uint8_t *region2, size_t length);
+void mulrr256_imul_avx2(uint8_t *region1, const uint8_t *region2, size_t length);
+void mulrr256_imul_avx512(uint8_t *region1, const uint8_t *region2, size_t length);
+void mulrr256_gfni128(uint8_t *region1, const uint8_t *region2, size_t length);
+void mulrr256_gfni256(uint8_t *region1, const uint8_t *region2, size_t length);
+void mulrr256_gfni512(uint8_t *region1, const uint8_t *region2, size_t length);
+void maddrr256_imul_sse2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void maddrr256_imul_avx2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void maddrr256_imul_avx512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void maddrr256_gfni128(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void maddrr256_gfni256(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void maddrr256_gfni512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+
+void invr256_shuffle_ssse3(uint8_t *region, size_t length);
+void invr256_shuffle_avx2(uint8_t *region, size_t length);
+void invr256_shuffle_avx512(uint8_t *region, size_t length);
+void invr256_gfni128(uint8_t *region, size_t length);
+void invr256_gfni256(uint8_t *region, size_t length);
+void invr256_gfni512(uint8_t *region, size_t length);
+void divr256_shuffle_ssse3(uint8_t *region1, const uint8_t *region2, size_t length);
+void divr256_shuffle_avx2(uint8_t *region1, const uint8_t *region2, size_t length);
+void divr256_shuffle_avx512(uint8_t *region1, const uint8_t *region2, size_t length);
+void divr256_gfni128(uint8_t *region1, const uint8_t *region2, size_t length);
+void divr256_gfni256(uint8_t *region1, const uint8_t *region2, size_t length);
+void divr256_gfni512(uint8_t *region1, const uint8_t *region2, size_t length);
+
+void maddrc_unaligned256_shuffle_ssse3(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_unaligned256_shuffle_avx2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_unaligned256_shuffle_avx512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_unaligned256_gfni128(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_unaligned256_gfni256(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_unaligned256_gfni512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_unaligned256_shuffle_ssse3(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_unaligned256_shuffle_avx2(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_unaligned256_shuffle_avx512(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_unaligned256_gfni128(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_unaligned256_gfni256(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_unaligned256_gfni512(uint8_t *region, uint8_t constant, size_t length);
+
+void maddrc256_gfni_affine128(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc256_gfni_affine128(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy256_gfni_affine128(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi256_gfni_affine128(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout256_gfni_affine128(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_256_gfni_affine128(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc_unaligned256_gfni_affine128(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_unaligned256_gfni_affine128(uint8_t *region, uint8_t constant, size_t length);
+void maddrc256_gfni_affine256(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc256_gfni_affine256(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy256_gfni_affine256(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi256_gfni_affine256(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout256_gfni_affine256(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_256_gfni_affine256(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc_unaligned256_gfni_affine256(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_unaligned256_gfni_affine256(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy_nt256_gfni_affine256(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc3_nt256_gfni_affine256(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc256_gfni_affine512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc256_gfni_affine512(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy256_gfni_affine512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi256_gfni_affine512(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout256_gfni_affine512(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_256_gfni_affine512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc_unaligned256_gfni_affine512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_unaligned256_gfni_affine512(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy_nt256_gfni_affine512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc3_nt256_gfni_affine512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+
+void maddrc256_lookup_avx512vbmi(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc256_lookup_avx512vbmi(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy256_lookup_avx512vbmi(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi256_lookup_avx512vbmi(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc3_256_lookup_avx512vbmi(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc_unaligned256_lookup_avx512vbmi(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_unaligned256_lookup_avx512vbmi(uint8_t *region, uint8_t constant, size_t length);
+
+void maddrc256_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc256_shuffle_avx512vl(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy256_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi256_shuffle_avx512vl(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout256_shuffle_avx512vl(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_256_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc_unaligned256_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_unaligned256_shuffle_avx512vl(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy_nt256_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc3_nt256_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+
+void maddrc256_gfni_affine_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc256_gfni_affine_avx512vl(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy256_gfni_affine_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi256_gfni_affine_avx512vl(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout256_gfni_affine_avx512vl(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_256_gfni_affine_avx512vl(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc_unaligned256_gfni_affine_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_unaligned256_gfni_affine_avx512vl(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy_nt256_gfni_affine_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc3_nt256_gfni_affine_avx512vl(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
 #endif
 
 #ifdef __arm__
@@ -65,6 +255,43 @@ void maddrc256_imul_neon_64(uint8_t *region1, const uint8_t *region2, uint8_t co
 void maddrc256_imul_neon_128(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 
 void mulrc256_shuffle_neon_64(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy256_shuffle_neon_64(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+
+void maddrc_multi256_shuffle_neon_64(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+
+void maddrc_fanout256_shuffle_neon_64(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+
+void maddrc3_256_shuffle_neon_64(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_256_imul_neon_64(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_256_imul_neon_128(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+
+void mulrr256_imul_neon_128(uint8_t *region1, const uint8_t *region2, size_t length);
+void maddrr256_imul_neon_128(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+
+void invr256_shuffle_neon_64(uint8_t *region, size_t length);
+void divr256_shuffle_neon_64(uint8_t *region1, const uint8_t *region2, size_t length);
+#endif
+
+#ifdef __aarch64__
+void maddrc256_shuffle_neon_128(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc256_shuffle_neon_128(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy256_shuffle_neon_128(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi256_shuffle_neon_128(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout256_shuffle_neon_128(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_256_shuffle_neon_128(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void invr256_shuffle_neon_128(uint8_t *region, size_t length);
+
+void maddrc256_pmull_neon_128(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc256_pmull_neon_128(uint8_t *region, uint8_t constant, size_t length);
+void maddrc3_256_pmull_neon_128(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void mulrr256_pmull_neon_128(uint8_t *region1, const uint8_t *region2, size_t length);
+void maddrr256_pmull_neon_128(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void divr256_pmull_neon_128(uint8_t *region1, const uint8_t *region2, size_t length);
+
+void maddrc256_shuffle_neon_sha3(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi256_shuffle_neon_sha3(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout256_shuffle_neon_sha3(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_256_shuffle_neon_sha3(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
 #endif
 
 #endif
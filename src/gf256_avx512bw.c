@@ -43,6 +43,7 @@
 
 static const uint8_t tl[MOEPGF256_SIZE][16] = MOEPGF256_SHUFFLE_LOW_TABLE;
 static const uint8_t th[MOEPGF256_SIZE][16] = MOEPGF256_SHUFFLE_HIGH_TABLE;
+static const uint8_t inverses[MOEPGF256_SIZE] = MOEPGF256_INV_TABLE;
 
 void
 maddrc256_shuffle_avx512(uint8_t *region1, const uint8_t *region2,
@@ -75,8 +76,7 @@ maddrc256_shuffle_avx512(uint8_t *region1, const uint8_t *region2,
 		h = _mm512_and_si512(in2, m2);
 		h = _mm512_srli_epi64(h, 4);
 		h = _mm512_shuffle_epi8(t2, h);
-		out = _mm512_xor_si512(h, l);
-		out = _mm512_xor_si512(out, in1);
+		out = _mm512_ternarylogic_epi64(h, l, in1, 0x96);
 		_mm512_store_si512((void *)region1, out);
 	}
 }
@@ -116,3 +116,930 @@ mulrc256_shuffle_avx512(uint8_t *region, uint8_t constant, size_t length)
 	}
 }
 
+void
+mulrc_copy256_shuffle_avx512(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m512i t1, t2, m1, m2, in, out, l, h;
+	register __m128i bc;
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = _mm512_broadcast_i32x4(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = _mm512_broadcast_i32x4(bc);
+	m1 = _mm512_set1_epi8(0x0f);
+	m2 = _mm512_set1_epi8(0xf0);
+
+	for (end=region1+length; region1<end; region1+=64, region2+=64) {
+		in = _mm512_load_si512((void *)region2);
+		l = _mm512_and_si512(in, m1);
+		l = _mm512_shuffle_epi8(t1, l);
+		h = _mm512_and_si512(in, m2);
+		h = _mm512_srli_epi64(h, 4);
+		h = _mm512_shuffle_epi8(t2, h);
+		out = _mm512_xor_si512(h, l);
+		_mm512_store_si512((void *)region1, out);
+	}
+}
+
+void
+maddrc_multi256_shuffle_avx512(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	size_t off;
+	int i;
+	register __m512i t1, t2, m1, m2, in, l, h, acc[4];
+	register __m128i bc;
+
+	m1 = _mm512_set1_epi8(0x0f);
+	m2 = _mm512_set1_epi8(0xf0);
+
+	for (off=0; off+256<=length; off+=256) {
+		acc[0] = _mm512_load_si512((void *)(region1+off));
+		acc[1] = _mm512_load_si512((void *)(region1+off+64));
+		acc[2] = _mm512_load_si512((void *)(region1+off+128));
+		acc[3] = _mm512_load_si512((void *)(region1+off+192));
+
+		for (i=0; i<count; i++) {
+			if (constants[i] == 0)
+				continue;
+
+			bc = _mm_load_si128((void *)tl[constants[i]]);
+			t1 = _mm512_broadcast_i32x4(bc);
+			bc = _mm_load_si128((void *)th[constants[i]]);
+			t2 = _mm512_broadcast_i32x4(bc);
+
+			in = _mm512_load_si512((void *)(regions[i]+off));
+			l = _mm512_and_si512(in, m1);
+			l = _mm512_shuffle_epi8(t1, l);
+			h = _mm512_and_si512(in, m2);
+			h = _mm512_srli_epi64(h, 4);
+			h = _mm512_shuffle_epi8(t2, h);
+			acc[0] = _mm512_ternarylogic_epi64(acc[0], h, l, 0x96);
+
+			in = _mm512_load_si512((void *)(regions[i]+off+64));
+			l = _mm512_and_si512(in, m1);
+			l = _mm512_shuffle_epi8(t1, l);
+			h = _mm512_and_si512(in, m2);
+			h = _mm512_srli_epi64(h, 4);
+			h = _mm512_shuffle_epi8(t2, h);
+			acc[1] = _mm512_ternarylogic_epi64(acc[1], h, l, 0x96);
+
+			in = _mm512_load_si512((void *)(regions[i]+off+128));
+			l = _mm512_and_si512(in, m1);
+			l = _mm512_shuffle_epi8(t1, l);
+			h = _mm512_and_si512(in, m2);
+			h = _mm512_srli_epi64(h, 4);
+			h = _mm512_shuffle_epi8(t2, h);
+			acc[2] = _mm512_ternarylogic_epi64(acc[2], h, l, 0x96);
+
+			in = _mm512_load_si512((void *)(regions[i]+off+192));
+			l = _mm512_and_si512(in, m1);
+			l = _mm512_shuffle_epi8(t1, l);
+			h = _mm512_and_si512(in, m2);
+			h = _mm512_srli_epi64(h, 4);
+			h = _mm512_shuffle_epi8(t2, h);
+			acc[3] = _mm512_ternarylogic_epi64(acc[3], h, l, 0x96);
+		}
+
+		_mm512_store_si512((void *)(region1+off), acc[0]);
+		_mm512_store_si512((void *)(region1+off+64), acc[1]);
+		_mm512_store_si512((void *)(region1+off+128), acc[2]);
+		_mm512_store_si512((void *)(region1+off+192), acc[3]);
+	}
+
+	for (; off<length; off+=64) {
+		acc[0] = _mm512_load_si512((void *)(region1+off));
+
+		for (i=0; i<count; i++) {
+			if (constants[i] == 0)
+				continue;
+
+			bc = _mm_load_si128((void *)tl[constants[i]]);
+			t1 = _mm512_broadcast_i32x4(bc);
+			bc = _mm_load_si128((void *)th[constants[i]]);
+			t2 = _mm512_broadcast_i32x4(bc);
+			in = _mm512_load_si512((void *)(regions[i]+off));
+			l = _mm512_and_si512(in, m1);
+			l = _mm512_shuffle_epi8(t1, l);
+			h = _mm512_and_si512(in, m2);
+			h = _mm512_srli_epi64(h, 4);
+			h = _mm512_shuffle_epi8(t2, h);
+			acc[0] = _mm512_ternarylogic_epi64(acc[0], h, l, 0x96);
+		}
+
+		_mm512_store_si512((void *)(region1+off), acc[0]);
+	}
+}
+
+void
+maddrc_fanout256_shuffle_avx512(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	size_t off;
+	int i = 0;
+	uint8_t *r[8];
+	register __m512i t1[8], t2[8], m1, m2, in, l, h, out;
+	register __m128i bc;
+
+	m1 = _mm512_set1_epi8(0x0f);
+	m2 = _mm512_set1_epi8(0xf0);
+
+	for (; i+8<=count; i+=8) {
+		r[0] = regions[i];
+		r[1] = regions[i+1];
+		r[2] = regions[i+2];
+		r[3] = regions[i+3];
+		r[4] = regions[i+4];
+		r[5] = regions[i+5];
+		r[6] = regions[i+6];
+		r[7] = regions[i+7];
+		bc = _mm_load_si128((void *)tl[constants[i]]);
+		t1[0] = _mm512_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i]]);
+		t2[0] = _mm512_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)tl[constants[i+1]]);
+		t1[1] = _mm512_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i+1]]);
+		t2[1] = _mm512_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)tl[constants[i+2]]);
+		t1[2] = _mm512_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i+2]]);
+		t2[2] = _mm512_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)tl[constants[i+3]]);
+		t1[3] = _mm512_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i+3]]);
+		t2[3] = _mm512_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)tl[constants[i+4]]);
+		t1[4] = _mm512_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i+4]]);
+		t2[4] = _mm512_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)tl[constants[i+5]]);
+		t1[5] = _mm512_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i+5]]);
+		t2[5] = _mm512_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)tl[constants[i+6]]);
+		t1[6] = _mm512_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i+6]]);
+		t2[6] = _mm512_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)tl[constants[i+7]]);
+		t1[7] = _mm512_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i+7]]);
+		t2[7] = _mm512_broadcast_i32x4(bc);
+
+		for (off=0; off<length; off+=64) {
+			in = _mm512_load_si512((void *)(region2+off));
+			l = _mm512_and_si512(in, m1);
+			h = _mm512_and_si512(in, m2);
+			h = _mm512_srli_epi64(h, 4);
+
+			out = _mm512_load_si512((void *)(r[0]+off));
+			out = _mm512_ternarylogic_epi64(out,
+					_mm512_shuffle_epi8(t1[0], l),
+					_mm512_shuffle_epi8(t2[0], h), 0x96);
+			_mm512_store_si512((void *)(r[0]+off), out);
+
+			out = _mm512_load_si512((void *)(r[1]+off));
+			out = _mm512_ternarylogic_epi64(out,
+					_mm512_shuffle_epi8(t1[1], l),
+					_mm512_shuffle_epi8(t2[1], h), 0x96);
+			_mm512_store_si512((void *)(r[1]+off), out);
+
+			out = _mm512_load_si512((void *)(r[2]+off));
+			out = _mm512_ternarylogic_epi64(out,
+					_mm512_shuffle_epi8(t1[2], l),
+					_mm512_shuffle_epi8(t2[2], h), 0x96);
+			_mm512_store_si512((void *)(r[2]+off), out);
+
+			out = _mm512_load_si512((void *)(r[3]+off));
+			out = _mm512_ternarylogic_epi64(out,
+					_mm512_shuffle_epi8(t1[3], l),
+					_mm512_shuffle_epi8(t2[3], h), 0x96);
+			_mm512_store_si512((void *)(r[3]+off), out);
+
+			out = _mm512_load_si512((void *)(r[4]+off));
+			out = _mm512_ternarylogic_epi64(out,
+					_mm512_shuffle_epi8(t1[4], l),
+					_mm512_shuffle_epi8(t2[4], h), 0x96);
+			_mm512_store_si512((void *)(r[4]+off), out);
+
+			out = _mm512_load_si512((void *)(r[5]+off));
+			out = _mm512_ternarylogic_epi64(out,
+					_mm512_shuffle_epi8(t1[5], l),
+					_mm512_shuffle_epi8(t2[5], h), 0x96);
+			_mm512_store_si512((void *)(r[5]+off), out);
+
+			out = _mm512_load_si512((void *)(r[6]+off));
+			out = _mm512_ternarylogic_epi64(out,
+					_mm512_shuffle_epi8(t1[6], l),
+					_mm512_shuffle_epi8(t2[6], h), 0x96);
+			_mm512_store_si512((void *)(r[6]+off), out);
+
+			out = _mm512_load_si512((void *)(r[7]+off));
+			out = _mm512_ternarylogic_epi64(out,
+					_mm512_shuffle_epi8(t1[7], l),
+					_mm512_shuffle_epi8(t2[7], h), 0x96);
+			_mm512_store_si512((void *)(r[7]+off), out);
+		}
+	}
+
+	for (; i+4<=count; i+=4) {
+		r[0] = regions[i];
+		r[1] = regions[i+1];
+		r[2] = regions[i+2];
+		r[3] = regions[i+3];
+		bc = _mm_load_si128((void *)tl[constants[i]]);
+		t1[0] = _mm512_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i]]);
+		t2[0] = _mm512_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)tl[constants[i+1]]);
+		t1[1] = _mm512_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i+1]]);
+		t2[1] = _mm512_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)tl[constants[i+2]]);
+		t1[2] = _mm512_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i+2]]);
+		t2[2] = _mm512_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)tl[constants[i+3]]);
+		t1[3] = _mm512_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i+3]]);
+		t2[3] = _mm512_broadcast_i32x4(bc);
+
+		for (off=0; off<length; off+=64) {
+			in = _mm512_load_si512((void *)(region2+off));
+			l = _mm512_and_si512(in, m1);
+			h = _mm512_and_si512(in, m2);
+			h = _mm512_srli_epi64(h, 4);
+
+			out = _mm512_load_si512((void *)(r[0]+off));
+			out = _mm512_ternarylogic_epi64(out,
+					_mm512_shuffle_epi8(t1[0], l),
+					_mm512_shuffle_epi8(t2[0], h), 0x96);
+			_mm512_store_si512((void *)(r[0]+off), out);
+
+			out = _mm512_load_si512((void *)(r[1]+off));
+			out = _mm512_ternarylogic_epi64(out,
+					_mm512_shuffle_epi8(t1[1], l),
+					_mm512_shuffle_epi8(t2[1], h), 0x96);
+			_mm512_store_si512((void *)(r[1]+off), out);
+
+			out = _mm512_load_si512((void *)(r[2]+off));
+			out = _mm512_ternarylogic_epi64(out,
+					_mm512_shuffle_epi8(t1[2], l),
+					_mm512_shuffle_epi8(t2[2], h), 0x96);
+			_mm512_store_si512((void *)(r[2]+off), out);
+
+			out = _mm512_load_si512((void *)(r[3]+off));
+			out = _mm512_ternarylogic_epi64(out,
+					_mm512_shuffle_epi8(t1[3], l),
+					_mm512_shuffle_epi8(t2[3], h), 0x96);
+			_mm512_store_si512((void *)(r[3]+off), out);
+		}
+	}
+
+	for (; i<count; i++)
+		maddrc256_shuffle_avx512(regions[i], region2,
+						constants[i], length);
+}
+
+void
+maddrc3_256_shuffle_avx512(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m512i t1, t2, m1, m2, in1, in2, out, l, h;
+	register __m128i bc;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_avx512(region1, region2, region3, length);
+		return;
+	}
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = _mm512_broadcast_i32x4 (bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = _mm512_broadcast_i32x4 (bc);
+	m1 = _mm512_set1_epi8(0x0f);
+	m2 = _mm512_set1_epi8(0xf0);
+
+	for (end=region1+length; region1<end;
+			region1+=64, region2+=64, region3+=64) {
+		in2 = _mm512_load_si512((void *)region3);
+		in1 = _mm512_load_si512((void *)region2);
+		l = _mm512_and_si512(in2, m1);
+		l = _mm512_shuffle_epi8(t1, l);
+		h = _mm512_and_si512(in2, m2);
+		h = _mm512_srli_epi64(h, 4);
+		h = _mm512_shuffle_epi8(t2, h);
+		out = _mm512_ternarylogic_epi64(h, l, in1, 0x96);
+		_mm512_store_si512((void *)region1, out);
+	}
+}
+
+void
+invr256_shuffle_avx512(uint8_t *region, size_t length)
+{
+	uint8_t *end;
+	int j;
+	__m512i it[16];
+	register __m512i m1, m2, l, h;
+	register __m512i in;
+	register __m128i bc;
+
+	for (j=0; j<16; j++) {
+		bc = _mm_loadu_si128((void *)(inverses + 16*j));
+		it[j] = _mm512_broadcast_i32x4(bc);
+	}
+	m1 = _mm512_set1_epi8(0x70);
+	m2 = _mm512_set1_epi8(0x10);
+
+	for (end=region+length; region<end; region+=64) {
+		in = _mm512_load_si512((void *)region);
+		h = _mm512_setzero_si512();
+		for (j=0; j<16; j++) {
+			l = _mm512_adds_epu8(in, m1);
+			l = _mm512_shuffle_epi8(it[j], l);
+			h = _mm512_or_si512(h, l);
+			in = _mm512_sub_epi8(in, m2);
+		}
+		_mm512_store_si512((void *)region, h);
+	}
+}
+
+void
+divr256_shuffle_avx512(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	int i, j;
+	__m512i it[16];
+	register __m512i m1, m2, l, h;
+	register __m512i a, b, t, acc, bl, nl, p;
+	register __m128i bc;
+
+	for (j=0; j<16; j++) {
+		bc = _mm_loadu_si128((void *)(inverses + 16*j));
+		it[j] = _mm512_broadcast_i32x4(bc);
+	}
+	m1 = _mm512_set1_epi8(0x70);
+	m2 = _mm512_set1_epi8(0x10);
+	bl = _mm512_set1_epi8(0x01);
+	nl = _mm512_set1_epi8(0xfe);
+	p = _mm512_set1_epi8(MOEPGF256_POLYNOMIAL & MOEPGF256_MASK);
+
+	for (end=region1+length; region1<end; region1+=64, region2+=64) {
+		a = _mm512_load_si512((void *)region1);
+		b = _mm512_load_si512((void *)region2);
+		h = _mm512_setzero_si512();
+		for (j=0; j<16; j++) {
+			l = _mm512_adds_epu8(b, m1);
+			l = _mm512_shuffle_epi8(it[j], l);
+			h = _mm512_or_si512(h, l);
+			b = _mm512_sub_epi8(b, m2);
+		}
+		b = h;
+
+		acc = _mm512_setzero_si512();
+		for (i=0; i<MOEPGF256_EXPONENT; i++) {
+			t = _mm512_and_si512(b, bl);
+			t = _mm512_sub_epi32(_mm512_slli_epi32(t, 8), t);
+			t = _mm512_and_si512(t, a);
+			acc = _mm512_xor_si512(acc, t);
+			b = _mm512_srli_epi32(b, 1);
+
+			t = _mm512_srli_epi32(a, 7);
+			t = _mm512_and_si512(t, bl);
+			t = _mm512_sub_epi32(_mm512_slli_epi32(t, 8), t);
+			t = _mm512_and_si512(t, p);
+			a = _mm512_slli_epi32(a, 1);
+			a = _mm512_and_si512(a, nl);
+			a = _mm512_xor_si512(a, t);
+		}
+
+		_mm512_store_si512((void *)region1, acc);
+	}
+}
+
+void
+maddrc_unaligned256_shuffle_avx512(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	__mmask64 k;
+	register __m512i t1, t2, m1, m2, in1, in2, out, l, h;
+	register __m128i bc;
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_unaligned_avx512(region1, region2, length);
+		return;
+	}
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = _mm512_broadcast_i32x4(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = _mm512_broadcast_i32x4(bc);
+	m1 = _mm512_set1_epi8(0x0f);
+	m2 = _mm512_set1_epi8(0xf0);
+
+	for (end=region1+(length & ~63); region1<end; region1+=64, region2+=64) {
+		in2 = _mm512_loadu_si512((void *)region2);
+		in1 = _mm512_loadu_si512((void *)region1);
+		l = _mm512_and_si512(in2, m1);
+		l = _mm512_shuffle_epi8(t1, l);
+		h = _mm512_and_si512(in2, m2);
+		h = _mm512_srli_epi64(h, 4);
+		h = _mm512_shuffle_epi8(t2, h);
+		out = _mm512_ternarylogic_epi64(h, l, in1, 0x96);
+		_mm512_storeu_si512((void *)region1, out);
+	}
+
+	if (!(length & 63))
+		return;
+
+	k = ((__mmask64)1 << (length & 63)) - 1;
+	in2 = _mm512_maskz_loadu_epi8(k, (void *)region2);
+	in1 = _mm512_maskz_loadu_epi8(k, (void *)region1);
+	l = _mm512_and_si512(in2, m1);
+	l = _mm512_shuffle_epi8(t1, l);
+	h = _mm512_and_si512(in2, m2);
+	h = _mm512_srli_epi64(h, 4);
+	h = _mm512_shuffle_epi8(t2, h);
+	out = _mm512_ternarylogic_epi64(h, l, in1, 0x96);
+	_mm512_mask_storeu_epi8((void *)region1, k, out);
+}
+
+void
+mulrc_unaligned256_shuffle_avx512(uint8_t *region, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	__mmask64 k;
+	register __m512i t1, t2, m1, m2, in, out, l, h;
+	register __m128i bc;
+
+	if (constant == 0) {
+		memset(region, 0, length);
+		return;
+	}
+
+	if (constant == 1)
+		return;
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = _mm512_broadcast_i32x4(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = _mm512_broadcast_i32x4(bc);
+	m1 = _mm512_set1_epi8(0x0f);
+	m2 = _mm512_set1_epi8(0xf0);
+
+	for (end=region+(length & ~63); region<end; region+=64) {
+		in = _mm512_loadu_si512((void *)region);
+		l = _mm512_and_si512(in, m1);
+		l = _mm512_shuffle_epi8(t1, l);
+		h = _mm512_and_si512(in, m2);
+		h = _mm512_srli_epi64(h, 4);
+		h = _mm512_shuffle_epi8(t2, h);
+		out = _mm512_xor_si512(h, l);
+		_mm512_storeu_si512((void *)region, out);
+	}
+
+	if (!(length & 63))
+		return;
+
+	k = ((__mmask64)1 << (length & 63)) - 1;
+	in = _mm512_maskz_loadu_epi8(k, (void *)region);
+	l = _mm512_and_si512(in, m1);
+	l = _mm512_shuffle_epi8(t1, l);
+	h = _mm512_and_si512(in, m2);
+	h = _mm512_srli_epi64(h, 4);
+	h = _mm512_shuffle_epi8(t2, h);
+	out = _mm512_xor_si512(h, l);
+	_mm512_mask_storeu_epi8((void *)region, k, out);
+}
+
+void
+mulrc_copy_nt256_shuffle_avx512(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m512i t1, t2, m1, m2, in, out, l, h;
+	register __m128i bc;
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = _mm512_broadcast_i32x4(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = _mm512_broadcast_i32x4(bc);
+	m1 = _mm512_set1_epi8(0x0f);
+	m2 = _mm512_set1_epi8(0xf0);
+
+	for (end=region1+length; region1<end; region1+=64, region2+=64) {
+		in = _mm512_load_si512((void *)region2);
+		l = _mm512_and_si512(in, m1);
+		l = _mm512_shuffle_epi8(t1, l);
+		h = _mm512_and_si512(in, m2);
+		h = _mm512_srli_epi64(h, 4);
+		h = _mm512_shuffle_epi8(t2, h);
+		out = _mm512_xor_si512(h, l);
+		_mm512_stream_si512((void *)region1, out);
+	}
+
+	_mm_sfence();
+}
+
+void
+maddrc3_nt256_shuffle_avx512(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m512i t1, t2, m1, m2, in1, in2, out, l, h;
+	register __m128i bc;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_avx512(region1, region2, region3, length);
+		return;
+	}
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = _mm512_broadcast_i32x4 (bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = _mm512_broadcast_i32x4 (bc);
+	m1 = _mm512_set1_epi8(0x0f);
+	m2 = _mm512_set1_epi8(0xf0);
+
+	for (end=region1+length; region1<end;
+			region1+=64, region2+=64, region3+=64) {
+		in2 = _mm512_load_si512((void *)region3);
+		in1 = _mm512_load_si512((void *)region2);
+		l = _mm512_and_si512(in2, m1);
+		l = _mm512_shuffle_epi8(t1, l);
+		h = _mm512_and_si512(in2, m2);
+		h = _mm512_srli_epi64(h, 4);
+		h = _mm512_shuffle_epi8(t2, h);
+		out = _mm512_ternarylogic_epi64(h, l, in1, 0x96);
+		_mm512_stream_si512((void *)region1, out);
+	}
+
+	_mm_sfence();
+}
+
+void
+maddrc256_shuffle_avx512_x2(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m512i t1, t2, m1, m2;
+	register __m512i in1[2], in2[2], out[2], l[2], h[2];
+	register __m128i bc;
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_avx512(region1, region2, length);
+		return;
+	}
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = _mm512_broadcast_i32x4(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = _mm512_broadcast_i32x4(bc);
+	m1 = _mm512_set1_epi8(0x0f);
+	m2 = _mm512_set1_epi8(0xf0);
+
+	for (end=region1+(length & ~(size_t)127); region1<end; region1+=128, region2+=128) {
+		in2[0] = _mm512_load_si512((void *)region2);
+		in2[1] = _mm512_load_si512((void *)(region2+64));
+		in1[0] = _mm512_load_si512((void *)region1);
+		in1[1] = _mm512_load_si512((void *)(region1+64));
+		l[0] = _mm512_and_si512(in2[0], m1);
+		l[1] = _mm512_and_si512(in2[1], m1);
+		l[0] = _mm512_shuffle_epi8(t1, l[0]);
+		l[1] = _mm512_shuffle_epi8(t1, l[1]);
+		h[0] = _mm512_and_si512(in2[0], m2);
+		h[1] = _mm512_and_si512(in2[1], m2);
+		h[0] = _mm512_srli_epi64(h[0], 4);
+		h[1] = _mm512_srli_epi64(h[1], 4);
+		h[0] = _mm512_shuffle_epi8(t2, h[0]);
+		h[1] = _mm512_shuffle_epi8(t2, h[1]);
+		out[0] = _mm512_ternarylogic_epi64(h[0], l[0], in1[0], 0x96);
+		out[1] = _mm512_ternarylogic_epi64(h[1], l[1], in1[1], 0x96);
+		_mm512_store_si512((void *)region1, out[0]);
+		_mm512_store_si512((void *)(region1+64), out[1]);
+	}
+	for (end=region1+(length & 127); region1<end; region1+=64, region2+=64) {
+		in2[0] = _mm512_load_si512((void *)region2);
+		in1[0] = _mm512_load_si512((void *)region1);
+		l[0] = _mm512_and_si512(in2[0], m1);
+		l[0] = _mm512_shuffle_epi8(t1, l[0]);
+		h[0] = _mm512_and_si512(in2[0], m2);
+		h[0] = _mm512_srli_epi64(h[0], 4);
+		h[0] = _mm512_shuffle_epi8(t2, h[0]);
+		out[0] = _mm512_ternarylogic_epi64(h[0], l[0], in1[0], 0x96);
+		_mm512_store_si512((void *)region1, out[0]);
+	}
+}
+
+void
+mulrc256_shuffle_avx512_x2(uint8_t *region, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m512i t1, t2, m1, m2;
+	register __m512i in[2], out[2], l[2], h[2];
+	register __m128i bc;
+
+	if (constant == 0) {
+		memset(region, 0, length);
+		return;
+	}
+
+	if (constant == 1)
+		return;
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = _mm512_broadcast_i32x4(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = _mm512_broadcast_i32x4(bc);
+	m1 = _mm512_set1_epi8(0x0f);
+	m2 = _mm512_set1_epi8(0xf0);
+
+	for (end=region+(length & ~(size_t)127); region<end; region+=128) {
+		in[0] = _mm512_load_si512((void *)region);
+		in[1] = _mm512_load_si512((void *)(region+64));
+		l[0] = _mm512_and_si512(in[0], m1);
+		l[1] = _mm512_and_si512(in[1], m1);
+		l[0] = _mm512_shuffle_epi8(t1, l[0]);
+		l[1] = _mm512_shuffle_epi8(t1, l[1]);
+		h[0] = _mm512_and_si512(in[0], m2);
+		h[1] = _mm512_and_si512(in[1], m2);
+		h[0] = _mm512_srli_epi64(h[0], 4);
+		h[1] = _mm512_srli_epi64(h[1], 4);
+		h[0] = _mm512_shuffle_epi8(t2, h[0]);
+		h[1] = _mm512_shuffle_epi8(t2, h[1]);
+		out[0] = _mm512_xor_si512(h[0], l[0]);
+		out[1] = _mm512_xor_si512(h[1], l[1]);
+		_mm512_store_si512((void *)region, out[0]);
+		_mm512_store_si512((void *)(region+64), out[1]);
+	}
+	for (end=region+(length & 127); region<end; region+=64) {
+		in[0] = _mm512_load_si512((void *)region);
+		l[0] = _mm512_and_si512(in[0], m1);
+		l[0] = _mm512_shuffle_epi8(t1, l[0]);
+		h[0] = _mm512_and_si512(in[0], m2);
+		h[0] = _mm512_srli_epi64(h[0], 4);
+		h[0] = _mm512_shuffle_epi8(t2, h[0]);
+		out[0] = _mm512_xor_si512(h[0], l[0]);
+		_mm512_store_si512((void *)region, out[0]);
+	}
+}
+
+void
+maddrc256_shuffle_avx512_x4(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m512i t1, t2, m1, m2;
+	register __m512i in1[4], in2[4], out[4], l[4], h[4];
+	register __m128i bc;
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_avx512(region1, region2, length);
+		return;
+	}
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = _mm512_broadcast_i32x4(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = _mm512_broadcast_i32x4(bc);
+	m1 = _mm512_set1_epi8(0x0f);
+	m2 = _mm512_set1_epi8(0xf0);
+
+	for (end=region1+(length & ~(size_t)255); region1<end; region1+=256, region2+=256) {
+		in2[0] = _mm512_load_si512((void *)region2);
+		in2[1] = _mm512_load_si512((void *)(region2+64));
+		in2[2] = _mm512_load_si512((void *)(region2+128));
+		in2[3] = _mm512_load_si512((void *)(region2+192));
+		in1[0] = _mm512_load_si512((void *)region1);
+		in1[1] = _mm512_load_si512((void *)(region1+64));
+		in1[2] = _mm512_load_si512((void *)(region1+128));
+		in1[3] = _mm512_load_si512((void *)(region1+192));
+		l[0] = _mm512_and_si512(in2[0], m1);
+		l[1] = _mm512_and_si512(in2[1], m1);
+		l[2] = _mm512_and_si512(in2[2], m1);
+		l[3] = _mm512_and_si512(in2[3], m1);
+		l[0] = _mm512_shuffle_epi8(t1, l[0]);
+		l[1] = _mm512_shuffle_epi8(t1, l[1]);
+		l[2] = _mm512_shuffle_epi8(t1, l[2]);
+		l[3] = _mm512_shuffle_epi8(t1, l[3]);
+		h[0] = _mm512_and_si512(in2[0], m2);
+		h[1] = _mm512_and_si512(in2[1], m2);
+		h[2] = _mm512_and_si512(in2[2], m2);
+		h[3] = _mm512_and_si512(in2[3], m2);
+		h[0] = _mm512_srli_epi64(h[0], 4);
+		h[1] = _mm512_srli_epi64(h[1], 4);
+		h[2] = _mm512_srli_epi64(h[2], 4);
+		h[3] = _mm512_srli_epi64(h[3], 4);
+		h[0] = _mm512_shuffle_epi8(t2, h[0]);
+		h[1] = _mm512_shuffle_epi8(t2, h[1]);
+		h[2] = _mm512_shuffle_epi8(t2, h[2]);
+		h[3] = _mm512_shuffle_epi8(t2, h[3]);
+		out[0] = _mm512_ternarylogic_epi64(h[0], l[0], in1[0], 0x96);
+		out[1] = _mm512_ternarylogic_epi64(h[1], l[1], in1[1], 0x96);
+		out[2] = _mm512_ternarylogic_epi64(h[2], l[2], in1[2], 0x96);
+		out[3] = _mm512_ternarylogic_epi64(h[3], l[3], in1[3], 0x96);
+		_mm512_store_si512((void *)region1, out[0]);
+		_mm512_store_si512((void *)(region1+64), out[1]);
+		_mm512_store_si512((void *)(region1+128), out[2]);
+		_mm512_store_si512((void *)(region1+192), out[3]);
+	}
+	for (end=region1+(length & 255); region1<end; region1+=64, region2+=64) {
+		in2[0] = _mm512_load_si512((void *)region2);
+		in1[0] = _mm512_load_si512((void *)region1);
+		l[0] = _mm512_and_si512(in2[0], m1);
+		l[0] = _mm512_shuffle_epi8(t1, l[0]);
+		h[0] = _mm512_and_si512(in2[0], m2);
+		h[0] = _mm512_srli_epi64(h[0], 4);
+		h[0] = _mm512_shuffle_epi8(t2, h[0]);
+		out[0] = _mm512_ternarylogic_epi64(h[0], l[0], in1[0], 0x96);
+		_mm512_store_si512((void *)region1, out[0]);
+	}
+}
+
+void
+mulrc256_shuffle_avx512_x4(uint8_t *region, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m512i t1, t2, m1, m2;
+	register __m512i in[4], out[4], l[4], h[4];
+	register __m128i bc;
+
+	if (constant == 0) {
+		memset(region, 0, length);
+		return;
+	}
+
+	if (constant == 1)
+		return;
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = _mm512_broadcast_i32x4(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = _mm512_broadcast_i32x4(bc);
+	m1 = _mm512_set1_epi8(0x0f);
+	m2 = _mm512_set1_epi8(0xf0);
+
+	for (end=region+(length & ~(size_t)255); region<end; region+=256) {
+		in[0] = _mm512_load_si512((void *)region);
+		in[1] = _mm512_load_si512((void *)(region+64));
+		in[2] = _mm512_load_si512((void *)(region+128));
+		in[3] = _mm512_load_si512((void *)(region+192));
+		l[0] = _mm512_and_si512(in[0], m1);
+		l[1] = _mm512_and_si512(in[1], m1);
+		l[2] = _mm512_and_si512(in[2], m1);
+		l[3] = _mm512_and_si512(in[3], m1);
+		l[0] = _mm512_shuffle_epi8(t1, l[0]);
+		l[1] = _mm512_shuffle_epi8(t1, l[1]);
+		l[2] = _mm512_shuffle_epi8(t1, l[2]);
+		l[3] = _mm512_shuffle_epi8(t1, l[3]);
+		h[0] = _mm512_and_si512(in[0], m2);
+		h[1] = _mm512_and_si512(in[1], m2);
+		h[2] = _mm512_and_si512(in[2], m2);
+		h[3] = _mm512_and_si512(in[3], m2);
+		h[0] = _mm512_srli_epi64(h[0], 4);
+		h[1] = _mm512_srli_epi64(h[1], 4);
+		h[2] = _mm512_srli_epi64(h[2], 4);
+		h[3] = _mm512_srli_epi64(h[3], 4);
+		h[0] = _mm512_shuffle_epi8(t2, h[0]);
+		h[1] = _mm512_shuffle_epi8(t2, h[1]);
+		h[2] = _mm512_shuffle_epi8(t2, h[2]);
+		h[3] = _mm512_shuffle_epi8(t2, h[3]);
+		out[0] = _mm512_xor_si512(h[0], l[0]);
+		out[1] = _mm512_xor_si512(h[1], l[1]);
+		out[2] = _mm512_xor_si512(h[2], l[2]);
+		out[3] = _mm512_xor_si512(h[3], l[3]);
+		_mm512_store_si512((void *)region, out[0]);
+		_mm512_store_si512((void *)(region+64), out[1]);
+		_mm512_store_si512((void *)(region+128), out[2]);
+		_mm512_store_si512((void *)(region+192), out[3]);
+	}
+	for (end=region+(length & 255); region<end; region+=64) {
+		in[0] = _mm512_load_si512((void *)region);
+		l[0] = _mm512_and_si512(in[0], m1);
+		l[0] = _mm512_shuffle_epi8(t1, l[0]);
+		h[0] = _mm512_and_si512(in[0], m2);
+		h[0] = _mm512_srli_epi64(h[0], 4);
+		h[0] = _mm512_shuffle_epi8(t2, h[0]);
+		out[0] = _mm512_xor_si512(h[0], l[0]);
+		_mm512_store_si512((void *)region, out[0]);
+	}
+}
+
+void
+maddrc_prefetch256_shuffle_avx512(uint8_t *region1, const uint8_t *region2,
+			uint8_t constant, size_t length, size_t distance)
+{
+	uint8_t *end;
+	register __m512i t1, t2, m1, m2;
+	register __m512i in1, in2, out, l, h;
+	register __m128i bc;
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_prefetch_avx512(region1, region2, length, distance);
+		return;
+	}
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = _mm512_broadcast_i32x4(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = _mm512_broadcast_i32x4(bc);
+	m1 = _mm512_set1_epi8(0x0f);
+	m2 = _mm512_set1_epi8(0xf0);
+
+	for (end=region1+length; region1<end; region1+=64, region2+=64) {
+		_mm_prefetch((const char *)(region2+distance), _MM_HINT_T0);
+		_mm_prefetch((const char *)(region1+distance), _MM_HINT_T0);
+		in2 = _mm512_load_si512((void *)region2);
+		in1 = _mm512_load_si512((void *)region1);
+		l = _mm512_and_si512(in2, m1);
+		l = _mm512_shuffle_epi8(t1, l);
+		h = _mm512_and_si512(in2, m2);
+		h = _mm512_srli_epi64(h, 4);
+		h = _mm512_shuffle_epi8(t2, h);
+		out = _mm512_ternarylogic_epi64(h, l, in1, 0x96);
+		_mm512_store_si512((void *)region1, out);
+	}
+}
+
+void
+mulrc_prefetch256_shuffle_avx512(uint8_t *region, uint8_t constant, size_t length,
+							size_t distance)
+{
+	uint8_t *end;
+	register __m512i t1, t2, m1, m2;
+	register __m512i in, out, l, h;
+	register __m128i bc;
+
+	if (constant == 0) {
+		memset(region, 0, length);
+		return;
+	}
+
+	if (constant == 1)
+		return;
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = _mm512_broadcast_i32x4(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = _mm512_broadcast_i32x4(bc);
+	m1 = _mm512_set1_epi8(0x0f);
+	m2 = _mm512_set1_epi8(0xf0);
+
+	for (end=region+length; region<end; region+=64) {
+		_mm_prefetch((const char *)(region+distance), _MM_HINT_T0);
+		in = _mm512_load_si512((void *)region);
+		l = _mm512_and_si512(in, m1);
+		l = _mm512_shuffle_epi8(t1, l);
+		h = _mm512_and_si512(in, m2);
+		h = _mm512_srli_epi64(h, 4);
+		h = _mm512_shuffle_epi8(t2, h);
+		out = _mm512_xor_si512(h, l);
+		_mm512_store_si512((void *)region, out);
+	}
+}
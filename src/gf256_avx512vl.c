@@ -0,0 +1,637 @@
+/*
+ * This file is part of moep80211gf.
+ *
+ * Copyright (C) 2014,2019   Stephan M. Guenther <moepi@moepi.net>
+ * Copyright (C) 2016        Nicolas Appel <n.appel@tum.de>
+ * Copyright (C) 2014        Maximilian Riemensberger <riemensberger@tum.de>
+ *
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 2.1 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library. If not, see <https://www.gnu.org/licenses/>
+ *
+ */
+
+#include <immintrin.h>
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <moepgf/moepgf.h>
+
+#include "gf256.h"
+#include "xor.h"
+
+#if MOEPGF256_POLYNOMIAL == 285
+#include "gf256tables285.h"
+#elif MOEPGF256_POLYNOMIAL == 283 
+#include "gf256tables283.h"
+#else
+#error "Invalid prime polynomial or tables not available."
+#endif
+
+static const uint8_t tl[MOEPGF256_SIZE][16] = MOEPGF256_SHUFFLE_LOW_TABLE;
+static const uint8_t th[MOEPGF256_SIZE][16] = MOEPGF256_SHUFFLE_HIGH_TABLE;
+
+/*
+ * Variants of the AVX512BW shuffle kernels that operate on 256 bit registers.
+ * EVEX encoding still provides vpternlogq and masked loads and stores for the
+ * tails of unaligned regions, but the kernels do not trigger the frequency
+ * drop of 512 bit instructions.
+ */
+
+void
+maddrc256_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m256i t1, t2, m1, m2, in1, in2, out, l, h;
+	register __m128i bc;
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_avx2(region1, region2, length);
+		return;
+	}
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = _mm256_broadcast_i32x4 (bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = _mm256_broadcast_i32x4 (bc);
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	for (end=region1+length; region1<end; region1+=32, region2+=32) {
+		in2 = _mm256_load_si256((void *)region2);
+		in1 = _mm256_load_si256((void *)region1);
+		l = _mm256_and_si256(in2, m1);
+		l = _mm256_shuffle_epi8(t1, l);
+		h = _mm256_and_si256(in2, m2);
+		h = _mm256_srli_epi64(h, 4);
+		h = _mm256_shuffle_epi8(t2, h);
+		out = _mm256_ternarylogic_epi64(h, l, in1, 0x96);
+		_mm256_store_si256((void *)region1, out);
+	}
+}
+
+void
+mulrc256_shuffle_avx512vl(uint8_t *region, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m256i t1, t2, m1, m2, in, out, l, h;
+	register __m128i bc;
+
+	if (constant == 0) {
+		memset(region, 0, length);
+		return;
+	}
+
+	if (constant == 1)
+		return;
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = _mm256_broadcast_i32x4(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = _mm256_broadcast_i32x4(bc);
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	for (end=region+length; region<end; region+=32) {
+		in = _mm256_load_si256((void *)region);
+		l = _mm256_and_si256(in, m1);
+		l = _mm256_shuffle_epi8(t1, l);
+		h = _mm256_and_si256(in, m2);
+		h = _mm256_srli_epi64(h, 4);
+		h = _mm256_shuffle_epi8(t2, h);
+		out = _mm256_xor_si256(h, l);
+		_mm256_store_si256((void *)region, out);
+	}
+}
+
+void
+mulrc_copy256_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m256i t1, t2, m1, m2, in, out, l, h;
+	register __m128i bc;
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = _mm256_broadcast_i32x4(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = _mm256_broadcast_i32x4(bc);
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	for (end=region1+length; region1<end; region1+=32, region2+=32) {
+		in = _mm256_load_si256((void *)region2);
+		l = _mm256_and_si256(in, m1);
+		l = _mm256_shuffle_epi8(t1, l);
+		h = _mm256_and_si256(in, m2);
+		h = _mm256_srli_epi64(h, 4);
+		h = _mm256_shuffle_epi8(t2, h);
+		out = _mm256_xor_si256(h, l);
+		_mm256_store_si256((void *)region1, out);
+	}
+}
+
+void
+maddrc_multi256_shuffle_avx512vl(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	size_t off;
+	int i;
+	register __m256i t1, t2, m1, m2, in, l, h, acc[4];
+	register __m128i bc;
+
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	for (off=0; off+128<=length; off+=128) {
+		acc[0] = _mm256_load_si256((void *)(region1+off));
+		acc[1] = _mm256_load_si256((void *)(region1+off+32));
+		acc[2] = _mm256_load_si256((void *)(region1+off+64));
+		acc[3] = _mm256_load_si256((void *)(region1+off+96));
+
+		for (i=0; i<count; i++) {
+			if (constants[i] == 0)
+				continue;
+
+			bc = _mm_load_si128((void *)tl[constants[i]]);
+			t1 = _mm256_broadcast_i32x4(bc);
+			bc = _mm_load_si128((void *)th[constants[i]]);
+			t2 = _mm256_broadcast_i32x4(bc);
+
+			in = _mm256_load_si256((void *)(regions[i]+off));
+			l = _mm256_and_si256(in, m1);
+			l = _mm256_shuffle_epi8(t1, l);
+			h = _mm256_and_si256(in, m2);
+			h = _mm256_srli_epi64(h, 4);
+			h = _mm256_shuffle_epi8(t2, h);
+			acc[0] = _mm256_ternarylogic_epi64(acc[0], h, l, 0x96);
+
+			in = _mm256_load_si256((void *)(regions[i]+off+32));
+			l = _mm256_and_si256(in, m1);
+			l = _mm256_shuffle_epi8(t1, l);
+			h = _mm256_and_si256(in, m2);
+			h = _mm256_srli_epi64(h, 4);
+			h = _mm256_shuffle_epi8(t2, h);
+			acc[1] = _mm256_ternarylogic_epi64(acc[1], h, l, 0x96);
+
+			in = _mm256_load_si256((void *)(regions[i]+off+64));
+			l = _mm256_and_si256(in, m1);
+			l = _mm256_shuffle_epi8(t1, l);
+			h = _mm256_and_si256(in, m2);
+			h = _mm256_srli_epi64(h, 4);
+			h = _mm256_shuffle_epi8(t2, h);
+			acc[2] = _mm256_ternarylogic_epi64(acc[2], h, l, 0x96);
+
+			in = _mm256_load_si256((void *)(regions[i]+off+96));
+			l = _mm256_and_si256(in, m1);
+			l = _mm256_shuffle_epi8(t1, l);
+			h = _mm256_and_si256(in, m2);
+			h = _mm256_srli_epi64(h, 4);
+			h = _mm256_shuffle_epi8(t2, h);
+			acc[3] = _mm256_ternarylogic_epi64(acc[3], h, l, 0x96);
+		}
+
+		_mm256_store_si256((void *)(region1+off), acc[0]);
+		_mm256_store_si256((void *)(region1+off+32), acc[1]);
+		_mm256_store_si256((void *)(region1+off+64), acc[2]);
+		_mm256_store_si256((void *)(region1+off+96), acc[3]);
+	}
+
+	for (; off<length; off+=32) {
+		acc[0] = _mm256_load_si256((void *)(region1+off));
+
+		for (i=0; i<count; i++) {
+			if (constants[i] == 0)
+				continue;
+
+			bc = _mm_load_si128((void *)tl[constants[i]]);
+			t1 = _mm256_broadcast_i32x4(bc);
+			bc = _mm_load_si128((void *)th[constants[i]]);
+			t2 = _mm256_broadcast_i32x4(bc);
+			in = _mm256_load_si256((void *)(regions[i]+off));
+			l = _mm256_and_si256(in, m1);
+			l = _mm256_shuffle_epi8(t1, l);
+			h = _mm256_and_si256(in, m2);
+			h = _mm256_srli_epi64(h, 4);
+			h = _mm256_shuffle_epi8(t2, h);
+			acc[0] = _mm256_ternarylogic_epi64(acc[0], h, l, 0x96);
+		}
+
+		_mm256_store_si256((void *)(region1+off), acc[0]);
+	}
+}
+
+void
+maddrc_fanout256_shuffle_avx512vl(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	size_t off;
+	int i = 0;
+	uint8_t *r[8];
+	register __m256i t1[8], t2[8], m1, m2, in, l, h, out;
+	register __m128i bc;
+
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	for (; i+8<=count; i+=8) {
+		r[0] = regions[i];
+		r[1] = regions[i+1];
+		r[2] = regions[i+2];
+		r[3] = regions[i+3];
+		r[4] = regions[i+4];
+		r[5] = regions[i+5];
+		r[6] = regions[i+6];
+		r[7] = regions[i+7];
+		bc = _mm_load_si128((void *)tl[constants[i]]);
+		t1[0] = _mm256_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i]]);
+		t2[0] = _mm256_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)tl[constants[i+1]]);
+		t1[1] = _mm256_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i+1]]);
+		t2[1] = _mm256_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)tl[constants[i+2]]);
+		t1[2] = _mm256_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i+2]]);
+		t2[2] = _mm256_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)tl[constants[i+3]]);
+		t1[3] = _mm256_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i+3]]);
+		t2[3] = _mm256_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)tl[constants[i+4]]);
+		t1[4] = _mm256_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i+4]]);
+		t2[4] = _mm256_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)tl[constants[i+5]]);
+		t1[5] = _mm256_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i+5]]);
+		t2[5] = _mm256_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)tl[constants[i+6]]);
+		t1[6] = _mm256_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i+6]]);
+		t2[6] = _mm256_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)tl[constants[i+7]]);
+		t1[7] = _mm256_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i+7]]);
+		t2[7] = _mm256_broadcast_i32x4(bc);
+
+		for (off=0; off<length; off+=32) {
+			in = _mm256_load_si256((void *)(region2+off));
+			l = _mm256_and_si256(in, m1);
+			h = _mm256_and_si256(in, m2);
+			h = _mm256_srli_epi64(h, 4);
+
+			out = _mm256_load_si256((void *)(r[0]+off));
+			out = _mm256_ternarylogic_epi64(out,
+					_mm256_shuffle_epi8(t1[0], l),
+					_mm256_shuffle_epi8(t2[0], h), 0x96);
+			_mm256_store_si256((void *)(r[0]+off), out);
+
+			out = _mm256_load_si256((void *)(r[1]+off));
+			out = _mm256_ternarylogic_epi64(out,
+					_mm256_shuffle_epi8(t1[1], l),
+					_mm256_shuffle_epi8(t2[1], h), 0x96);
+			_mm256_store_si256((void *)(r[1]+off), out);
+
+			out = _mm256_load_si256((void *)(r[2]+off));
+			out = _mm256_ternarylogic_epi64(out,
+					_mm256_shuffle_epi8(t1[2], l),
+					_mm256_shuffle_epi8(t2[2], h), 0x96);
+			_mm256_store_si256((void *)(r[2]+off), out);
+
+			out = _mm256_load_si256((void *)(r[3]+off));
+			out = _mm256_ternarylogic_epi64(out,
+					_mm256_shuffle_epi8(t1[3], l),
+					_mm256_shuffle_epi8(t2[3], h), 0x96);
+			_mm256_store_si256((void *)(r[3]+off), out);
+
+			out = _mm256_load_si256((void *)(r[4]+off));
+			out = _mm256_ternarylogic_epi64(out,
+					_mm256_shuffle_epi8(t1[4], l),
+					_mm256_shuffle_epi8(t2[4], h), 0x96);
+			_mm256_store_si256((void *)(r[4]+off), out);
+
+			out = _mm256_load_si256((void *)(r[5]+off));
+			out = _mm256_ternarylogic_epi64(out,
+					_mm256_shuffle_epi8(t1[5], l),
+					_mm256_shuffle_epi8(t2[5], h), 0x96);
+			_mm256_store_si256((void *)(r[5]+off), out);
+
+			out = _mm256_load_si256((void *)(r[6]+off));
+			out = _mm256_ternarylogic_epi64(out,
+					_mm256_shuffle_epi8(t1[6], l),
+					_mm256_shuffle_epi8(t2[6], h), 0x96);
+			_mm256_store_si256((void *)(r[6]+off), out);
+
+			out = _mm256_load_si256((void *)(r[7]+off));
+			out = _mm256_ternarylogic_epi64(out,
+					_mm256_shuffle_epi8(t1[7], l),
+					_mm256_shuffle_epi8(t2[7], h), 0x96);
+			_mm256_store_si256((void *)(r[7]+off), out);
+		}
+	}
+
+	for (; i+4<=count; i+=4) {
+		r[0] = regions[i];
+		r[1] = regions[i+1];
+		r[2] = regions[i+2];
+		r[3] = regions[i+3];
+		bc = _mm_load_si128((void *)tl[constants[i]]);
+		t1[0] = _mm256_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i]]);
+		t2[0] = _mm256_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)tl[constants[i+1]]);
+		t1[1] = _mm256_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i+1]]);
+		t2[1] = _mm256_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)tl[constants[i+2]]);
+		t1[2] = _mm256_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i+2]]);
+		t2[2] = _mm256_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)tl[constants[i+3]]);
+		t1[3] = _mm256_broadcast_i32x4(bc);
+		bc = _mm_load_si128((void *)th[constants[i+3]]);
+		t2[3] = _mm256_broadcast_i32x4(bc);
+
+		for (off=0; off<length; off+=32) {
+			in = _mm256_load_si256((void *)(region2+off));
+			l = _mm256_and_si256(in, m1);
+			h = _mm256_and_si256(in, m2);
+			h = _mm256_srli_epi64(h, 4);
+
+			out = _mm256_load_si256((void *)(r[0]+off));
+			out = _mm256_ternarylogic_epi64(out,
+					_mm256_shuffle_epi8(t1[0], l),
+					_mm256_shuffle_epi8(t2[0], h), 0x96);
+			_mm256_store_si256((void *)(r[0]+off), out);
+
+			out = _mm256_load_si256((void *)(r[1]+off));
+			out = _mm256_ternarylogic_epi64(out,
+					_mm256_shuffle_epi8(t1[1], l),
+					_mm256_shuffle_epi8(t2[1], h), 0x96);
+			_mm256_store_si256((void *)(r[1]+off), out);
+
+			out = _mm256_load_si256((void *)(r[2]+off));
+			out = _mm256_ternarylogic_epi64(out,
+					_mm256_shuffle_epi8(t1[2], l),
+					_mm256_shuffle_epi8(t2[2], h), 0x96);
+			_mm256_store_si256((void *)(r[2]+off), out);
+
+			out = _mm256_load_si256((void *)(r[3]+off));
+			out = _mm256_ternarylogic_epi64(out,
+					_mm256_shuffle_epi8(t1[3], l),
+					_mm256_shuffle_epi8(t2[3], h), 0x96);
+			_mm256_store_si256((void *)(r[3]+off), out);
+		}
+	}
+
+	for (; i<count; i++)
+		maddrc256_shuffle_avx512vl(regions[i], region2,
+						constants[i], length);
+}
+
+void
+maddrc3_256_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m256i t1, t2, m1, m2, in1, in2, out, l, h;
+	register __m128i bc;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_avx2(region1, region2, region3, length);
+		return;
+	}
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = _mm256_broadcast_i32x4 (bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = _mm256_broadcast_i32x4 (bc);
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	for (end=region1+length; region1<end;
+			region1+=32, region2+=32, region3+=32) {
+		in2 = _mm256_load_si256((void *)region3);
+		in1 = _mm256_load_si256((void *)region2);
+		l = _mm256_and_si256(in2, m1);
+		l = _mm256_shuffle_epi8(t1, l);
+		h = _mm256_and_si256(in2, m2);
+		h = _mm256_srli_epi64(h, 4);
+		h = _mm256_shuffle_epi8(t2, h);
+		out = _mm256_ternarylogic_epi64(h, l, in1, 0x96);
+		_mm256_store_si256((void *)region1, out);
+	}
+}
+
+void
+maddrc_unaligned256_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	__mmask32 k;
+	register __m256i t1, t2, m1, m2, in1, in2, out, l, h;
+	register __m128i bc;
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_unaligned_avx2(region1, region2, length);
+		return;
+	}
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = _mm256_broadcast_i32x4(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = _mm256_broadcast_i32x4(bc);
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	for (end=region1+(length & ~31); region1<end; region1+=32, region2+=32) {
+		in2 = _mm256_loadu_si256((void *)region2);
+		in1 = _mm256_loadu_si256((void *)region1);
+		l = _mm256_and_si256(in2, m1);
+		l = _mm256_shuffle_epi8(t1, l);
+		h = _mm256_and_si256(in2, m2);
+		h = _mm256_srli_epi64(h, 4);
+		h = _mm256_shuffle_epi8(t2, h);
+		out = _mm256_ternarylogic_epi64(h, l, in1, 0x96);
+		_mm256_storeu_si256((void *)region1, out);
+	}
+
+	if (!(length & 31))
+		return;
+
+	k = ((__mmask32)1 << (length & 31)) - 1;
+	in2 = _mm256_maskz_loadu_epi8(k, (void *)region2);
+	in1 = _mm256_maskz_loadu_epi8(k, (void *)region1);
+	l = _mm256_and_si256(in2, m1);
+	l = _mm256_shuffle_epi8(t1, l);
+	h = _mm256_and_si256(in2, m2);
+	h = _mm256_srli_epi64(h, 4);
+	h = _mm256_shuffle_epi8(t2, h);
+	out = _mm256_ternarylogic_epi64(h, l, in1, 0x96);
+	_mm256_mask_storeu_epi8((void *)region1, k, out);
+}
+
+void
+mulrc_unaligned256_shuffle_avx512vl(uint8_t *region, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	__mmask32 k;
+	register __m256i t1, t2, m1, m2, in, out, l, h;
+	register __m128i bc;
+
+	if (constant == 0) {
+		memset(region, 0, length);
+		return;
+	}
+
+	if (constant == 1)
+		return;
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = _mm256_broadcast_i32x4(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = _mm256_broadcast_i32x4(bc);
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	for (end=region+(length & ~31); region<end; region+=32) {
+		in = _mm256_loadu_si256((void *)region);
+		l = _mm256_and_si256(in, m1);
+		l = _mm256_shuffle_epi8(t1, l);
+		h = _mm256_and_si256(in, m2);
+		h = _mm256_srli_epi64(h, 4);
+		h = _mm256_shuffle_epi8(t2, h);
+		out = _mm256_xor_si256(h, l);
+		_mm256_storeu_si256((void *)region, out);
+	}
+
+	if (!(length & 31))
+		return;
+
+	k = ((__mmask32)1 << (length & 31)) - 1;
+	in = _mm256_maskz_loadu_epi8(k, (void *)region);
+	l = _mm256_and_si256(in, m1);
+	l = _mm256_shuffle_epi8(t1, l);
+	h = _mm256_and_si256(in, m2);
+	h = _mm256_srli_epi64(h, 4);
+	h = _mm256_shuffle_epi8(t2, h);
+	out = _mm256_xor_si256(h, l);
+	_mm256_mask_storeu_epi8((void *)region, k, out);
+}
+
+void
+mulrc_copy_nt256_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m256i t1, t2, m1, m2, in, out, l, h;
+	register __m128i bc;
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = _mm256_broadcast_i32x4(bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = _mm256_broadcast_i32x4(bc);
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	for (end=region1+length; region1<end; region1+=32, region2+=32) {
+		in = _mm256_load_si256((void *)region2);
+		l = _mm256_and_si256(in, m1);
+		l = _mm256_shuffle_epi8(t1, l);
+		h = _mm256_and_si256(in, m2);
+		h = _mm256_srli_epi64(h, 4);
+		h = _mm256_shuffle_epi8(t2, h);
+		out = _mm256_xor_si256(h, l);
+		_mm256_stream_si256((void *)region1, out);
+	}
+
+	_mm_sfence();
+}
+
+void
+maddrc3_nt256_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m256i t1, t2, m1, m2, in1, in2, out, l, h;
+	register __m128i bc;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_avx2(region1, region2, region3, length);
+		return;
+	}
+
+	bc = _mm_load_si128((void *)tl[constant]);
+	t1 = _mm256_broadcast_i32x4 (bc);
+	bc = _mm_load_si128((void *)th[constant]);
+	t2 = _mm256_broadcast_i32x4 (bc);
+	m1 = _mm256_set1_epi8(0x0f);
+	m2 = _mm256_set1_epi8(0xf0);
+
+	for (end=region1+length; region1<end;
+			region1+=32, region2+=32, region3+=32) {
+		in2 = _mm256_load_si256((void *)region3);
+		in1 = _mm256_load_si256((void *)region2);
+		l = _mm256_and_si256(in2, m1);
+		l = _mm256_shuffle_epi8(t1, l);
+		h = _mm256_and_si256(in2, m2);
+		h = _mm256_srli_epi64(h, 4);
+		h = _mm256_shuffle_epi8(t2, h);
+		out = _mm256_ternarylogic_epi64(h, l, in1, 0x96);
+		_mm256_stream_si256((void *)region1, out);
+	}
+
+	_mm_sfence();
+}
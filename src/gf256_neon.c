@@ -43,6 +43,7 @@
 static const uint8_t pt[MOEPGF256_SIZE][MOEPGF256_EXPONENT] = MOEPGF256_POLYNOMIAL_DIV_TABLE;
 static const uint8_t tl[MOEPGF256_SIZE][16] = MOEPGF256_SHUFFLE_LOW_TABLE;
 static const uint8_t th[MOEPGF256_SIZE][16] = MOEPGF256_SHUFFLE_HIGH_TABLE;
+static const uint8_t inverses[MOEPGF256_SIZE] = MOEPGF256_INV_TABLE;
 
 void
 maddrc256_shuffle_neon_64(uint8_t *region1, const uint8_t *region2,
@@ -265,3 +266,433 @@ mulrc256_shuffle_neon_64(uint8_t *region, uint8_t constant, size_t length)
 	}
 }
 
+void
+mulrc_copy256_shuffle_neon_64(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register uint8x8x2_t t1, t2;
+	register uint8x8_t m1, m2, in, out, l, h;
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	t1 = vld2_u8((void *)tl[constant]);
+	t2 = vld2_u8((void *)th[constant]);
+	m1 = vdup_n_u8(0x0f);
+	m2 = vdup_n_u8(0xf0);
+
+	for (end=region1+length; region1<end; region1+=8, region2+=8) {
+		in = vld1_u8((void *)region2);
+		l = vand_u8(in, m1);
+		l = vtbl2_u8(t1, l);
+		h = vand_u8(in, m2);
+		h = vshr_n_u8(h, 4);
+		h = vtbl2_u8(t2, h);
+		out = veor_u8(h, l);
+		vst1_u8((void *)region1, out);
+	}
+}
+
+void
+maddrc_multi256_shuffle_neon_64(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	size_t off;
+	int i;
+	register uint8x8x2_t t1, t2;
+	register uint8x8_t m1, m2, in, acc, l, h;
+
+	m1 = vdup_n_u8(0x0f);
+	m2 = vdup_n_u8(0xf0);
+
+	for (off=0; off<length; off+=8) {
+		acc = vld1_u8((void *)(region1+off));
+
+		for (i=0; i<count; i++) {
+			if (constants[i] == 0)
+				continue;
+
+			t1 = vld2_u8((void *)tl[constants[i]]);
+			t2 = vld2_u8((void *)th[constants[i]]);
+			in = vld1_u8((void *)(regions[i]+off));
+			l = vand_u8(in, m1);
+			l = vtbl2_u8(t1, l);
+			h = vand_u8(in, m2);
+			h = vshr_n_u8(h, 4);
+			h = vtbl2_u8(t2, h);
+			acc = veor_u8(acc, h);
+			acc = veor_u8(acc, l);
+		}
+
+		vst1_u8(region1+off, acc);
+	}
+}
+
+void
+maddrc_fanout256_shuffle_neon_64(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++)
+		maddrc256_shuffle_neon_64(regions[i], region2, constants[i], length);
+}
+
+void
+maddrc3_256_shuffle_neon_64(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register uint8x8x2_t t1, t2;
+	register uint8x8_t m1, m2, in1, in2, out, l, h;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_neon_128(region1, region2, region3, length);
+		return;
+	}
+
+	t1 = vld2_u8((void *)tl[constant]);
+	t2 = vld2_u8((void *)th[constant]);
+	m1 = vdup_n_u8(0x0f);
+	m2 = vdup_n_u8(0xf0);
+
+	for (end=region1+length; region1<end;
+			region1+=8, region2+=8, region3+=8) {
+		in2 = vld1_u8((void *)region3);
+		in1 = vld1_u8((void *)region2);
+		l = vand_u8(in2, m1);
+		l = vtbl2_u8(t1, l);
+		h = vand_u8(in2, m2);
+		h = vshr_n_u8(h, 4);
+		h = vtbl2_u8(t2, h);
+		out = veor_u8(h, l);
+		out = veor_u8(out, in1);
+		vst1_u8(region1, out);
+	}
+}
+
+void
+maddrc3_256_imul_neon_64(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	const uint8_t *p = pt[constant];
+	register uint8x8_t mi[8], sp[8], ri[8], reg1, reg2;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_neon_64(region1, region2, region3, length);
+		return;
+	}
+
+	mi[0] = vdup_n_u8(0x01);
+	mi[1] = vdup_n_u8(0x02);
+	mi[2] = vdup_n_u8(0x04);
+	mi[3] = vdup_n_u8(0x08);
+	mi[4] = vdup_n_u8(0x10);
+	mi[5] = vdup_n_u8(0x20);
+	mi[6] = vdup_n_u8(0x40);
+	mi[7] = vdup_n_u8(0x80);
+
+	sp[0] = vdup_n_u8(p[0]);
+	sp[1] = vdup_n_u8(p[1]);
+	sp[2] = vdup_n_u8(p[2]);
+	sp[3] = vdup_n_u8(p[3]);
+	sp[4] = vdup_n_u8(p[4]);
+	sp[5] = vdup_n_u8(p[5]);
+	sp[6] = vdup_n_u8(p[6]);
+	sp[7] = vdup_n_u8(p[7]);
+
+	for (end=region1+length; region1<end;
+			region1+=8, region2+=8, region3+=8) {
+		reg2 = vld1_u8((void *)region3);
+		reg1 = vld1_u8((void *)region2);
+
+		ri[0] = vand_u8(reg2, mi[0]);
+		ri[1] = vand_u8(reg2, mi[1]);
+		ri[2] = vand_u8(reg2, mi[2]);
+		ri[3] = vand_u8(reg2, mi[3]);
+		ri[4] = vand_u8(reg2, mi[4]);
+		ri[5] = vand_u8(reg2, mi[5]);
+		ri[6] = vand_u8(reg2, mi[6]);
+		ri[7] = vand_u8(reg2, mi[7]);
+
+		ri[1] = vshr_n_u8(ri[1], 1);
+		ri[2] = vshr_n_u8(ri[2], 2);
+		ri[3] = vshr_n_u8(ri[3], 3);
+		ri[4] = vshr_n_u8(ri[4], 4);
+		ri[5] = vshr_n_u8(ri[5], 5);
+		ri[6] = vshr_n_u8(ri[6], 6);
+		ri[7] = vshr_n_u8(ri[7], 7);
+
+		ri[0] = vmul_u8(ri[0], sp[0]);
+		ri[1] = vmul_u8(ri[1], sp[1]);
+		ri[2] = vmul_u8(ri[2], sp[2]);
+		ri[3] = vmul_u8(ri[3], sp[3]);
+		ri[4] = vmul_u8(ri[4], sp[4]);
+		ri[5] = vmul_u8(ri[5], sp[5]);
+		ri[6] = vmul_u8(ri[6], sp[6]);
+		ri[7] = vmul_u8(ri[7], sp[7]);
+
+		ri[0] = veor_u8(ri[0], ri[1]);
+		ri[2] = veor_u8(ri[2], ri[3]);
+		ri[4] = veor_u8(ri[4], ri[5]);
+		ri[6] = veor_u8(ri[6], ri[7]);
+		ri[0] = veor_u8(ri[0], ri[2]);
+		ri[4] = veor_u8(ri[4], ri[6]);
+		ri[0] = veor_u8(ri[0], ri[4]);
+		ri[0] = veor_u8(ri[0], reg1);
+
+		vst1_u8(region1, ri[0]);
+	}
+}
+
+void
+maddrc3_256_imul_neon_128(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	const uint8_t *p = pt[constant];
+	register uint8x16_t mi[8], sp[8], ri[8], reg1, reg2;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_neon_128(region1, region2, region3, length);
+		return;
+	}
+	
+	mi[0] = vdupq_n_u8(0x01);
+	mi[1] = vdupq_n_u8(0x02);
+	mi[2] = vdupq_n_u8(0x04);
+	mi[3] = vdupq_n_u8(0x08);
+	mi[4] = vdupq_n_u8(0x10);
+	mi[5] = vdupq_n_u8(0x20);
+	mi[6] = vdupq_n_u8(0x40);
+	mi[7] = vdupq_n_u8(0x80);
+
+	sp[0] = vdupq_n_u8(p[0]);
+	sp[1] = vdupq_n_u8(p[1]);
+	sp[2] = vdupq_n_u8(p[2]);
+	sp[3] = vdupq_n_u8(p[3]);
+	sp[4] = vdupq_n_u8(p[4]);
+	sp[5] = vdupq_n_u8(p[5]);
+	sp[6] = vdupq_n_u8(p[6]);
+	sp[7] = vdupq_n_u8(p[7]);
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16) {
+		reg2 = vld1q_u8((void *)region3);
+		reg1 = vld1q_u8((void *)region2);
+
+		ri[0] = vandq_u8(reg2, mi[0]);
+		ri[1] = vandq_u8(reg2, mi[1]);
+		ri[2] = vandq_u8(reg2, mi[2]);
+		ri[3] = vandq_u8(reg2, mi[3]);
+		ri[4] = vandq_u8(reg2, mi[4]);
+		ri[5] = vandq_u8(reg2, mi[5]);
+		ri[6] = vandq_u8(reg2, mi[6]);
+		ri[7] = vandq_u8(reg2, mi[7]);
+
+		ri[1] = vshrq_n_u8(ri[1], 1);
+		ri[2] = vshrq_n_u8(ri[2], 2);
+		ri[3] = vshrq_n_u8(ri[3], 3);
+		ri[4] = vshrq_n_u8(ri[4], 4);
+		ri[5] = vshrq_n_u8(ri[5], 5);
+		ri[6] = vshrq_n_u8(ri[6], 6);
+		ri[7] = vshrq_n_u8(ri[7], 7);
+
+		ri[0] = vmulq_u8(ri[0], sp[0]);
+		ri[1] = vmulq_u8(ri[1], sp[1]);
+		ri[2] = vmulq_u8(ri[2], sp[2]);
+		ri[3] = vmulq_u8(ri[3], sp[3]);
+		ri[4] = vmulq_u8(ri[4], sp[4]);
+		ri[5] = vmulq_u8(ri[5], sp[5]);
+		ri[6] = vmulq_u8(ri[6], sp[6]);
+		ri[7] = vmulq_u8(ri[7], sp[7]);
+
+		ri[0] = veorq_u8(ri[0], ri[1]);
+		ri[2] = veorq_u8(ri[2], ri[3]);
+		ri[4] = veorq_u8(ri[4], ri[5]);
+		ri[6] = veorq_u8(ri[6], ri[7]);
+		ri[0] = veorq_u8(ri[0], ri[2]);
+		ri[4] = veorq_u8(ri[4], ri[6]);
+		ri[0] = veorq_u8(ri[0], ri[4]);
+		ri[0] = veorq_u8(ri[0], reg1);
+
+		vst1q_u8(region1, ri[0]);
+	}
+}
+
+void
+mulrr256_imul_neon_128(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	int i;
+	register uint8x16_t a, b, t, acc, l, nl, p;
+
+	l = vdupq_n_u8(0x01);
+	nl = vdupq_n_u8(0xfe);
+	p = vdupq_n_u8(MOEPGF256_POLYNOMIAL & MOEPGF256_MASK);
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		a = vld1q_u8(region1);
+		b = vld1q_u8(region2);
+		acc = vdupq_n_u8(0);
+
+		for (i=0; i<MOEPGF256_EXPONENT; i++) {
+			t = vandq_u8(b, l);
+			t = vsubq_u8(vdupq_n_u8(0), t);
+			t = vandq_u8(t, a);
+			acc = veorq_u8(acc, t);
+			b = vshrq_n_u8(b, 1);
+
+			t = vshrq_n_u8(a, 7);
+			t = vandq_u8(t, l);
+			t = vsubq_u8(vdupq_n_u8(0), t);
+			t = vandq_u8(t, p);
+			a = vshlq_n_u8(a, 1);
+			a = vandq_u8(a, nl);
+			a = veorq_u8(a, t);
+		}
+
+		vst1q_u8(region1, acc);
+	}
+}
+
+void
+maddrr256_imul_neon_128(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, size_t length)
+{
+	uint8_t *end;
+	int i;
+	register uint8x16_t a, b, t, acc, l, nl, p;
+
+	l = vdupq_n_u8(0x01);
+	nl = vdupq_n_u8(0xfe);
+	p = vdupq_n_u8(MOEPGF256_POLYNOMIAL & MOEPGF256_MASK);
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16) {
+		a = vld1q_u8(region2);
+		b = vld1q_u8(region3);
+		acc = vld1q_u8(region1);
+
+		for (i=0; i<MOEPGF256_EXPONENT; i++) {
+			t = vandq_u8(b, l);
+			t = vsubq_u8(vdupq_n_u8(0), t);
+			t = vandq_u8(t, a);
+			acc = veorq_u8(acc, t);
+			b = vshrq_n_u8(b, 1);
+
+			t = vshrq_n_u8(a, 7);
+			t = vandq_u8(t, l);
+			t = vsubq_u8(vdupq_n_u8(0), t);
+			t = vandq_u8(t, p);
+			a = vshlq_n_u8(a, 1);
+			a = vandq_u8(a, nl);
+			a = veorq_u8(a, t);
+		}
+
+		vst1q_u8(region1, acc);
+	}
+}
+
+void
+invr256_shuffle_neon_64(uint8_t *region, size_t length)
+{
+	uint8_t *end;
+	int j;
+	uint8x8x4_t it[8];
+	register uint8x8_t m1, l;
+	register uint8x8_t in;
+
+	for (j=0; j<8; j++) {
+		it[j].val[0] = vld1_u8(inverses + 32*j);
+		it[j].val[1] = vld1_u8(inverses + 32*j + 8);
+		it[j].val[2] = vld1_u8(inverses + 32*j + 16);
+		it[j].val[3] = vld1_u8(inverses + 32*j + 24);
+	}
+	m1 = vdup_n_u8(0x20);
+
+	for (end=region+length; region<end; region+=8) {
+		in = vld1_u8(region);
+		l = vtbl4_u8(it[0], in);
+		for (j=1; j<8; j++) {
+			in = vsub_u8(in, m1);
+			l = vtbx4_u8(l, it[j], in);
+		}
+		vst1_u8(region, l);
+	}
+}
+
+void
+divr256_shuffle_neon_64(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	int i, j;
+	uint8x8x4_t it[8];
+	register uint8x8_t m1, l;
+	register uint8x8_t a, b, t, acc, bl, nl, p;
+
+	for (j=0; j<8; j++) {
+		it[j].val[0] = vld1_u8(inverses + 32*j);
+		it[j].val[1] = vld1_u8(inverses + 32*j + 8);
+		it[j].val[2] = vld1_u8(inverses + 32*j + 16);
+		it[j].val[3] = vld1_u8(inverses + 32*j + 24);
+	}
+	m1 = vdup_n_u8(0x20);
+	bl = vdup_n_u8(0x01);
+	nl = vdup_n_u8(0xfe);
+	p = vdup_n_u8(MOEPGF256_POLYNOMIAL & MOEPGF256_MASK);
+
+	for (end=region1+length; region1<end; region1+=8, region2+=8) {
+		a = vld1_u8(region1);
+		b = vld1_u8(region2);
+		l = vtbl4_u8(it[0], b);
+		for (j=1; j<8; j++) {
+			b = vsub_u8(b, m1);
+			l = vtbx4_u8(l, it[j], b);
+		}
+		b = l;
+
+		acc = vdup_n_u8(0);
+		for (i=0; i<MOEPGF256_EXPONENT; i++) {
+			t = vand_u8(b, bl);
+			t = vsub_u8(vdup_n_u8(0), t);
+			t = vand_u8(t, a);
+			acc = veor_u8(acc, t);
+			b = vshr_n_u8(b, 1);
+
+			t = vshr_n_u8(a, 7);
+			t = vand_u8(t, bl);
+			t = vsub_u8(vdup_n_u8(0), t);
+			t = vand_u8(t, p);
+			a = vshl_n_u8(a, 1);
+			a = vand_u8(a, nl);
+			a = veor_u8(a, t);
+		}
+
+		vst1_u8(region1, acc);
+	}
+}
@@ -0,0 +1,521 @@
+/*
+ * This file is part of moep80211gf.
+ *
+ * Copyright (C) 2014,2019   Stephan M. Guenther <moepi@moepi.net>
+ * Copyright (C) 2016        Nicolas Appel <n.appel@tum.de>
+ * Copyright (C) 2014        Maximilian Riemensberger <riemensberger@tum.de>
+ *
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 2.1 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library. If not, see <https://www.gnu.org/licenses/>
+ *
+ */
+
+#include <arm_neon.h>
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <moepgf/moepgf.h>
+
+#include "gf256.h"
+#include "xor.h"
+
+#if MOEPGF256_POLYNOMIAL == 285
+#include "gf256tables285.h"
+#elif MOEPGF256_POLYNOMIAL == 283 
+#include "gf256tables283.h"
+#else
+#error "Invalid prime polynomial or tables not available."
+#endif
+
+static const uint8_t tl[MOEPGF256_SIZE][16] = MOEPGF256_SHUFFLE_LOW_TABLE;
+static const uint8_t th[MOEPGF256_SIZE][16] = MOEPGF256_SHUFFLE_HIGH_TABLE;
+static const uint8_t inverses[MOEPGF256_SIZE] = MOEPGF256_INV_TABLE;
+
+void
+maddrc256_shuffle_neon_128(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register uint8x16_t t1, t2, m1, in1, in2, out, l, h;
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_neon_128(region1, region2, length);
+		return;
+	}
+
+	t1 = vld1q_u8(tl[constant]);
+	t2 = vld1q_u8(th[constant]);
+	m1 = vdupq_n_u8(0x0f);
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		in2 = vld1q_u8(region2);
+		in1 = vld1q_u8(region1);
+		l = vandq_u8(in2, m1);
+		l = vqtbl1q_u8(t1, l);
+		h = vshrq_n_u8(in2, 4);
+		h = vqtbl1q_u8(t2, h);
+		out = veorq_u8(h, l);
+		out = veorq_u8(out, in1);
+		vst1q_u8(region1, out);
+	}
+}
+
+void
+mulrc256_shuffle_neon_128(uint8_t *region, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register uint8x16_t t1, t2, m1, in, out, l, h;
+
+	if (constant == 0) {
+		memset(region, 0, length);
+		return;
+	}
+
+	if (constant == 1)
+		return;
+
+	t1 = vld1q_u8(tl[constant]);
+	t2 = vld1q_u8(th[constant]);
+	m1 = vdupq_n_u8(0x0f);
+
+	for (end=region+length; region<end; region+=16) {
+		in = vld1q_u8(region);
+		l = vandq_u8(in, m1);
+		l = vqtbl1q_u8(t1, l);
+		h = vshrq_n_u8(in, 4);
+		h = vqtbl1q_u8(t2, h);
+		out = veorq_u8(h, l);
+		vst1q_u8(region, out);
+	}
+}
+
+void
+mulrc_copy256_shuffle_neon_128(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register uint8x16_t t1, t2, m1, in, out, l, h;
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	t1 = vld1q_u8(tl[constant]);
+	t2 = vld1q_u8(th[constant]);
+	m1 = vdupq_n_u8(0x0f);
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		in = vld1q_u8(region2);
+		l = vandq_u8(in, m1);
+		l = vqtbl1q_u8(t1, l);
+		h = vshrq_n_u8(in, 4);
+		h = vqtbl1q_u8(t2, h);
+		out = veorq_u8(h, l);
+		vst1q_u8(region1, out);
+	}
+}
+
+void
+maddrc_multi256_shuffle_neon_128(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	size_t off;
+	int i;
+	register uint8x16_t t1, t2, m1, in, l, h, acc[4];
+
+	m1 = vdupq_n_u8(0x0f);
+
+	for (off=0; off+64<=length; off+=64) {
+		acc[0] = vld1q_u8(region1+off);
+		acc[1] = vld1q_u8(region1+off+16);
+		acc[2] = vld1q_u8(region1+off+32);
+		acc[3] = vld1q_u8(region1+off+48);
+
+		for (i=0; i<count; i++) {
+			if (constants[i] == 0)
+				continue;
+
+			t1 = vld1q_u8(tl[constants[i]]);
+			t2 = vld1q_u8(th[constants[i]]);
+
+			in = vld1q_u8(regions[i]+off);
+			l = vqtbl1q_u8(t1, vandq_u8(in, m1));
+			h = vqtbl1q_u8(t2, vshrq_n_u8(in, 4));
+			acc[0] = veorq_u8(acc[0], h);
+			acc[0] = veorq_u8(acc[0], l);
+
+			in = vld1q_u8(regions[i]+off+16);
+			l = vqtbl1q_u8(t1, vandq_u8(in, m1));
+			h = vqtbl1q_u8(t2, vshrq_n_u8(in, 4));
+			acc[1] = veorq_u8(acc[1], h);
+			acc[1] = veorq_u8(acc[1], l);
+
+			in = vld1q_u8(regions[i]+off+32);
+			l = vqtbl1q_u8(t1, vandq_u8(in, m1));
+			h = vqtbl1q_u8(t2, vshrq_n_u8(in, 4));
+			acc[2] = veorq_u8(acc[2], h);
+			acc[2] = veorq_u8(acc[2], l);
+
+			in = vld1q_u8(regions[i]+off+48);
+			l = vqtbl1q_u8(t1, vandq_u8(in, m1));
+			h = vqtbl1q_u8(t2, vshrq_n_u8(in, 4));
+			acc[3] = veorq_u8(acc[3], h);
+			acc[3] = veorq_u8(acc[3], l);
+		}
+
+		vst1q_u8(region1+off, acc[0]);
+		vst1q_u8(region1+off+16, acc[1]);
+		vst1q_u8(region1+off+32, acc[2]);
+		vst1q_u8(region1+off+48, acc[3]);
+	}
+
+	for (; off<length; off+=16) {
+		acc[0] = vld1q_u8(region1+off);
+
+		for (i=0; i<count; i++) {
+			if (constants[i] == 0)
+				continue;
+
+			t1 = vld1q_u8(tl[constants[i]]);
+			t2 = vld1q_u8(th[constants[i]]);
+			in = vld1q_u8(regions[i]+off);
+			l = vqtbl1q_u8(t1, vandq_u8(in, m1));
+			h = vqtbl1q_u8(t2, vshrq_n_u8(in, 4));
+			acc[0] = veorq_u8(acc[0], h);
+			acc[0] = veorq_u8(acc[0], l);
+		}
+
+		vst1q_u8(region1+off, acc[0]);
+	}
+}
+
+void
+maddrc_fanout256_shuffle_neon_128(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	size_t off;
+	int i = 0;
+	uint8_t *r[4];
+	register uint8x16_t t1[4], t2[4], m1, in, l, h, out;
+
+	m1 = vdupq_n_u8(0x0f);
+
+	for (; i+4<=count; i+=4) {
+		r[0] = regions[i];
+		r[1] = regions[i+1];
+		r[2] = regions[i+2];
+		r[3] = regions[i+3];
+		t1[0] = vld1q_u8(tl[constants[i]]);
+		t2[0] = vld1q_u8(th[constants[i]]);
+		t1[1] = vld1q_u8(tl[constants[i+1]]);
+		t2[1] = vld1q_u8(th[constants[i+1]]);
+		t1[2] = vld1q_u8(tl[constants[i+2]]);
+		t2[2] = vld1q_u8(th[constants[i+2]]);
+		t1[3] = vld1q_u8(tl[constants[i+3]]);
+		t2[3] = vld1q_u8(th[constants[i+3]]);
+
+		for (off=0; off<length; off+=16) {
+			in = vld1q_u8(region2+off);
+			l = vandq_u8(in, m1);
+			h = vshrq_n_u8(in, 4);
+
+			out = vld1q_u8(r[0]+off);
+			out = veorq_u8(out, vqtbl1q_u8(t1[0], l));
+			out = veorq_u8(out, vqtbl1q_u8(t2[0], h));
+			vst1q_u8(r[0]+off, out);
+
+			out = vld1q_u8(r[1]+off);
+			out = veorq_u8(out, vqtbl1q_u8(t1[1], l));
+			out = veorq_u8(out, vqtbl1q_u8(t2[1], h));
+			vst1q_u8(r[1]+off, out);
+
+			out = vld1q_u8(r[2]+off);
+			out = veorq_u8(out, vqtbl1q_u8(t1[2], l));
+			out = veorq_u8(out, vqtbl1q_u8(t2[2], h));
+			vst1q_u8(r[2]+off, out);
+
+			out = vld1q_u8(r[3]+off);
+			out = veorq_u8(out, vqtbl1q_u8(t1[3], l));
+			out = veorq_u8(out, vqtbl1q_u8(t2[3], h));
+			vst1q_u8(r[3]+off, out);
+		}
+	}
+
+	for (; i<count; i++)
+		maddrc256_shuffle_neon_128(regions[i], region2,
+						constants[i], length);
+}
+
+void
+maddrc3_256_shuffle_neon_128(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register uint8x16_t t1, t2, m1, in1, in2, out, l, h;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_neon_128(region1, region2, region3, length);
+		return;
+	}
+
+	t1 = vld1q_u8(tl[constant]);
+	t2 = vld1q_u8(th[constant]);
+	m1 = vdupq_n_u8(0x0f);
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16) {
+		in2 = vld1q_u8(region3);
+		in1 = vld1q_u8(region2);
+		l = vandq_u8(in2, m1);
+		l = vqtbl1q_u8(t1, l);
+		h = vshrq_n_u8(in2, 4);
+		h = vqtbl1q_u8(t2, h);
+		out = veorq_u8(h, l);
+		out = veorq_u8(out, in1);
+		vst1q_u8(region1, out);
+	}
+}
+
+/*
+ * The inverse table is split into four 64 byte tables. Table lookups with
+ * indices out of range leave the respective lane of the destination unchanged.
+ */
+void
+invr256_shuffle_neon_128(uint8_t *region, size_t length)
+{
+	uint8_t *end;
+	int i, j;
+	uint8x16x4_t it[4];
+	register uint8x16_t m1, in, out;
+
+	for (i=0; i<4; i++) {
+		for (j=0; j<4; j++)
+			it[i].val[j] = vld1q_u8(inverses + 64*i + 16*j);
+	}
+	m1 = vdupq_n_u8(64);
+
+	for (end=region+length; region<end; region+=16) {
+		in = vld1q_u8(region);
+		out = vqtbl4q_u8(it[0], in);
+		in = vsubq_u8(in, m1);
+		out = vqtbx4q_u8(out, it[1], in);
+		in = vsubq_u8(in, m1);
+		out = vqtbx4q_u8(out, it[2], in);
+		in = vsubq_u8(in, m1);
+		out = vqtbx4q_u8(out, it[3], in);
+		vst1q_u8(region, out);
+	}
+}
+
+/*
+ * Multiplies the elements of a and b using the 8x8 to 16 bit polynomial
+ * multiplication PMULL. The upper byte of each product, i.e., the coefficients
+ * of x^8 to x^14, is reduced by multiplying it with x^8 mod p, which is the
+ * field element given by the low byte of the prime polynomial. r1 and r2 are
+ * the shuffle tables of that element.
+ */
+static inline uint8x16_t
+pmull256(uint8x16_t a, uint8x16_t b, uint8x16_t r1, uint8x16_t r2,
+								uint8x16_t m1)
+{
+	poly16x8_t pl, ph;
+	uint8x16_t lo, hi;
+
+	pl = vmull_p8(vreinterpret_p8_u8(vget_low_u8(a)),
+					vreinterpret_p8_u8(vget_low_u8(b)));
+	ph = vmull_high_p8(vreinterpretq_p8_u8(a), vreinterpretq_p8_u8(b));
+	lo = vuzp1q_u8(vreinterpretq_u8_p16(pl), vreinterpretq_u8_p16(ph));
+	hi = vuzp2q_u8(vreinterpretq_u8_p16(pl), vreinterpretq_u8_p16(ph));
+	lo = veorq_u8(lo, vqtbl1q_u8(r1, vandq_u8(hi, m1)));
+	lo = veorq_u8(lo, vqtbl1q_u8(r2, vshrq_n_u8(hi, 4)));
+
+	return lo;
+}
+
+void
+maddrc256_pmull_neon_128(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register uint8x16_t r1, r2, m1, c, in1, in2, out;
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_neon_128(region1, region2, length);
+		return;
+	}
+
+	r1 = vld1q_u8(tl[MOEPGF256_POLYNOMIAL & MOEPGF256_MASK]);
+	r2 = vld1q_u8(th[MOEPGF256_POLYNOMIAL & MOEPGF256_MASK]);
+	m1 = vdupq_n_u8(0x0f);
+	c = vdupq_n_u8(constant);
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		in2 = vld1q_u8(region2);
+		in1 = vld1q_u8(region1);
+		out = pmull256(in2, c, r1, r2, m1);
+		out = veorq_u8(out, in1);
+		vst1q_u8(region1, out);
+	}
+}
+
+void
+mulrc256_pmull_neon_128(uint8_t *region, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register uint8x16_t r1, r2, m1, c, in;
+
+	if (constant == 0) {
+		memset(region, 0, length);
+		return;
+	}
+
+	if (constant == 1)
+		return;
+
+	r1 = vld1q_u8(tl[MOEPGF256_POLYNOMIAL & MOEPGF256_MASK]);
+	r2 = vld1q_u8(th[MOEPGF256_POLYNOMIAL & MOEPGF256_MASK]);
+	m1 = vdupq_n_u8(0x0f);
+	c = vdupq_n_u8(constant);
+
+	for (end=region+length; region<end; region+=16) {
+		in = vld1q_u8(region);
+		in = pmull256(in, c, r1, r2, m1);
+		vst1q_u8(region, in);
+	}
+}
+
+void
+maddrc3_256_pmull_neon_128(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register uint8x16_t r1, r2, m1, c, in1, in2, out;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_neon_128(region1, region2, region3, length);
+		return;
+	}
+
+	r1 = vld1q_u8(tl[MOEPGF256_POLYNOMIAL & MOEPGF256_MASK]);
+	r2 = vld1q_u8(th[MOEPGF256_POLYNOMIAL & MOEPGF256_MASK]);
+	m1 = vdupq_n_u8(0x0f);
+	c = vdupq_n_u8(constant);
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16) {
+		in2 = vld1q_u8(region3);
+		in1 = vld1q_u8(region2);
+		out = pmull256(in2, c, r1, r2, m1);
+		out = veorq_u8(out, in1);
+		vst1q_u8(region1, out);
+	}
+}
+
+void
+mulrr256_pmull_neon_128(uint8_t *region1, const uint8_t *region2,
+								size_t length)
+{
+	uint8_t *end;
+	register uint8x16_t r1, r2, m1, in1, in2;
+
+	r1 = vld1q_u8(tl[MOEPGF256_POLYNOMIAL & MOEPGF256_MASK]);
+	r2 = vld1q_u8(th[MOEPGF256_POLYNOMIAL & MOEPGF256_MASK]);
+	m1 = vdupq_n_u8(0x0f);
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		in1 = vld1q_u8(region1);
+		in2 = vld1q_u8(region2);
+		in1 = pmull256(in1, in2, r1, r2, m1);
+		vst1q_u8(region1, in1);
+	}
+}
+
+void
+maddrr256_pmull_neon_128(uint8_t *region1, const uint8_t *region2,
+					const uint8_t *region3, size_t length)
+{
+	uint8_t *end;
+	register uint8x16_t r1, r2, m1, in1, in2, in3;
+
+	r1 = vld1q_u8(tl[MOEPGF256_POLYNOMIAL & MOEPGF256_MASK]);
+	r2 = vld1q_u8(th[MOEPGF256_POLYNOMIAL & MOEPGF256_MASK]);
+	m1 = vdupq_n_u8(0x0f);
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16) {
+		in1 = vld1q_u8(region1);
+		in2 = vld1q_u8(region2);
+		in3 = vld1q_u8(region3);
+		in2 = pmull256(in2, in3, r1, r2, m1);
+		in1 = veorq_u8(in1, in2);
+		vst1q_u8(region1, in1);
+	}
+}
+
+void
+divr256_pmull_neon_128(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	int i, j;
+	uint8x16x4_t it[4];
+	register uint8x16_t r1, r2, m1, m2, in1, in2, inv;
+
+	for (i=0; i<4; i++) {
+		for (j=0; j<4; j++)
+			it[i].val[j] = vld1q_u8(inverses + 64*i + 16*j);
+	}
+	r1 = vld1q_u8(tl[MOEPGF256_POLYNOMIAL & MOEPGF256_MASK]);
+	r2 = vld1q_u8(th[MOEPGF256_POLYNOMIAL & MOEPGF256_MASK]);
+	m1 = vdupq_n_u8(0x0f);
+	m2 = vdupq_n_u8(64);
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		in1 = vld1q_u8(region1);
+		in2 = vld1q_u8(region2);
+		inv = vqtbl4q_u8(it[0], in2);
+		in2 = vsubq_u8(in2, m2);
+		inv = vqtbx4q_u8(inv, it[1], in2);
+		in2 = vsubq_u8(in2, m2);
+		inv = vqtbx4q_u8(inv, it[2], in2);
+		in2 = vsubq_u8(in2, m2);
+		inv = vqtbx4q_u8(inv, it[3], in2);
+		in1 = pmull256(in1, inv, r1, r2, m1);
+		vst1q_u8(region1, in1);
+	}
+}
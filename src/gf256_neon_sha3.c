@@ -0,0 +1,236 @@
+/*
+ * This file is part of moep80211gf.
+ *
+ * Copyright (C) 2014,2019   Stephan M. Guenther <moepi@moepi.net>
+ * Copyright (C) 2016        Nicolas Appel <n.appel@tum.de>
+ * Copyright (C) 2014        Maximilian Riemensberger <riemensberger@tum.de>
+ *
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 2.1 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library. If not, see <https://www.gnu.org/licenses/>
+ *
+ */
+
+#include <arm_neon.h>
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <moepgf/moepgf.h>
+
+#include "gf256.h"
+#include "xor.h"
+
+#if MOEPGF256_POLYNOMIAL == 285
+#include "gf256tables285.h"
+#elif MOEPGF256_POLYNOMIAL == 283 
+#include "gf256tables283.h"
+#else
+#error "Invalid prime polynomial or tables not available."
+#endif
+
+static const uint8_t tl[MOEPGF256_SIZE][16] = MOEPGF256_SHUFFLE_LOW_TABLE;
+static const uint8_t th[MOEPGF256_SIZE][16] = MOEPGF256_SHUFFLE_HIGH_TABLE;
+
+void
+maddrc256_shuffle_neon_sha3(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register uint8x16_t t1, t2, m1, in1, in2, out, l, h;
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_neon_128(region1, region2, length);
+		return;
+	}
+
+	t1 = vld1q_u8(tl[constant]);
+	t2 = vld1q_u8(th[constant]);
+	m1 = vdupq_n_u8(0x0f);
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		in2 = vld1q_u8(region2);
+		in1 = vld1q_u8(region1);
+		l = vandq_u8(in2, m1);
+		l = vqtbl1q_u8(t1, l);
+		h = vshrq_n_u8(in2, 4);
+		h = vqtbl1q_u8(t2, h);
+		out = veor3q_u8(in1, h, l);
+		vst1q_u8(region1, out);
+	}
+}
+
+void
+maddrc_multi256_shuffle_neon_sha3(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	size_t off;
+	int i;
+	register uint8x16_t t1, t2, m1, in, l, h, acc[4];
+
+	m1 = vdupq_n_u8(0x0f);
+
+	for (off=0; off+64<=length; off+=64) {
+		acc[0] = vld1q_u8(region1+off);
+		acc[1] = vld1q_u8(region1+off+16);
+		acc[2] = vld1q_u8(region1+off+32);
+		acc[3] = vld1q_u8(region1+off+48);
+
+		for (i=0; i<count; i++) {
+			if (constants[i] == 0)
+				continue;
+
+			t1 = vld1q_u8(tl[constants[i]]);
+			t2 = vld1q_u8(th[constants[i]]);
+
+			in = vld1q_u8(regions[i]+off);
+			l = vqtbl1q_u8(t1, vandq_u8(in, m1));
+			h = vqtbl1q_u8(t2, vshrq_n_u8(in, 4));
+			acc[0] = veor3q_u8(acc[0], h, l);
+
+			in = vld1q_u8(regions[i]+off+16);
+			l = vqtbl1q_u8(t1, vandq_u8(in, m1));
+			h = vqtbl1q_u8(t2, vshrq_n_u8(in, 4));
+			acc[1] = veor3q_u8(acc[1], h, l);
+
+			in = vld1q_u8(regions[i]+off+32);
+			l = vqtbl1q_u8(t1, vandq_u8(in, m1));
+			h = vqtbl1q_u8(t2, vshrq_n_u8(in, 4));
+			acc[2] = veor3q_u8(acc[2], h, l);
+
+			in = vld1q_u8(regions[i]+off+48);
+			l = vqtbl1q_u8(t1, vandq_u8(in, m1));
+			h = vqtbl1q_u8(t2, vshrq_n_u8(in, 4));
+			acc[3] = veor3q_u8(acc[3], h, l);
+		}
+
+		vst1q_u8(region1+off, acc[0]);
+		vst1q_u8(region1+off+16, acc[1]);
+		vst1q_u8(region1+off+32, acc[2]);
+		vst1q_u8(region1+off+48, acc[3]);
+	}
+
+	for (; off<length; off+=16) {
+		acc[0] = vld1q_u8(region1+off);
+
+		for (i=0; i<count; i++) {
+			if (constants[i] == 0)
+				continue;
+
+			t1 = vld1q_u8(tl[constants[i]]);
+			t2 = vld1q_u8(th[constants[i]]);
+			in = vld1q_u8(regions[i]+off);
+			l = vqtbl1q_u8(t1, vandq_u8(in, m1));
+			h = vqtbl1q_u8(t2, vshrq_n_u8(in, 4));
+			acc[0] = veor3q_u8(acc[0], h, l);
+		}
+
+		vst1q_u8(region1+off, acc[0]);
+	}
+}
+
+void
+maddrc_fanout256_shuffle_neon_sha3(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	size_t off;
+	int i = 0;
+	uint8_t *r[4];
+	register uint8x16_t t1[4], t2[4], m1, in, l, h, out;
+
+	m1 = vdupq_n_u8(0x0f);
+
+	for (; i+4<=count; i+=4) {
+		r[0] = regions[i];
+		r[1] = regions[i+1];
+		r[2] = regions[i+2];
+		r[3] = regions[i+3];
+		t1[0] = vld1q_u8(tl[constants[i]]);
+		t2[0] = vld1q_u8(th[constants[i]]);
+		t1[1] = vld1q_u8(tl[constants[i+1]]);
+		t2[1] = vld1q_u8(th[constants[i+1]]);
+		t1[2] = vld1q_u8(tl[constants[i+2]]);
+		t2[2] = vld1q_u8(th[constants[i+2]]);
+		t1[3] = vld1q_u8(tl[constants[i+3]]);
+		t2[3] = vld1q_u8(th[constants[i+3]]);
+
+		for (off=0; off<length; off+=16) {
+			in = vld1q_u8(region2+off);
+			l = vandq_u8(in, m1);
+			h = vshrq_n_u8(in, 4);
+
+			out = vld1q_u8(r[0]+off);
+			out = veor3q_u8(out, vqtbl1q_u8(t1[0], l),
+						vqtbl1q_u8(t2[0], h));
+			vst1q_u8(r[0]+off, out);
+
+			out = vld1q_u8(r[1]+off);
+			out = veor3q_u8(out, vqtbl1q_u8(t1[1], l),
+						vqtbl1q_u8(t2[1], h));
+			vst1q_u8(r[1]+off, out);
+
+			out = vld1q_u8(r[2]+off);
+			out = veor3q_u8(out, vqtbl1q_u8(t1[2], l),
+						vqtbl1q_u8(t2[2], h));
+			vst1q_u8(r[2]+off, out);
+
+			out = vld1q_u8(r[3]+off);
+			out = veor3q_u8(out, vqtbl1q_u8(t1[3], l),
+						vqtbl1q_u8(t2[3], h));
+			vst1q_u8(r[3]+off, out);
+		}
+	}
+
+	for (; i<count; i++)
+		maddrc256_shuffle_neon_sha3(regions[i], region2,
+						constants[i], length);
+}
+
+void
+maddrc3_256_shuffle_neon_sha3(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register uint8x16_t t1, t2, m1, in1, in2, out, l, h;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_neon_128(region1, region2, region3, length);
+		return;
+	}
+
+	t1 = vld1q_u8(tl[constant]);
+	t2 = vld1q_u8(th[constant]);
+	m1 = vdupq_n_u8(0x0f);
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16) {
+		in2 = vld1q_u8(region3);
+		in1 = vld1q_u8(region2);
+		l = vandq_u8(in2, m1);
+		l = vqtbl1q_u8(t1, l);
+		h = vshrq_n_u8(in2, 4);
+		h = vqtbl1q_u8(t2, h);
+		out = veor3q_u8(in1, h, l);
+		vst1q_u8(region1, out);
+	}
+}
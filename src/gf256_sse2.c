@@ -193,3 +193,253 @@ mulrc256_imul_sse2(uint8_t *region, uint8_t constant, size_t length)
 	}
 }
 
+void
+mulrc_copy256_imul_sse2(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m128i ri[8], mi[8], sp[8], reg;
+	const uint8_t *p = pt[constant];
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	mi[0] = _mm_set1_epi8(0x01);
+	mi[1] = _mm_set1_epi8(0x02);
+	mi[2] = _mm_set1_epi8(0x04);
+	mi[3] = _mm_set1_epi8(0x08);
+	mi[4] = _mm_set1_epi8(0x10);
+	mi[5] = _mm_set1_epi8(0x20);
+	mi[6] = _mm_set1_epi8(0x40);
+	mi[7] = _mm_set1_epi8(0x80);
+
+	sp[0] = _mm_set1_epi16(p[0]);
+	sp[1] = _mm_set1_epi16(p[1]);
+	sp[2] = _mm_set1_epi16(p[2]);
+	sp[3] = _mm_set1_epi16(p[3]);
+	sp[4] = _mm_set1_epi16(p[4]);
+	sp[5] = _mm_set1_epi16(p[5]);
+	sp[6] = _mm_set1_epi16(p[6]);
+	sp[7] = _mm_set1_epi16(p[7]);
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		reg = _mm_load_si128((void *)region2);
+
+		ri[0] = _mm_and_si128(reg, mi[0]);
+		ri[1] = _mm_and_si128(reg, mi[1]);
+		ri[2] = _mm_and_si128(reg, mi[2]);
+		ri[3] = _mm_and_si128(reg, mi[3]);
+		ri[4] = _mm_and_si128(reg, mi[4]);
+		ri[5] = _mm_and_si128(reg, mi[5]);
+		ri[6] = _mm_and_si128(reg, mi[6]);
+		ri[7] = _mm_and_si128(reg, mi[7]);
+
+		ri[1] = _mm_srli_epi16(ri[1], 1);
+		ri[2] = _mm_srli_epi16(ri[2], 2);
+		ri[3] = _mm_srli_epi16(ri[3], 3);
+		ri[4] = _mm_srli_epi16(ri[4], 4);
+		ri[5] = _mm_srli_epi16(ri[5], 5);
+		ri[6] = _mm_srli_epi16(ri[6], 6);
+		ri[7] = _mm_srli_epi16(ri[7], 7);
+
+		ri[0] = _mm_mullo_epi16(ri[0], sp[0]);
+		ri[1] = _mm_mullo_epi16(ri[1], sp[1]);
+		ri[2] = _mm_mullo_epi16(ri[2], sp[2]);
+		ri[3] = _mm_mullo_epi16(ri[3], sp[3]);
+		ri[4] = _mm_mullo_epi16(ri[4], sp[4]);
+		ri[5] = _mm_mullo_epi16(ri[5], sp[5]);
+		ri[6] = _mm_mullo_epi16(ri[6], sp[6]);
+		ri[7] = _mm_mullo_epi16(ri[7], sp[7]);
+
+		ri[0] = _mm_xor_si128(ri[0], ri[1]);
+		ri[2] = _mm_xor_si128(ri[2], ri[3]);
+		ri[4] = _mm_xor_si128(ri[4], ri[5]);
+		ri[6] = _mm_xor_si128(ri[6], ri[7]);
+		ri[0] = _mm_xor_si128(ri[0], ri[2]);
+		ri[4] = _mm_xor_si128(ri[4], ri[6]);
+		ri[0] = _mm_xor_si128(ri[0], ri[4]);
+
+		_mm_store_si128((void *)region1, ri[0]);
+	}
+}
+
+void
+maddrc_multi256_imul_sse2(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++)
+		maddrc256_imul_sse2(region1, regions[i], constants[i], length);
+}
+
+void
+maddrc_fanout256_imul_sse2(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++)
+		maddrc256_imul_sse2(regions[i], region2, constants[i], length);
+}
+
+void
+maddrc3_256_imul_sse2(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m128i ri[8], mi[8], sp[8], reg1, reg2;
+	const uint8_t *p = pt[constant];
+	
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_sse2(region1, region2, region3, length);
+		return;
+	}
+	
+	mi[0] = _mm_set1_epi8(0x01);
+	mi[1] = _mm_set1_epi8(0x02);
+	mi[2] = _mm_set1_epi8(0x04);
+	mi[3] = _mm_set1_epi8(0x08);
+	mi[4] = _mm_set1_epi8(0x10);
+	mi[5] = _mm_set1_epi8(0x20);
+	mi[6] = _mm_set1_epi8(0x40);
+	mi[7] = _mm_set1_epi8(0x80);
+
+	sp[0] = _mm_set1_epi16(p[0]);
+	sp[1] = _mm_set1_epi16(p[1]);
+	sp[2] = _mm_set1_epi16(p[2]);
+	sp[3] = _mm_set1_epi16(p[3]);
+	sp[4] = _mm_set1_epi16(p[4]);
+	sp[5] = _mm_set1_epi16(p[5]);
+	sp[6] = _mm_set1_epi16(p[6]);
+	sp[7] = _mm_set1_epi16(p[7]);
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16) {
+		reg1 = _mm_load_si128((void *)region2);
+		reg2 = _mm_load_si128((void *)region3);
+
+		ri[0] = _mm_and_si128(reg2, mi[0]);
+		ri[1] = _mm_and_si128(reg2, mi[1]);
+		ri[2] = _mm_and_si128(reg2, mi[2]);
+		ri[3] = _mm_and_si128(reg2, mi[3]);
+		ri[4] = _mm_and_si128(reg2, mi[4]);
+		ri[5] = _mm_and_si128(reg2, mi[5]);
+		ri[6] = _mm_and_si128(reg2, mi[6]);
+		ri[7] = _mm_and_si128(reg2, mi[7]);
+
+		ri[1] = _mm_srli_epi16(ri[1], 1);
+		ri[2] = _mm_srli_epi16(ri[2], 2);
+		ri[3] = _mm_srli_epi16(ri[3], 3);
+		ri[4] = _mm_srli_epi16(ri[4], 4);
+		ri[5] = _mm_srli_epi16(ri[5], 5);
+		ri[6] = _mm_srli_epi16(ri[6], 6);
+		ri[7] = _mm_srli_epi16(ri[7], 7);
+
+		ri[0] = _mm_mullo_epi16(ri[0], sp[0]);
+		ri[1] = _mm_mullo_epi16(ri[1], sp[1]);
+		ri[2] = _mm_mullo_epi16(ri[2], sp[2]);
+		ri[3] = _mm_mullo_epi16(ri[3], sp[3]);
+		ri[4] = _mm_mullo_epi16(ri[4], sp[4]);
+		ri[5] = _mm_mullo_epi16(ri[5], sp[5]);
+		ri[6] = _mm_mullo_epi16(ri[6], sp[6]);
+		ri[7] = _mm_mullo_epi16(ri[7], sp[7]);
+
+		ri[0] = _mm_xor_si128(ri[0], ri[1]);
+		ri[2] = _mm_xor_si128(ri[2], ri[3]);
+		ri[4] = _mm_xor_si128(ri[4], ri[5]);
+		ri[6] = _mm_xor_si128(ri[6], ri[7]);
+		ri[0] = _mm_xor_si128(ri[0], ri[2]);
+		ri[4] = _mm_xor_si128(ri[4], ri[6]);
+		ri[0] = _mm_xor_si128(ri[0], ri[4]);
+		ri[0] = _mm_xor_si128(ri[0], reg1);
+
+		_mm_store_si128((void *)region1, ri[0]);
+	}
+}
+
+void
+mulrr256_imul_sse2(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	int i;
+	register __m128i a, b, t, acc, l, nl, p;
+
+	l = _mm_set1_epi8(0x01);
+	nl = _mm_set1_epi8(0xfe);
+	p = _mm_set1_epi8(MOEPGF256_POLYNOMIAL & MOEPGF256_MASK);
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		a = _mm_load_si128((void *)region1);
+		b = _mm_load_si128((void *)region2);
+		acc = _mm_setzero_si128();
+
+		for (i=0; i<MOEPGF256_EXPONENT; i++) {
+			t = _mm_and_si128(b, l);
+			t = _mm_sub_epi16(_mm_slli_epi16(t, 8), t);
+			t = _mm_and_si128(t, a);
+			acc = _mm_xor_si128(acc, t);
+			b = _mm_srli_epi16(b, 1);
+
+			t = _mm_srli_epi16(a, 7);
+			t = _mm_and_si128(t, l);
+			t = _mm_sub_epi16(_mm_slli_epi16(t, 8), t);
+			t = _mm_and_si128(t, p);
+			a = _mm_slli_epi16(a, 1);
+			a = _mm_and_si128(a, nl);
+			a = _mm_xor_si128(a, t);
+		}
+
+		_mm_store_si128((void *)region1, acc);
+	}
+}
+
+void
+maddrr256_imul_sse2(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, size_t length)
+{
+	uint8_t *end;
+	int i;
+	register __m128i a, b, t, acc, l, nl, p;
+
+	l = _mm_set1_epi8(0x01);
+	nl = _mm_set1_epi8(0xfe);
+	p = _mm_set1_epi8(MOEPGF256_POLYNOMIAL & MOEPGF256_MASK);
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16) {
+		a = _mm_load_si128((void *)region2);
+		b = _mm_load_si128((void *)region3);
+		acc = _mm_load_si128((void *)region1);
+
+		for (i=0; i<MOEPGF256_EXPONENT; i++) {
+			t = _mm_and_si128(b, l);
+			t = _mm_sub_epi16(_mm_slli_epi16(t, 8), t);
+			t = _mm_and_si128(t, a);
+			acc = _mm_xor_si128(acc, t);
+			b = _mm_srli_epi16(b, 1);
+
+			t = _mm_srli_epi16(a, 7);
+			t = _mm_and_si128(t, l);
+			t = _mm_sub_epi16(_mm_slli_epi16(t, 8), t);
+			t = _mm_and_si128(t, p);
+			a = _mm_slli_epi16(a, 1);
+			a = _mm_and_si128(a, nl);
+			a = _mm_xor_si128(a, t);
+		}
+
+		_mm_store_si128((void *)region1, acc);
+	}
+}
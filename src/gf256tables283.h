@@ -4394,7 +4394,7 @@
 0x5b,0x23,0x38,0x34,0x68,0x46,0x03,0x8c,0xdd,0x9c,0x7d,0xa0,0xcd,0x1a,0x41,0x1c\
 }
 
-#ifdef __x86_64__
+#ifndef __arm__
 #define MOEPGF256_SHUFFLE_LOW_TABLE { \
 {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},\
 {0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f},\
@@ -4911,7 +4911,73 @@
 {0x00,0x79,0xf2,0x8b,0xff,0x86,0x0d,0x74,0xe5,0x9c,0x17,0x6e,0x1a,0x63,0xe8,0x91},\
 {0x00,0x69,0xd2,0xbb,0xbf,0xd6,0x6d,0x04,0x65,0x0c,0xb7,0xde,0xda,0xb3,0x08,0x61}\
 }
-#endif //__x86_64__
+#define MOEPGF256_AFFINE_TABLE { \
+0x0000000000000000,0x0102040810204080,0x8081028488102040,0x8183068c983060c0,\
+0x40c08142c4881020,0x41c2854ad4a850a0,0xc04183c64c983060,0xc14387ce5cb870e0,\
+0x2060c0a162c48810,0x2162c4a972e4c890,0xa0e1c225ead4a850,0xa1e3c62dfaf4e8d0,\
+0x60a041e3a64c9830,0x61a245ebb66cd8b0,0xe02143672e5cb870,0xe123476f3e7cf8f0,\
+0x103060d0b162c488,0x113264d8a1428408,0x90b162543972e4c8,0x91b3665c2952a448,\
+0x50f0e19275ead4a8,0x51f2e59a65ca9428,0xd071e316fdfaf4e8,0xd173e71eeddab468,\
+0x3050a071d3a64c98,0x3152a479c3860c18,0xb0d1a2f55bb66cd8,0xb1d3a6fd4b962c58,\
+0x70902133172e5cb8,0x7192253b070e1c38,0xf01123b79f3e7cf8,0xf11327bf8f1e3c78,\
+0x889830e858b162c4,0x899a34e048912244,0x0819326cd0a14284,0x091b3664c0810204,\
+0xc858b1aa9c3972e4,0xc95ab5a28c193264,0x48d9b32e142952a4,0x49dbb72604091224,\
+0xa8f8f0493a75ead4,0xa9faf4412a55aa54,0x2879f2cdb265ca94,0x297bf6c5a2458a14,\
+0xe838710bfefdfaf4,0xe93a7503eeddba74,0x68b9738f76eddab4,0x69bb778766cd9a34,\
+0x98a85038e9d3a64c,0x99aa5430f9f3e6cc,0x182952bc61c3860c,0x192b56b471e3c68c,\
+0xd868d17a2d5bb66c,0xd96ad5723d7bf6ec,0x58e9d3fea54b962c,0x59ebd7f6b56bd6ac,\
+0xb8c890998b172e5c,0xb9ca94919b376edc,0x3849921d03070e1c,0x394b961513274e9c,\
+0xf80811db4f9f3e7c,0xf90a15d35fbf7efc,0x7889135fc78f1e3c,0x798b1757d7af5ebc,\
+0xc44c98f42c58b162,0xc54e9cfc3c78f1e2,0x44cd9a70a4489122,0x45cf9e78b468d1a2,\
+0x848c19b6e8d0a142,0x858e1dbef8f0e1c2,0x040d1b3260c08102,0x050f1f3a70e0c182,\
+0xe42c58554e9c3972,0xe52e5c5d5ebc79f2,0x64ad5ad1c68c1932,0x65af5ed9d6ac59b2,\
+0xa4ecd9178a142952,0xa5eedd1f9a3469d2,0x246ddb9302040912,0x256fdf9b12244992,\
+0xd47cf8249d3a75ea,0xd57efc2c8d1a356a,0x54fdfaa0152a55aa,0x55fffea8050a152a,\
+0x94bc796659b265ca,0x95be7d6e4992254a,0x143d7be2d1a2458a,0x153f7feac182050a,\
+0xf41c3885fffefdfa,0xf51e3c8defdebd7a,0x749d3a0177eeddba,0x759f3e0967ce9d3a,\
+0xb4dcb9c73b76edda,0xb5debdcf2b56ad5a,0x345dbb43b366cd9a,0x355fbf4ba3468d1a,\
+0x4cd4a81c74e9d3a6,0x4dd6ac1464c99326,0xcc55aa98fcf9f3e6,0xcd57ae90ecd9b366,\
+0x0c14295eb061c386,0x0d162d56a0418306,0x8c952bda3871e3c6,0x8d972fd22851a346,\
+0x6cb468bd162d5bb6,0x6db66cb5060d1b36,0xec356a399e3d7bf6,0xed376e318e1d3b76,\
+0x2c74e9ffd2a54b96,0x2d76edf7c2850b16,0xacf5eb7b5ab56bd6,0xadf7ef734a952b56,\
+0x5ce4c8ccc58b172e,0x5de6ccc4d5ab57ae,0xdc65ca484d9b376e,0xdd67ce405dbb77ee,\
+0x1c24498e0103070e,0x1d264d861123478e,0x9ca54b0a8913274e,0x9da74f02993367ce,\
+0x7c84086da74f9f3e,0x7d860c65b76fdfbe,0xfc050ae92f5fbf7e,0xfd070ee13f7ffffe,\
+0x3c44892f63c78f1e,0x3d468d2773e7cf9e,0xbcc58babebd7af5e,0xbdc78fa3fbf7efde,\
+0x62a64cfa962c58b1,0x63a448f2860c1831,0xe2274e7e1e3c78f1,0xe3254a760e1c3871,\
+0x2266cdb852a44891,0x2364c9b042840811,0xa2e7cf3cdab468d1,0xa3e5cb34ca942851,\
+0x42c68c5bf4e8d0a1,0x43c48853e4c89021,0xc2478edf7cf8f0e1,0xc3458ad76cd8b061,\
+0x02060d193060c081,0x0304091120408001,0x82870f9db870e0c1,0x83850b95a850a041,\
+0x72962c2a274e9c39,0x73942822376edcb9,0xf2172eaeaf5ebc79,0xf3152aa6bf7efcf9,\
+0x3256ad68e3c68c19,0x3354a960f3e6cc99,0xb2d7afec6bd6ac59,0xb3d5abe47bf6ecd9,\
+0x52f6ec8b458a1429,0x53f4e88355aa54a9,0xd277ee0fcd9a3469,0xd375ea07ddba74e9,\
+0x12366dc981020409,0x133469c191224489,0x92b76f4d09122449,0x93b56b45193264c9,\
+0xea3e7c12ce9d3a75,0xeb3c781adebd7af5,0x6abf7e96468d1a35,0x6bbd7a9e56ad5ab5,\
+0xaafefd500a152a55,0xabfcf9581a356ad5,0x2a7fffd482050a15,0x2b7dfbdc92254a95,\
+0xca5ebcb3ac59b265,0xcb5cb8bbbc79f2e5,0x4adfbe3724499225,0x4bddba3f3469d2a5,\
+0x8a9e3df168d1a245,0x8b9c39f978f1e2c5,0x0a1f3f75e0c18205,0x0b1d3b7df0e1c285,\
+0xfa0e1cc27ffffefd,0xfb0c18ca6fdfbe7d,0x7a8f1e46f7efdebd,0x7b8d1a4ee7cf9e3d,\
+0xbace9d80bb77eedd,0xbbcc9988ab57ae5d,0x3a4f9f043367ce9d,0x3b4d9b0c23478e1d,\
+0xda6edc631d3b76ed,0xdb6cd86b0d1b366d,0x5aefdee7952b56ad,0x5beddaef850b162d,\
+0x9aae5d21d9b366cd,0x9bac5929c993264d,0x1a2f5fa551a3468d,0x1b2d5bad4183060d,\
+0xa6ead40eba74e9d3,0xa7e8d006aa54a953,0x266bd68a3264c993,0x2769d28222448913,\
+0xe62a554c7efcf9f3,0xe72851446edcb973,0x66ab57c8f6ecd9b3,0x67a953c0e6cc9933,\
+0x868a14afd8b061c3,0x878810a7c8902143,0x060b162b50a04183,0x0709122340800103,\
+0xc64a95ed1c3871e3,0xc74891e50c183163,0x46cb9769942851a3,0x47c9936184081123,\
+0xb6dab4de0b162d5b,0xb7d8b0d61b366ddb,0x365bb65a83060d1b,0x3759b25293264d9b,\
+0xf61a359ccf9e3d7b,0xf7183194dfbe7dfb,0x769b3718478e1d3b,0x7799331057ae5dbb,\
+0x96ba747f69d2a54b,0x97b8707779f2e5cb,0x163b76fbe1c2850b,0x173972f3f1e2c58b,\
+0xd67af53dad5ab56b,0xd778f135bd7af5eb,0x56fbf7b9254a952b,0x57f9f3b1356ad5ab,\
+0x2e72e4e6e2c58b17,0x2f70e0eef2e5cb97,0xaef3e6626ad5ab57,0xaff1e26a7af5ebd7,\
+0x6eb265a4264d9b37,0x6fb061ac366ddbb7,0xee336720ae5dbb77,0xef316328be7dfbf7,\
+0x0e12244780010307,0x0f10204f90214387,0x8e9326c308112347,0x8f9122cb183163c7,\
+0x4ed2a50544891327,0x4fd0a10d54a953a7,0xce53a781cc993367,0xcf51a389dcb973e7,\
+0x3e42843653a74f9f,0x3f40803e43870f1f,0xbec386b2dbb76fdf,0xbfc182bacb972f5f,\
+0x7e820574972f5fbf,0x7f80017c870f1f3f,0xfe0307f01f3f7fff,0xff0103f80f1f3f7f,\
+0x1e2244973163c78f,0x1f20409f2143870f,0x9ea34613b973e7cf,0x9fa1421ba953a74f,\
+0x5ee2c5d5f5ebd7af,0x5fe0c1dde5cb972f,0xde63c7517dfbf7ef,0xdf61c3596ddbb76f\
+}
+#endif //!__arm__
 
 #ifdef __arm__
 #define MOEPGF256_SHUFFLE_LOW_TABLE { \
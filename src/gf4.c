@@ -153,6 +153,30 @@ mulrc4_imul_scalar(uint8_t *region, uint8_t constant, size_t length)
 	}
 }
 
+void
+mulrc_copy4_imul_scalar(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	const uint8_t *p = pt[constant];
+	uint8_t r[4];
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	for (; length; region1++, region2++, length--) {
+		r[0] = ((*region2 & 0x55) >> 0) * p[0];
+		r[1] = ((*region2 & 0xaa) >> 1) * p[1];
+		*region1 = r[0] ^ r[1];
+	}
+}
+
 void
 mulrc4_imul_gpr32(uint8_t *region, uint8_t constant, size_t length)
 {
@@ -175,6 +199,32 @@ mulrc4_imul_gpr32(uint8_t *region, uint8_t constant, size_t length)
 	}
 }
 
+void
+mulrc_copy4_imul_gpr32(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	const uint8_t *p = pt[constant];
+	uint64_t r64[2];
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	for (end=region1+length; region1<end;
+			region1+=4, region2+=4, length-=4) {
+		r64[0] = ((*(uint32_t *)region2 & 0x55555555)>>0)*p[0];
+		r64[1] = ((*(uint32_t *)region2 & 0xaaaaaaaa)>>1)*p[1];
+		*((uint32_t *)region1) = r64[0] ^ r64[1];
+	}
+}
+
 void
 mulrc4_imul_gpr64(uint8_t *region, uint8_t constant, size_t length)
 {
@@ -197,3 +247,306 @@ mulrc4_imul_gpr64(uint8_t *region, uint8_t constant, size_t length)
 	}
 }
 
+void
+mulrc_copy4_imul_gpr64(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	const uint8_t *p = pt[constant];
+	uint64_t r64[2];
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	for (end=region1+length; region1<end; region1+=8, region2+=8) {
+		r64[0] = ((*(uint64_t *)region2 & 0x5555555555555555)>>0)*p[0];
+		r64[1] = ((*(uint64_t *)region2 & 0xaaaaaaaaaaaaaaaa)>>1)*p[1];
+		*((uint64_t *)region1) = r64[0] ^ r64[1];
+	}
+}
+
+void
+maddrc_multi4_imul_scalar(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++)
+		maddrc4_imul_scalar(region1, regions[i], constants[i], length);
+}
+
+void
+maddrc_multi4_imul_gpr64(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++)
+		maddrc4_imul_gpr64(region1, regions[i], constants[i], length);
+}
+
+void
+maddrc_fanout4_imul_scalar(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++)
+		maddrc4_imul_scalar(regions[i], region2, constants[i], length);
+}
+
+void
+maddrc_fanout4_imul_gpr64(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++)
+		maddrc4_imul_gpr64(regions[i], region2, constants[i], length);
+}
+
+inline void
+maddrc3_4_imul_scalar(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	const uint8_t *p = pt[constant];
+	uint8_t r[4];
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_scalar(region1, region2, region3, length);
+		return;
+	}
+
+	for (; length; region1++, region2++, region3++, length--) {
+		r[0] = ((*region3 & 0x55) >> 0) * p[0];
+		r[1] = ((*region3 & 0xaa) >> 1) * p[1];
+		*region1 = *region2 ^ r[0] ^ r[1];
+	}
+}
+
+inline void
+maddrc3_4_imul_gpr32(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	const uint8_t *p = pt[constant];
+	uint32_t r64[4];
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+	   xorr3_gpr32(region1, region2, region3, length);
+	   return;
+	}
+
+	for (end=region1+length; region1<end;
+			region1+=4, region2+=4, region3+=4) {
+		r64[0] = ((*(uint32_t *)region3 & 0x55555555)>>0)*p[0];
+		r64[1] = ((*(uint32_t *)region3 & 0xaaaaaaaa)>>1)*p[1];
+		*((uint32_t *)region1) = *((uint32_t *)region2)
+					^ r64[0] ^ r64[1];
+	}
+}
+
+inline void
+maddrc3_4_imul_gpr64(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	const uint8_t *p = pt[constant];
+	uint64_t r64[4];
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_gpr64(region1, region2, region3, length);
+		return;
+	}
+
+	for (end=region1+length; region1<end;
+			region1+=8, region2+=8, region3+=8) {
+		r64[0] = ((*(uint64_t *)region3 & 0x5555555555555555)>>0)*p[0];
+		r64[1] = ((*(uint64_t *)region3 & 0xaaaaaaaaaaaaaaaa)>>1)*p[1];
+		*((uint64_t *)region1) = *((uint64_t *)region2)
+					^ r64[0] ^ r64[1];
+	}
+}
+
+inline void
+maddrc3_4_flat_table(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_scalar(region1, region2, region3, length);
+		return;
+	}
+
+	for (; length; region1++, region2++, region3++, length--) {
+		*region1 = *region2 ^ multab[constant][*region3];
+	}
+}
+
+void
+mulrr4_flat_table(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	for (; length; region1++, region2++, length--) {
+		*region1 = (multab[(*region2 >> 6) & 3][*region1] & 0xc0)
+				| (multab[(*region2 >> 4) & 3][*region1] & 0x30)
+				| (multab[(*region2 >> 2) & 3][*region1] & 0x0c)
+				| (multab[(*region2 >> 0) & 3][*region1] & 0x03);
+	}
+}
+
+void
+maddrr4_flat_table(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, size_t length)
+{
+	for (; length; region1++, region2++, region3++, length--) {
+		*region1 ^= (multab[(*region3 >> 6) & 3][*region2] & 0xc0)
+				| (multab[(*region3 >> 4) & 3][*region2] & 0x30)
+				| (multab[(*region3 >> 2) & 3][*region2] & 0x0c)
+				| (multab[(*region3 >> 0) & 3][*region2] & 0x03);
+	}
+}
+
+void
+mulrr4_imul_gpr64(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	uint64_t a, b, t, acc, p;
+	int i;
+
+	p = (uint64_t)(MOEPGF4_POLYNOMIAL & MOEPGF4_MASK) * 0x5555555555555555;
+
+	for (end=region1+length; region1<end; region1+=8, region2+=8) {
+		a = *(uint64_t *)region1;
+		b = *(uint64_t *)region2;
+		acc = 0;
+
+		for (i=0; i<MOEPGF4_EXPONENT; i++) {
+			t = b & 0x5555555555555555;
+			acc ^= a & ((t << 2) - t);
+			b >>= 1;
+			t = (a >> 1) & 0x5555555555555555;
+			t = ((t << 2) - t) & p;
+			a = ((a << 1) & 0xaaaaaaaaaaaaaaaa) ^ t;
+		}
+
+		*(uint64_t *)region1 = acc;
+	}
+}
+
+void
+maddrr4_imul_gpr64(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, size_t length)
+{
+	uint8_t *end;
+	uint64_t a, b, t, acc, p;
+	int i;
+
+	p = (uint64_t)(MOEPGF4_POLYNOMIAL & MOEPGF4_MASK) * 0x5555555555555555;
+
+	for (end=region1+length; region1<end;
+			region1+=8, region2+=8, region3+=8) {
+		a = *(uint64_t *)region2;
+		b = *(uint64_t *)region3;
+		acc = *(uint64_t *)region1;
+
+		for (i=0; i<MOEPGF4_EXPONENT; i++) {
+			t = b & 0x5555555555555555;
+			acc ^= a & ((t << 2) - t);
+			b >>= 1;
+			t = (a >> 1) & 0x5555555555555555;
+			t = ((t << 2) - t) & p;
+			a = ((a << 1) & 0xaaaaaaaaaaaaaaaa) ^ t;
+		}
+
+		*(uint64_t *)region1 = acc;
+	}
+}
+
+void
+invr4_flat_table(uint8_t *region, size_t length)
+{
+	for (; length; region++, length--) {
+		*region = (inverses[(*region >> 6) & 3] << 6)
+				| (inverses[(*region >> 4) & 3] << 4)
+				| (inverses[(*region >> 2) & 3] << 2)
+				| inverses[*region & 3];
+	}
+}
+
+void
+divr4_flat_table(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	for (; length; region1++, region2++, length--) {
+		*region1 = (multab[inverses[(*region2 >> 6) & 3]][*region1] & 0xc0)
+			| (multab[inverses[(*region2 >> 4) & 3]][*region1] & 0x30)
+			| (multab[inverses[(*region2 >> 2) & 3]][*region1] & 0x0c)
+			| (multab[inverses[*region2 & 3]][*region1] & 0x03);
+	}
+}
+
+
+void
+invr4_imul_gpr64(uint8_t *region, size_t length)
+{
+	uint8_t *end;
+	uint64_t t;
+
+	for (end=region+length; region<end; region+=8) {
+		t = *(uint64_t *)region;
+		*(uint64_t *)region = t ^ ((t >> 1) & 0x5555555555555555);
+	}
+}
+
+void
+divr4_imul_gpr64(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	uint64_t a, b, t, acc, p;
+	int i;
+
+	p = (uint64_t)(MOEPGF4_POLYNOMIAL & MOEPGF4_MASK) * 0x5555555555555555;
+
+	for (end=region1+length; region1<end; region1+=8, region2+=8) {
+		a = *(uint64_t *)region1;
+		b = *(uint64_t *)region2;
+		b ^= (b >> 1) & 0x5555555555555555;
+		acc = 0;
+
+		for (i=0; i<MOEPGF4_EXPONENT; i++) {
+			t = b & 0x5555555555555555;
+			acc ^= a & ((t << 2) - t);
+			b >>= 1;
+			t = (a >> 1) & 0x5555555555555555;
+			t = ((t << 2) - t) & p;
+			a = ((a << 1) & 0xaaaaaaaaaaaaaaaa) ^ t;
+		}
+
+		*(uint64_t *)region1 = acc;
+	}
+}
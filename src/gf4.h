@@ -34,16 +34,66 @@ void maddrc4_imul_gpr32(uint8_t *region1, const uint8_t *region2, uint8_t consta
 void maddrc4_imul_gpr64(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 
 void mulrc4_imul_scalar(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy4_imul_scalar(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void mulrc4_imul_gpr32(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy4_imul_gpr32(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void mulrc4_imul_gpr64(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy4_imul_gpr64(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+
+void maddrc_multi4_imul_scalar(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_multi4_imul_gpr64(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+
+void maddrc_fanout4_imul_scalar(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout4_imul_gpr64(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+
+void maddrc3_4_imul_scalar(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_4_flat_table(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_4_imul_gpr32(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_4_imul_gpr64(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+
+void mulrr4_flat_table(uint8_t *region1, const uint8_t *region2, size_t length);
+void mulrr4_imul_gpr64(uint8_t *region1, const uint8_t *region2, size_t length);
+void maddrr4_flat_table(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void maddrr4_imul_gpr64(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+
+void invr4_flat_table(uint8_t *region, size_t length);
+void invr4_imul_gpr64(uint8_t *region, size_t length);
+void divr4_flat_table(uint8_t *region1, const uint8_t *region2, size_t length);
+void divr4_imul_gpr64(uint8_t *region1, const uint8_t *region2, size_t length);
+
+#ifndef __arm__
+void maddrc4_shuffle_vector(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc4_shuffle_vector(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy4_shuffle_vector(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi4_shuffle_vector(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout4_shuffle_vector(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_4_shuffle_vector(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+#endif
 
 #ifdef __x86_64__
 void mulrc4_imul_sse2(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy4_imul_sse2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void mulrc4_imul_avx2(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy4_imul_avx2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void mulrc4_imul_avx512(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy4_imul_avx512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void mulrc4_shuffle_ssse3(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy4_shuffle_ssse3(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void mulrc4_shuffle_avx2(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy4_shuffle_avx2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_copy_nt4_shuffle_avx2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void mulrc4_shuffle_avx512(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy4_shuffle_avx512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_copy_nt4_shuffle_avx512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc4_shuffle_ssse3_x2(uint8_t *region, uint8_t constant, size_t length);
+void mulrc4_shuffle_ssse3_x4(uint8_t *region, uint8_t constant, size_t length);
+void mulrc4_shuffle_avx2_x2(uint8_t *region, uint8_t constant, size_t length);
+void mulrc4_shuffle_avx2_x4(uint8_t *region, uint8_t constant, size_t length);
+void mulrc4_shuffle_avx512_x2(uint8_t *region, uint8_t constant, size_t length);
+void mulrc4_shuffle_avx512_x4(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_prefetch4_shuffle_ssse3(uint8_t *region, uint8_t constant, size_t length, size_t distance);
+void mulrc_prefetch4_shuffle_avx2(uint8_t *region, uint8_t constant, size_t length, size_t distance);
+void mulrc_prefetch4_shuffle_avx512(uint8_t *region, uint8_t constant, size_t length, size_t distance);
 
 void maddrc4_imul_sse2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void maddrc4_imul_avx2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
@@ -51,6 +101,106 @@ void maddrc4_imul_avx512(uint8_t *region1, const uint8_t *region2, uint8_t const
 void maddrc4_shuffle_ssse3(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void maddrc4_shuffle_avx2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void maddrc4_shuffle_avx512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc4_shuffle_ssse3_x2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc4_shuffle_ssse3_x4(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc4_shuffle_avx2_x2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc4_shuffle_avx2_x4(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc4_shuffle_avx512_x2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc4_shuffle_avx512_x4(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_prefetch4_shuffle_ssse3(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length, size_t distance);
+void maddrc_prefetch4_shuffle_avx2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length, size_t distance);
+void maddrc_prefetch4_shuffle_avx512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length, size_t distance);
+
+void maddrc_multi4_imul_sse2(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_multi4_shuffle_ssse3(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_multi4_shuffle_avx2(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_multi4_shuffle_avx512(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+
+void maddrc_fanout4_imul_sse2(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout4_shuffle_ssse3(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout4_shuffle_avx2(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout4_shuffle_avx512(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+
+void maddrc3_4_imul_sse2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_4_imul_avx2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_4_imul_avx512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_4_shuffle_ssse3(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_4_shuffle_avx2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_nt4_shuffle_avx2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_4_shuffle_avx512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_nt4_shuffle_avx512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+
+void mulrr4_imul_sse2(uint8_t *region1, const uint8_t *region2, size_t length);
+void mulrr4_imul_avx2(uint8_t *region1, const uint8_t *region2, size_t length);
+void mulrr4_imul_avx512(uint8_t *region1, const uint8_t *region2, size_t length);
+void maddrr4_imul_sse2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void maddrr4_imul_avx2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void maddrr4_imul_avx512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+
+void invr4_imul_sse2(uint8_t *region, size_t length);
+void invr4_imul_avx2(uint8_t *region, size_t length);
+void invr4_imul_avx512(uint8_t *region, size_t length);
+void divr4_imul_sse2(uint8_t *region1, const uint8_t *region2, size_t length);
+void divr4_imul_avx2(uint8_t *region1, const uint8_t *region2, size_t length);
+void divr4_imul_avx512(uint8_t *region1, const uint8_t *region2, size_t length);
+
+void maddrc_unaligned4_shuffle_ssse3(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_unaligned4_shuffle_avx2(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_unaligned4_shuffle_avx512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_unaligned4_shuffle_ssse3(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_unaligned4_shuffle_avx2(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_unaligned4_shuffle_avx512(uint8_t *region, uint8_t constant, size_t length);
+
+void maddrc4_gfni_affine128(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc4_gfni_affine128(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy4_gfni_affine128(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi4_gfni_affine128(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout4_gfni_affine128(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_4_gfni_affine128(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc_unaligned4_gfni_affine128(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_unaligned4_gfni_affine128(uint8_t *region, uint8_t constant, size_t length);
+void maddrc4_gfni_affine256(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc4_gfni_affine256(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy4_gfni_affine256(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi4_gfni_affine256(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout4_gfni_affine256(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_4_gfni_affine256(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc_unaligned4_gfni_affine256(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_unaligned4_gfni_affine256(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy_nt4_gfni_affine256(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc3_nt4_gfni_affine256(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc4_gfni_affine512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc4_gfni_affine512(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy4_gfni_affine512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi4_gfni_affine512(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout4_gfni_affine512(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_4_gfni_affine512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc_unaligned4_gfni_affine512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_unaligned4_gfni_affine512(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy_nt4_gfni_affine512(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc3_nt4_gfni_affine512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+
+void maddrc4_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc4_shuffle_avx512vl(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy4_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi4_shuffle_avx512vl(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout4_shuffle_avx512vl(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_4_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc_unaligned4_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_unaligned4_shuffle_avx512vl(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy_nt4_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc3_nt4_shuffle_avx512vl(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+
+void maddrc4_gfni_affine_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc4_gfni_affine_avx512vl(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy4_gfni_affine_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi4_gfni_affine_avx512vl(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout4_gfni_affine_avx512vl(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_4_gfni_affine_avx512vl(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc_unaligned4_gfni_affine_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc_unaligned4_gfni_affine_avx512vl(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy_nt4_gfni_affine_avx512vl(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc3_nt4_gfni_affine_avx512vl(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
 #endif
 
 #ifdef __arm__
@@ -58,6 +208,35 @@ void maddrc4_shuffle_neon_64(uint8_t *region1, const uint8_t *region2, uint8_t c
 void maddrc4_imul_neon_64(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void maddrc4_imul_neon_128(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
 void mulrc4_imul_neon_64(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy4_imul_neon_64(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+
+void maddrc_multi4_imul_neon_128(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+
+void maddrc_fanout4_imul_neon_128(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+
+void maddrc3_4_shuffle_neon_64(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_4_imul_neon_64(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+void maddrc3_4_imul_neon_128(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+
+void mulrr4_imul_neon_128(uint8_t *region1, const uint8_t *region2, size_t length);
+void maddrr4_imul_neon_128(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+
+void invr4_imul_neon_128(uint8_t *region, size_t length);
+void divr4_imul_neon_128(uint8_t *region1, const uint8_t *region2, size_t length);
+#endif
+
+#ifdef __aarch64__
+void maddrc4_shuffle_neon_128(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void mulrc4_shuffle_neon_128(uint8_t *region, uint8_t constant, size_t length);
+void mulrc_copy4_shuffle_neon_128(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi4_shuffle_neon_128(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout4_shuffle_neon_128(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_4_shuffle_neon_128(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
+
+void maddrc4_shuffle_neon_sha3(uint8_t *region1, const uint8_t *region2, uint8_t constant, size_t length);
+void maddrc_multi4_shuffle_neon_sha3(uint8_t *region1, const uint8_t **regions, const uint8_t *constants, int count, size_t length);
+void maddrc_fanout4_shuffle_neon_sha3(uint8_t **regions, const uint8_t *region2, const uint8_t *constants, int count, size_t length);
+void maddrc3_4_shuffle_neon_sha3(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, uint8_t constant, size_t length);
 #endif
 
 #endif
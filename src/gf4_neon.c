@@ -180,3 +180,301 @@ mulrc4_imul_neon_64(uint8_t *region, uint8_t constant, size_t length)
 	}
 }
 
+void
+mulrc_copy4_imul_neon_64(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register uint8x8_t reg, ri[2], sp[2], mi[2];
+	const uint8_t *p = pt[constant];
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+	
+	mi[0] = vdup_n_u8(0x55);
+	mi[1] = vdup_n_u8(0xaa);
+	sp[0] = vdup_n_u8(p[0]);
+	sp[1] = vdup_n_u8(p[1]);
+
+	for (end=region1+length; region1<end; region1+=8, region2+=8) {
+		reg = vld1_u8((void *)region2);
+		ri[0] = vand_u8(reg, mi[0]);
+		ri[1] = vand_u8(reg, mi[1]);
+		ri[1] = vshr_n_u8(ri[1], 1);
+		ri[0] = vmul_u8(ri[0], sp[0]);
+		ri[1] = vmul_u8(ri[1], sp[1]);
+		ri[0] = veor_u8(ri[0], ri[1]);
+		vst1_u8((void *)region1, ri[0]);
+	}
+}
+
+void
+maddrc_multi4_imul_neon_128(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++)
+		maddrc4_imul_neon_128(region1, regions[i], constants[i], length);
+}
+
+void
+maddrc_fanout4_imul_neon_128(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++)
+		maddrc4_imul_neon_128(regions[i], region2, constants[i], length);
+}
+
+void
+maddrc3_4_shuffle_neon_64(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register uint8x8x2_t t1, t2;
+	register uint8x8_t m1, m2, in1, in2, out, l, h;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_neon_128(region1, region2, region3, length);
+		return;
+	}
+
+	t1 = vld2_u8((void *)tl[constant]);
+	t2 = vld2_u8((void *)th[constant]);
+	m1 = vdup_n_u8(0x0f);
+	m2 = vdup_n_u8(0xf0);
+
+	for (end=region1+length; region1<end;
+			region1+=8, region2+=8, region3+=8) {
+		in2 = vld1_u8((void *)region3);
+		in1 = vld1_u8((void *)region2);
+		l = vand_u8(in2, m1);
+		l = vtbl2_u8(t1, l);
+		h = vand_u8(in2, m2);
+		h = vshr_n_u8(h, 4);
+		h = vtbl2_u8(t2, h);
+		out = veor_u8(h, l);
+		out = veor_u8(out, in1);
+		vst1_u8(region1, out);
+	}
+}
+
+void
+maddrc3_4_imul_neon_64(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	const uint8_t *p = pt[constant];
+	register uint8x8_t reg1, reg2, ri[2], sp[2], mi[2];
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_neon_64(region1, region2, region3, length);
+		return;
+	}
+
+	mi[0] = vdup_n_u8(0x55);
+	mi[1] = vdup_n_u8(0xaa);
+	sp[0] = vdup_n_u8(p[0]);
+	sp[1] = vdup_n_u8(p[1]);
+
+	for (end=region1+length; region1<end;
+			region1+=8, region2+=8, region3+=8) {
+		reg2 = vld1_u8((void *)region3);
+		reg1 = vld1_u8((void *)region2);
+		ri[0] = vand_u8(reg2, mi[0]);
+		ri[1] = vand_u8(reg2, mi[1]);
+		ri[1] = vshr_n_u8(ri[1], 1);
+		ri[0] = vmul_u8(ri[0], sp[0]);
+		ri[1] = vmul_u8(ri[1], sp[1]);
+		ri[0] = veor_u8(ri[0], ri[1]);
+		ri[0] = veor_u8(ri[0], reg1);
+		vst1_u8((void *)region1, ri[0]);
+	}
+}
+
+void
+maddrc3_4_imul_neon_128(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	const uint8_t *p = pt[constant];
+	register uint8x16_t reg1, reg2, ri[2], sp[2], mi[2];
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_neon_128(region1, region2, region3, length);
+		return;
+	}
+
+	mi[0] = vdupq_n_u8(0x55);
+	mi[1] = vdupq_n_u8(0xaa);
+	sp[0] = vdupq_n_u8(p[0]);
+	sp[1] = vdupq_n_u8(p[1]);
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16) {
+		reg2 = vld1q_u8((void *)region3);
+		reg1 = vld1q_u8((void *)region2);
+		ri[0] = vandq_u8(reg2, mi[0]);
+		ri[1] = vandq_u8(reg2, mi[1]);
+		ri[1] = vshrq_n_u8(ri[1], 1);
+		ri[0] = vmulq_u8(ri[0], sp[0]);
+		ri[1] = vmulq_u8(ri[1], sp[1]);
+		ri[0] = veorq_u8(ri[0], ri[1]);
+		ri[0] = veorq_u8(ri[0], reg1);
+		vst1q_u8((void *)region1, ri[0]);
+	}
+}
+
+void
+mulrr4_imul_neon_128(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	int i;
+	register uint8x16_t a, b, t, acc, l, nl, p;
+
+	l = vdupq_n_u8(0x55);
+	nl = vdupq_n_u8(0xaa);
+	p = vdupq_n_u8((MOEPGF4_POLYNOMIAL & MOEPGF4_MASK) * 0x55);
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		a = vld1q_u8(region1);
+		b = vld1q_u8(region2);
+		acc = vdupq_n_u8(0);
+
+		for (i=0; i<MOEPGF4_EXPONENT; i++) {
+			t = vandq_u8(b, l);
+			t = vsubq_u8(vshlq_n_u8(t, 2), t);
+			t = vandq_u8(t, a);
+			acc = veorq_u8(acc, t);
+			b = vshrq_n_u8(b, 1);
+
+			t = vshrq_n_u8(a, 1);
+			t = vandq_u8(t, l);
+			t = vsubq_u8(vshlq_n_u8(t, 2), t);
+			t = vandq_u8(t, p);
+			a = vshlq_n_u8(a, 1);
+			a = vandq_u8(a, nl);
+			a = veorq_u8(a, t);
+		}
+
+		vst1q_u8(region1, acc);
+	}
+}
+
+void
+maddrr4_imul_neon_128(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, size_t length)
+{
+	uint8_t *end;
+	int i;
+	register uint8x16_t a, b, t, acc, l, nl, p;
+
+	l = vdupq_n_u8(0x55);
+	nl = vdupq_n_u8(0xaa);
+	p = vdupq_n_u8((MOEPGF4_POLYNOMIAL & MOEPGF4_MASK) * 0x55);
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16) {
+		a = vld1q_u8(region2);
+		b = vld1q_u8(region3);
+		acc = vld1q_u8(region1);
+
+		for (i=0; i<MOEPGF4_EXPONENT; i++) {
+			t = vandq_u8(b, l);
+			t = vsubq_u8(vshlq_n_u8(t, 2), t);
+			t = vandq_u8(t, a);
+			acc = veorq_u8(acc, t);
+			b = vshrq_n_u8(b, 1);
+
+			t = vshrq_n_u8(a, 1);
+			t = vandq_u8(t, l);
+			t = vsubq_u8(vshlq_n_u8(t, 2), t);
+			t = vandq_u8(t, p);
+			a = vshlq_n_u8(a, 1);
+			a = vandq_u8(a, nl);
+			a = veorq_u8(a, t);
+		}
+
+		vst1q_u8(region1, acc);
+	}
+}
+
+void
+invr4_imul_neon_128(uint8_t *region, size_t length)
+{
+	uint8_t *end;
+	register uint8x16_t in, t, l;
+
+	l = vdupq_n_u8(0x55);
+
+	for (end=region+length; region<end; region+=16) {
+		in = vld1q_u8(region);
+		t = vshrq_n_u8(in, 1);
+		t = vandq_u8(t, l);
+		in = veorq_u8(in, t);
+		vst1q_u8(region, in);
+	}
+}
+
+void
+divr4_imul_neon_128(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	int i;
+	register uint8x16_t a, b, t, acc, l, nl, p;
+
+	l = vdupq_n_u8(0x55);
+	nl = vdupq_n_u8(0xaa);
+	p = vdupq_n_u8((MOEPGF4_POLYNOMIAL & MOEPGF4_MASK) * 0x55);
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		a = vld1q_u8(region1);
+		b = vld1q_u8(region2);
+		t = vshrq_n_u8(b, 1);
+		t = vandq_u8(t, l);
+		b = veorq_u8(b, t);
+
+		acc = vdupq_n_u8(0);
+		for (i=0; i<MOEPGF4_EXPONENT; i++) {
+			t = vandq_u8(b, l);
+			t = vsubq_u8(vshlq_n_u8(t, 2), t);
+			t = vandq_u8(t, a);
+			acc = veorq_u8(acc, t);
+			b = vshrq_n_u8(b, 1);
+
+			t = vshrq_n_u8(a, 1);
+			t = vandq_u8(t, l);
+			t = vsubq_u8(vshlq_n_u8(t, 2), t);
+			t = vandq_u8(t, p);
+			a = vshlq_n_u8(a, 1);
+			a = vandq_u8(a, nl);
+			a = veorq_u8(a, t);
+		}
+
+		vst1q_u8(region1, acc);
+	}
+}
@@ -107,3 +107,225 @@ mulrc4_imul_sse2(uint8_t *region, uint8_t constant, size_t length)
 	}
 }
 
+void
+mulrc_copy4_imul_sse2(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m128i reg, ri[2], sp[2], mi[2];
+	const uint8_t *p = pt[constant];
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	mi[0] = _mm_set1_epi8(0x55);
+	mi[1] = _mm_set1_epi8(0xaa);
+	sp[0] = _mm_set1_epi16(p[0]);
+	sp[1] = _mm_set1_epi16(p[1]);
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		reg = _mm_load_si128((void *)region2);
+		ri[0] = _mm_and_si128(reg, mi[0]);
+		ri[1] = _mm_and_si128(reg, mi[1]);
+		ri[1] = _mm_srli_epi16(ri[1], 1);
+		ri[0] = _mm_mullo_epi16(ri[0], sp[0]);
+		ri[1] = _mm_mullo_epi16(ri[1], sp[1]);
+		ri[0] = _mm_xor_si128(ri[0], ri[1]);
+		_mm_store_si128((void *)region1, ri[0]);
+	}
+}
+
+void
+maddrc_multi4_imul_sse2(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++)
+		maddrc4_imul_sse2(region1, regions[i], constants[i], length);
+}
+
+void
+maddrc_fanout4_imul_sse2(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++)
+		maddrc4_imul_sse2(regions[i], region2, constants[i], length);
+}
+
+void
+maddrc3_4_imul_sse2(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	register __m128i reg1, reg2, ri[2], sp[2], mi[2];
+	const uint8_t *p = pt[constant];
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_sse2(region1, region2, region3, length);
+		return;
+	}
+
+	mi[0] = _mm_set1_epi8(0x55);
+	mi[1] = _mm_set1_epi8(0xaa);
+	sp[0] = _mm_set1_epi16(p[0]);
+	sp[1] = _mm_set1_epi16(p[1]);
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16) {
+		reg2 = _mm_load_si128((void *)region3);
+		reg1 = _mm_load_si128((void *)region2);
+		ri[0] = _mm_and_si128(reg2, mi[0]);
+		ri[1] = _mm_and_si128(reg2, mi[1]);
+		ri[1] = _mm_srli_epi16(ri[1], 1);
+		ri[0] = _mm_mullo_epi16(ri[0], sp[0]);
+		ri[1] = _mm_mullo_epi16(ri[1], sp[1]);
+		ri[0] = _mm_xor_si128(ri[0], ri[1]);
+		ri[0] = _mm_xor_si128(ri[0], reg1);
+		_mm_store_si128((void *)region1, ri[0]);
+	}
+}
+
+void
+mulrr4_imul_sse2(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	int i;
+	register __m128i a, b, t, acc, l, nl, p;
+
+	l = _mm_set1_epi8(0x55);
+	nl = _mm_set1_epi8(0xaa);
+	p = _mm_set1_epi8((MOEPGF4_POLYNOMIAL & MOEPGF4_MASK) * 0x55);
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		a = _mm_load_si128((void *)region1);
+		b = _mm_load_si128((void *)region2);
+		acc = _mm_setzero_si128();
+
+		for (i=0; i<MOEPGF4_EXPONENT; i++) {
+			t = _mm_and_si128(b, l);
+			t = _mm_sub_epi16(_mm_slli_epi16(t, 2), t);
+			t = _mm_and_si128(t, a);
+			acc = _mm_xor_si128(acc, t);
+			b = _mm_srli_epi16(b, 1);
+
+			t = _mm_srli_epi16(a, 1);
+			t = _mm_and_si128(t, l);
+			t = _mm_sub_epi16(_mm_slli_epi16(t, 2), t);
+			t = _mm_and_si128(t, p);
+			a = _mm_slli_epi16(a, 1);
+			a = _mm_and_si128(a, nl);
+			a = _mm_xor_si128(a, t);
+		}
+
+		_mm_store_si128((void *)region1, acc);
+	}
+}
+
+void
+maddrr4_imul_sse2(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, size_t length)
+{
+	uint8_t *end;
+	int i;
+	register __m128i a, b, t, acc, l, nl, p;
+
+	l = _mm_set1_epi8(0x55);
+	nl = _mm_set1_epi8(0xaa);
+	p = _mm_set1_epi8((MOEPGF4_POLYNOMIAL & MOEPGF4_MASK) * 0x55);
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16) {
+		a = _mm_load_si128((void *)region2);
+		b = _mm_load_si128((void *)region3);
+		acc = _mm_load_si128((void *)region1);
+
+		for (i=0; i<MOEPGF4_EXPONENT; i++) {
+			t = _mm_and_si128(b, l);
+			t = _mm_sub_epi16(_mm_slli_epi16(t, 2), t);
+			t = _mm_and_si128(t, a);
+			acc = _mm_xor_si128(acc, t);
+			b = _mm_srli_epi16(b, 1);
+
+			t = _mm_srli_epi16(a, 1);
+			t = _mm_and_si128(t, l);
+			t = _mm_sub_epi16(_mm_slli_epi16(t, 2), t);
+			t = _mm_and_si128(t, p);
+			a = _mm_slli_epi16(a, 1);
+			a = _mm_and_si128(a, nl);
+			a = _mm_xor_si128(a, t);
+		}
+
+		_mm_store_si128((void *)region1, acc);
+	}
+}
+
+void
+invr4_imul_sse2(uint8_t *region, size_t length)
+{
+	uint8_t *end;
+	register __m128i in, t, l;
+
+	l = _mm_set1_epi8(0x55);
+
+	for (end=region+length; region<end; region+=16) {
+		in = _mm_load_si128((void *)region);
+		t = _mm_srli_epi64(in, 1);
+		t = _mm_and_si128(t, l);
+		in = _mm_xor_si128(in, t);
+		_mm_store_si128((void *)region, in);
+	}
+}
+
+void
+divr4_imul_sse2(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	int i;
+	register __m128i a, b, t, acc, l, nl, p;
+
+	l = _mm_set1_epi8(0x55);
+	nl = _mm_set1_epi8(0xaa);
+	p = _mm_set1_epi8((MOEPGF4_POLYNOMIAL & MOEPGF4_MASK) * 0x55);
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		a = _mm_load_si128((void *)region1);
+		b = _mm_load_si128((void *)region2);
+		t = _mm_srli_epi64(b, 1);
+		t = _mm_and_si128(t, l);
+		b = _mm_xor_si128(b, t);
+
+		acc = _mm_setzero_si128();
+		for (i=0; i<MOEPGF4_EXPONENT; i++) {
+			t = _mm_and_si128(b, l);
+			t = _mm_sub_epi16(_mm_slli_epi16(t, 2), t);
+			t = _mm_and_si128(t, a);
+			acc = _mm_xor_si128(acc, t);
+			b = _mm_srli_epi16(b, 1);
+
+			t = _mm_srli_epi16(a, 1);
+			t = _mm_and_si128(t, l);
+			t = _mm_sub_epi16(_mm_slli_epi16(t, 2), t);
+			t = _mm_and_si128(t, p);
+			a = _mm_slli_epi16(a, 1);
+			a = _mm_and_si128(a, nl);
+			a = _mm_xor_si128(a, t);
+		}
+
+		_mm_store_si128((void *)region1, acc);
+	}
+}
@@ -0,0 +1,194 @@
+/*
+ * This file is part of moep80211gf.
+ *
+ * Copyright (C) 2014,2019   Stephan M. Guenther <moepi@moepi.net>
+ * Copyright (C) 2016        Nicolas Appel <n.appel@tum.de>
+ * Copyright (C) 2014        Maximilian Riemensberger <riemensberger@tum.de>
+ *
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 2.1 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library. If not, see <https://www.gnu.org/licenses/>
+ *
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <moepgf/moepgf.h>
+
+#include "gf4.h"
+#include "vector.h"
+#include "xor.h"
+
+#if MOEPGF4_POLYNOMIAL == 7
+#include "gf4tables7.h"
+#else
+#error "Invalid prime polynomial or tables not available."
+#endif
+
+static const uint8_t tl[MOEPGF4_SIZE][16] = MOEPGF4_SHUFFLE_LOW_TABLE;
+
+void
+maddrc4_shuffle_vector(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	v16u8 t1, t2, m1, in1, in2, l, h;
+
+	if (constant == 0)
+		return;
+
+	if (constant == 1) {
+		xorr_vector(region1, region2, length);
+		return;
+	}
+
+	t1 = v16_load(tl[constant]);
+	t2 = t1 << 4;
+	m1 = v16_set1(0x0f);
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		in2 = v16_load(region2);
+		in1 = v16_load(region1);
+		l = v16_lookup(t1, in2 & m1);
+		h = v16_lookup(t2, in2 >> 4);
+		v16_store(region1, in1 ^ h ^ l);
+	}
+}
+
+void
+mulrc4_shuffle_vector(uint8_t *region, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	v16u8 t1, t2, m1, in, l, h;
+
+	if (constant == 0) {
+		memset(region, 0, length);
+		return;
+	}
+
+	if (constant == 1)
+		return;
+
+	t1 = v16_load(tl[constant]);
+	t2 = t1 << 4;
+	m1 = v16_set1(0x0f);
+
+	for (end=region+length; region<end; region+=16) {
+		in = v16_load(region);
+		l = v16_lookup(t1, in & m1);
+		h = v16_lookup(t2, in >> 4);
+		v16_store(region, h ^ l);
+	}
+}
+
+void
+mulrc_copy4_shuffle_vector(uint8_t *region1, const uint8_t *region2,
+					uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	v16u8 t1, t2, m1, in, l, h;
+
+	if (constant == 0) {
+		memset(region1, 0, length);
+		return;
+	}
+
+	if (constant == 1) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	t1 = v16_load(tl[constant]);
+	t2 = t1 << 4;
+	m1 = v16_set1(0x0f);
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		in = v16_load(region2);
+		l = v16_lookup(t1, in & m1);
+		h = v16_lookup(t2, in >> 4);
+		v16_store(region1, h ^ l);
+	}
+}
+
+void
+maddrc_multi4_shuffle_vector(uint8_t *region1, const uint8_t **regions,
+			const uint8_t *constants, int count, size_t length)
+{
+	size_t off;
+	int i;
+	v16u8 t1, t2, m1, in, acc;
+
+	m1 = v16_set1(0x0f);
+
+	for (off=0; off<length; off+=16) {
+		acc = v16_load(region1+off);
+
+		for (i=0; i<count; i++) {
+			if (constants[i] == 0)
+				continue;
+
+			t1 = v16_load(tl[constants[i]]);
+			t2 = t1 << 4;
+			in = v16_load(regions[i]+off);
+			acc ^= v16_lookup(t1, in & m1);
+			acc ^= v16_lookup(t2, in >> 4);
+		}
+
+		v16_store(region1+off, acc);
+	}
+}
+
+void
+maddrc_fanout4_shuffle_vector(uint8_t **regions, const uint8_t *region2,
+			const uint8_t *constants, int count, size_t length)
+{
+	int i;
+
+	for (i=0; i<count; i++)
+		maddrc4_shuffle_vector(regions[i], region2,
+						constants[i], length);
+}
+
+void
+maddrc3_4_shuffle_vector(uint8_t *region1, const uint8_t *region2,
+		const uint8_t *region3, uint8_t constant, size_t length)
+{
+	uint8_t *end;
+	v16u8 t1, t2, m1, in1, in2, l, h;
+
+	if (constant == 0) {
+		memmove(region1, region2, length);
+		return;
+	}
+
+	if (constant == 1) {
+		xorr3_vector(region1, region2, region3, length);
+		return;
+	}
+
+	t1 = v16_load(tl[constant]);
+	t2 = t1 << 4;
+	m1 = v16_set1(0x0f);
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16) {
+		in2 = v16_load(region3);
+		in1 = v16_load(region2);
+		l = v16_lookup(t1, in2 & m1);
+		h = v16_lookup(t2, in2 >> 4);
+		v16_store(region1, in1 ^ h ^ l);
+	}
+}
@@ -105,7 +105,7 @@
 0xa0,0xa3,0xa1,0xa2,0xac,0xaf,0xad,0xae,0xa4,0xa7,0xa5,0xa6,0xa8,0xab,0xa9,0xaa}\
 }
 
-#ifdef __x86_64__
+#ifndef __arm__
 #define MOEPGF4_SHUFFLE_LOW_TABLE { \
 {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},\
 {0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f},\
@@ -118,7 +118,10 @@
 {0x00,0x20,0x30,0x10,0x80,0xa0,0xb0,0x90,0xc0,0xe0,0xf0,0xd0,0x40,0x60,0x70,0x50},\
 {0x00,0x30,0x10,0x20,0xc0,0xf0,0xd0,0xe0,0x40,0x70,0x50,0x60,0x80,0xb0,0x90,0xa0}\
 }
-#endif //__x86_64__
+#define MOEPGF4_AFFINE_TABLE { \
+0x0000000000000000,0x0102040810204080,0x0203080c203080c0,0x03010c043010c040\
+}
+#endif //!__arm__
 
 #ifdef __arm__
 #define MOEPGF4_SHUFFLE_LOW_TABLE { \
@@ -0,0 +1,75 @@
+/*
+ * This file is part of moep80211gf.
+ *
+ * Copyright (C) 2014   Stephan M. Guenther <moepi@moepi.net>
+ *
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 2.1 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library. If not, see <https://www.gnu.org/licenses/>
+ *
+ */
+
+#ifndef _VECTOR_H_
+#define _VECTOR_H_
+
+#include <stdint.h>
+#include <string.h>
+
+/*
+ * 128 bit vectors using the GCC/Clang vector extensions. The kernels built on
+ * them leave the choice of instructions to the compiler, i.e., they use
+ * VSX/AltiVec, MSA, RVV, SSSE3 or NEON depending on the target flags.
+ */
+typedef uint8_t v16u8 __attribute__((vector_size(16)));
+
+static inline v16u8
+v16_load(const uint8_t *p)
+{
+	v16u8 v;
+
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static inline void
+v16_store(uint8_t *p, v16u8 v)
+{
+	memcpy(p, &v, sizeof(v));
+}
+
+static inline v16u8
+v16_set1(uint8_t c)
+{
+	return (v16u8){c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c};
+}
+
+/*
+ * Returns t[idx[i]] for each lane i. All indices must be less than 16. Clang
+ * does not support __builtin_shuffle() with a variable mask.
+ */
+static inline v16u8
+v16_lookup(v16u8 t, v16u8 idx)
+{
+#if defined(__clang__)
+	v16u8 r;
+	int i;
+
+	for (i=0; i<16; i++)
+		r[i] = t[idx[i]];
+	return r;
+#else
+	return __builtin_shuffle(t, idx);
+#endif
+}
+
+#endif // _VECTOR_H_
@@ -47,3 +47,85 @@ xorr_gpr64(uint8_t *region1, const uint8_t *region2, size_t length)
 	for(; region1 < end; region1+=8, region2+=8)
 		*(uint64_t *)region1 ^= *(uint64_t *)region2;
 }
+
+void
+xorr3_scalar(uint8_t *region1, const uint8_t *region2, const uint8_t *region3,
+								size_t length)
+{
+	for(; length; region1++, region2++, region3++, length--)
+		*region1 = *region2 ^ *region3;
+}
+
+void
+xorr3_gpr32(uint8_t *region1, const uint8_t *region2, const uint8_t *region3,
+								size_t length)
+{
+	uint8_t *end = region1 + length;
+
+	for(; region1 < end; region1+=4, region2+=4, region3+=4)
+		*(uint32_t *)region1 = *(uint32_t *)region2 ^ *(uint32_t *)region3;
+}
+
+void
+xorr3_gpr64(uint8_t *region1, const uint8_t *region2, const uint8_t *region3,
+								size_t length)
+{
+	uint8_t *end = region1 + length;
+
+	for(; region1 < end; region1+=8, region2+=8, region3+=8)
+		*(uint64_t *)region1 = *(uint64_t *)region2 ^ *(uint64_t *)region3;
+}
+
+void
+andr_scalar(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	for(; length; region1++, region2++, length--)
+		*region1 &= *region2;
+}
+
+void
+andr_gpr64(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end = region1 + length;
+
+	for(; region1 < end; region1+=8, region2+=8)
+		*(uint64_t *)region1 &= *(uint64_t *)region2;
+}
+
+void
+xorandr_scalar(uint8_t *region1, const uint8_t *region2,
+				const uint8_t *region3, size_t length)
+{
+	for(; length; region1++, region2++, region3++, length--)
+		*region1 ^= *region2 & *region3;
+}
+
+void
+xorandr_gpr64(uint8_t *region1, const uint8_t *region2,
+				const uint8_t *region3, size_t length)
+{
+	uint8_t *end = region1 + length;
+
+	for(; region1 < end; region1+=8, region2+=8, region3+=8)
+		*(uint64_t *)region1 ^= *(uint64_t *)region2 & *(uint64_t *)region3;
+}
+
+/*
+ * region1 ^= regions[0] ^ ... ^ regions[count-1]. Each word of region1 is
+ * loaded and stored once, regardless of count.
+ */
+void
+xorr_multi_gpr64(uint8_t *region1, const uint8_t **regions, int count,
+								size_t length)
+{
+	uint64_t out;
+	size_t off;
+	int i;
+
+	for (off=0; off<length; off+=8) {
+		out = *(uint64_t *)(region1+off);
+		for (i=0; i<count; i++)
+			out ^= *(const uint64_t *)(regions[i]+off);
+		*(uint64_t *)(region1+off) = out;
+	}
+}
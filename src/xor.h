@@ -34,16 +34,54 @@
 void xorr_scalar(uint8_t *region1, const uint8_t *region2, size_t length);
 void xorr_gpr32(uint8_t *region1, const uint8_t *region2, size_t length);
 void xorr_gpr64(uint8_t *region1, const uint8_t *region2, size_t length);
+void xorr3_scalar(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void xorr3_gpr32(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void xorr3_gpr64(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void andr_scalar(uint8_t *region1, const uint8_t *region2, size_t length);
+void andr_gpr64(uint8_t *region1, const uint8_t *region2, size_t length);
+void xorandr_scalar(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void xorandr_gpr64(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void xorr_multi_gpr64(uint8_t *region1, const uint8_t **regions, int count, size_t length);
+
+#ifndef __arm__
+void xorr_vector(uint8_t *region1, const uint8_t *region2, size_t length);
+void xorr3_vector(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+#endif
 
 #ifdef __x86_64__
 void xorr_sse2(uint8_t *region1, const uint8_t *region2, size_t length);
 void xorr_avx2(uint8_t *region1, const uint8_t *region2, size_t length);
 void xorr_avx512(uint8_t *region1, const uint8_t *region2, size_t length);
+void xorr_prefetch_sse2(uint8_t *region1, const uint8_t *region2, size_t length, size_t distance);
+void xorr_prefetch_avx2(uint8_t *region1, const uint8_t *region2, size_t length, size_t distance);
+void xorr_prefetch_avx512(uint8_t *region1, const uint8_t *region2, size_t length, size_t distance);
+void xorr_unaligned_sse2(uint8_t *region1, const uint8_t *region2, size_t length);
+void xorr_unaligned_avx2(uint8_t *region1, const uint8_t *region2, size_t length);
+void xorr_unaligned_avx512(uint8_t *region1, const uint8_t *region2, size_t length);
+void xorr3_sse2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void xorr3_avx2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void xorr3_avx512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void andr_sse2(uint8_t *region1, const uint8_t *region2, size_t length);
+void andr_avx2(uint8_t *region1, const uint8_t *region2, size_t length);
+void andr_avx512(uint8_t *region1, const uint8_t *region2, size_t length);
+void xorandr_sse2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void xorandr_avx2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void xorandr_avx512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void xorr_multi_avx2(uint8_t *region1, const uint8_t **regions, int count, size_t length);
+void xorr_multi_avx512(uint8_t *region1, const uint8_t **regions, int count, size_t length);
 #endif
 
-#ifdef __arm__
+#if defined(__arm__) || defined(__aarch64__)
 void xorr_neon_64(uint8_t *region1, const uint8_t *region2, size_t length);
 void xorr_neon_128(uint8_t *region1, const uint8_t *region2, size_t length);
+void xorr3_neon_64(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void xorr3_neon_128(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+void andr_neon_128(uint8_t *region1, const uint8_t *region2, size_t length);
+void xorandr_neon_128(uint8_t *region1, const uint8_t *region2, const uint8_t *region3, size_t length);
+#endif
+
+#ifdef __aarch64__
+void xorr_multi_neon_sha3(uint8_t *region1, const uint8_t **regions, int count, size_t length);
 #endif
 
 #endif // _XOR_H_
@@ -27,6 +27,8 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include "xor.h"
+
 void
 xorr_avx2(uint8_t *region1, const uint8_t *region2, size_t length)
 {
@@ -41,3 +43,128 @@ xorr_avx2(uint8_t *region1, const uint8_t *region2, size_t length)
 	}
 }
 
+void
+xorr3_avx2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3,
+								size_t length)
+{
+	uint8_t *end;
+	register __m256i in1, in2;
+
+	for (end=region1+length; region1<end;
+			region1+=32, region2+=32, region3+=32) {
+		in1 = _mm256_load_si256((void *)region2);
+		in2 = _mm256_load_si256((void *)region3);
+		in1 = _mm256_xor_si256(in1, in2);
+		_mm256_store_si256((void *)region1, in1);
+	}
+}
+
+void
+andr_avx2(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	register __m256i in, out;
+
+	for (end=region1+length; region1<end; region1+=32, region2+=32) {
+		in  = _mm256_load_si256((void *)region2);
+		out = _mm256_load_si256((void *)region1);
+		out = _mm256_and_si256(in, out);
+		_mm256_store_si256((void *)region1, out);
+	}
+}
+
+void
+xorandr_avx2(uint8_t *region1, const uint8_t *region2,
+				const uint8_t *region3, size_t length)
+{
+	uint8_t *end;
+	register __m256i in1, in2, out;
+
+	for (end=region1+length; region1<end;
+			region1+=32, region2+=32, region3+=32) {
+		in1 = _mm256_load_si256((void *)region2);
+		in2 = _mm256_load_si256((void *)region3);
+		out = _mm256_load_si256((void *)region1);
+		in1 = _mm256_and_si256(in1, in2);
+		out = _mm256_xor_si256(out, in1);
+		_mm256_store_si256((void *)region1, out);
+	}
+}
+
+void
+xorr_unaligned_avx2(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	size_t rem;
+	register __m256i in, out, tail;
+
+	if (length < 32) {
+		xorr_scalar(region1, region2, length);
+		return;
+	}
+
+	in = _mm256_loadu_si256((void *)(region2+length-32));
+	tail = _mm256_loadu_si256((void *)(region1+length-32));
+	tail = _mm256_xor_si256(in, tail);
+	rem = length % 32;
+
+	for (end=region1+length-rem; region1<end; region1+=32, region2+=32) {
+		in  = _mm256_loadu_si256((void *)region2);
+		out = _mm256_loadu_si256((void *)region1);
+		out = _mm256_xor_si256(in, out);
+		_mm256_storeu_si256((void *)region1, out);
+	}
+
+	_mm256_storeu_si256((void *)(region1+rem-32), tail);
+}
+
+void
+xorr_multi_avx2(uint8_t *region1, const uint8_t **regions, int count,
+								size_t length)
+{
+	register __m256i in1, in2, out;
+	size_t off;
+	int i;
+
+	for (off=0; off<length; off+=32) {
+		out = _mm256_load_si256((void *)(region1+off));
+		for (i=0; i<count-1; i+=2) {
+			in1 = _mm256_load_si256((void *)(regions[i]+off));
+			in2 = _mm256_load_si256((void *)(regions[i+1]+off));
+			in1 = _mm256_xor_si256(in1, in2);
+			out = _mm256_xor_si256(out, in1);
+		}
+		if (i < count) {
+			in1 = _mm256_load_si256((void *)(regions[i]+off));
+			out = _mm256_xor_si256(out, in1);
+		}
+		_mm256_store_si256((void *)(region1+off), out);
+	}
+}
+
+void
+xorr_prefetch_avx2(uint8_t *region1, const uint8_t *region2, size_t length,
+							size_t distance)
+{
+	uint8_t *end;
+	register __m256i in[2], out[2];
+
+	for (end=region1+(length & ~(size_t)63); region1<end; region1+=64, region2+=64) {
+		_mm_prefetch((const char *)(region2+distance), _MM_HINT_T0);
+		_mm_prefetch((const char *)(region1+distance), _MM_HINT_T0);
+		in[0] = _mm256_load_si256((void *)region2);
+		in[1] = _mm256_load_si256((void *)(region2+32));
+		out[0] = _mm256_load_si256((void *)region1);
+		out[1] = _mm256_load_si256((void *)(region1+32));
+		out[0] = _mm256_xor_si256(in[0], out[0]);
+		out[1] = _mm256_xor_si256(in[1], out[1]);
+		_mm256_store_si256((void *)region1, out[0]);
+		_mm256_store_si256((void *)(region1+32), out[1]);
+	}
+	for (end=region1+(length & 63); region1<end; region1+=32, region2+=32) {
+		in[0] = _mm256_load_si256((void *)region2);
+		out[0] = _mm256_load_si256((void *)region1);
+		out[0] = _mm256_xor_si256(in[0], out[0]);
+		_mm256_store_si256((void *)region1, out[0]);
+	}
+}
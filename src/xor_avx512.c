@@ -43,3 +43,122 @@ xorr_avx512(uint8_t *region1, const uint8_t *region2, size_t length)
 		_mm512_store_si512((void *)region1, out);
 	}
 }
+
+void
+xorr3_avx512(uint8_t *region1, const uint8_t *region2, const uint8_t *region3,
+								size_t length)
+{
+	uint8_t *end;
+	register __m512i in1, in2;
+
+	for (end=region1+length; region1<end;
+			region1+=64, region2+=64, region3+=64) {
+		in1 = _mm512_load_si512((void *)region2);
+		in2 = _mm512_load_si512((void *)region3);
+		in1 = _mm512_xor_si512(in1, in2);
+		_mm512_store_si512((void *)region1, in1);
+	}
+}
+
+void
+andr_avx512(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	register __m512i in, out;
+
+	for (end=region1+length; region1<end; region1+=64, region2+=64) {
+		in  = _mm512_load_si512((void *)region2);
+		out = _mm512_load_si512((void *)region1);
+		out = _mm512_and_si512(in, out);
+		_mm512_store_si512((void *)region1, out);
+	}
+}
+
+void
+xorandr_avx512(uint8_t *region1, const uint8_t *region2,
+				const uint8_t *region3, size_t length)
+{
+	uint8_t *end;
+	register __m512i in1, in2, out;
+
+	for (end=region1+length; region1<end;
+			region1+=64, region2+=64, region3+=64) {
+		in1 = _mm512_load_si512((void *)region2);
+		in2 = _mm512_load_si512((void *)region3);
+		out = _mm512_load_si512((void *)region1);
+		in1 = _mm512_and_si512(in1, in2);
+		out = _mm512_xor_si512(out, in1);
+		_mm512_store_si512((void *)region1, out);
+	}
+}
+
+void
+xorr_unaligned_avx512(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	size_t rem;
+	register __m512i in, out, tail;
+
+	if (length < 64) {
+		xorr_scalar(region1, region2, length);
+		return;
+	}
+
+	in = _mm512_loadu_si512((void *)(region2+length-64));
+	tail = _mm512_loadu_si512((void *)(region1+length-64));
+	tail = _mm512_xor_si512(in, tail);
+	rem = length % 64;
+
+	for (end=region1+length-rem; region1<end; region1+=64, region2+=64) {
+		in  = _mm512_loadu_si512((void *)region2);
+		out = _mm512_loadu_si512((void *)region1);
+		out = _mm512_xor_si512(in, out);
+		_mm512_storeu_si512((void *)region1, out);
+	}
+
+	_mm512_storeu_si512((void *)(region1+rem-64), tail);
+}
+
+/*
+ * vpternlogq with immediate 0x96 computes the xor of three operands, i.e.,
+ * two source regions are folded into the accumulator per instruction.
+ */
+void
+xorr_multi_avx512(uint8_t *region1, const uint8_t **regions, int count,
+								size_t length)
+{
+	register __m512i in1, in2, out;
+	size_t off;
+	int i;
+
+	for (off=0; off<length; off+=64) {
+		out = _mm512_load_si512((void *)(region1+off));
+		for (i=0; i<count-1; i+=2) {
+			in1 = _mm512_load_si512((void *)(regions[i]+off));
+			in2 = _mm512_load_si512((void *)(regions[i+1]+off));
+			out = _mm512_ternarylogic_epi64(out, in1, in2, 0x96);
+		}
+		if (i < count) {
+			in1 = _mm512_load_si512((void *)(regions[i]+off));
+			out = _mm512_xor_si512(out, in1);
+		}
+		_mm512_store_si512((void *)(region1+off), out);
+	}
+}
+
+void
+xorr_prefetch_avx512(uint8_t *region1, const uint8_t *region2, size_t length,
+							size_t distance)
+{
+	uint8_t *end;
+	register __m512i in, out;
+
+	for (end=region1+length; region1<end; region1+=64, region2+=64) {
+		_mm_prefetch((const char *)(region2+distance), _MM_HINT_T0);
+		_mm_prefetch((const char *)(region1+distance), _MM_HINT_T0);
+		in = _mm512_load_si512((void *)region2);
+		out = _mm512_load_si512((void *)region1);
+		out = _mm512_xor_si512(in, out);
+		_mm512_store_si512((void *)region1, out);
+	}
+}
@@ -55,3 +55,66 @@ xorr_neon_128(uint8_t *region1, const uint8_t *region2, size_t length)
 	}
 }
 
+void
+xorr3_neon_64(uint8_t *region1, const uint8_t *region2, const uint8_t *region3,
+								size_t length)
+{
+	uint8_t *end;
+	register uint64x1_t in1, in2;
+
+	for (end=region1+length; region1<end;
+			region1+=8, region2+=8, region3+=8) {
+		in1 = vld1_u64((void *)region2);
+		in2 = vld1_u64((void *)region3);
+		in1 = veor_u64(in1, in2);
+		vst1_u64((void *)region1, in1);
+	}
+}
+
+void
+xorr3_neon_128(uint8_t *region1, const uint8_t *region2, const uint8_t *region3,
+								size_t length)
+{
+	uint8_t *end;
+	register uint64x2_t in1, in2;
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16) {
+		in1 = vld1q_u64((void *)region2);
+		in2 = vld1q_u64((void *)region3);
+		in1 = veorq_u64(in1, in2);
+		vst1q_u64((void *)region1, in1);
+	}
+}
+
+void
+andr_neon_128(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	register uint64x2_t in, out;
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		in  = vld1q_u64((void *)region2);
+		out = vld1q_u64((void *)region1);
+		out = vandq_u64(in, out);
+		vst1q_u64((void *)region1, out);
+	}
+}
+
+void
+xorandr_neon_128(uint8_t *region1, const uint8_t *region2,
+				const uint8_t *region3, size_t length)
+{
+	uint8_t *end;
+	register uint64x2_t in1, in2, out;
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16) {
+		in1 = vld1q_u64((void *)region2);
+		in2 = vld1q_u64((void *)region3);
+		out = vld1q_u64((void *)region1);
+		in1 = vandq_u64(in1, in2);
+		out = veorq_u64(out, in1);
+		vst1q_u64((void *)region1, out);
+	}
+}
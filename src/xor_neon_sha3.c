@@ -0,0 +1,51 @@
+/*
+ * This file is part of moep80211gf.
+ *
+ * Copyright (C) 2014   Stephan M. Guenther <moepi@moepi.net>
+ * Copyright (C) 2014   Maximilian Riemensberger <riemensberger@tum.de>
+ *
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 2.1 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library. If not, see <https://www.gnu.org/licenses/>
+ *
+ */
+
+#include <arm_neon.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "xor.h"
+
+void
+xorr_multi_neon_sha3(uint8_t *region1, const uint8_t **regions, int count,
+								size_t length)
+{
+	register uint8x16_t in1, in2, out;
+	size_t off;
+	int i;
+
+	for (off=0; off<length; off+=16) {
+		out = vld1q_u8(region1+off);
+		for (i=0; i<count-1; i+=2) {
+			in1 = vld1q_u8(regions[i]+off);
+			in2 = vld1q_u8(regions[i+1]+off);
+			out = veor3q_u8(out, in1, in2);
+		}
+		if (i < count) {
+			in1 = vld1q_u8(regions[i]+off);
+			out = veorq_u8(out, in1);
+		}
+		vst1q_u8(region1+off, out);
+	}
+}
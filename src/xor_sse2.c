@@ -27,6 +27,8 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include "xor.h"
+
 void
 xorr_sse2(uint8_t *region1, const uint8_t *region2, size_t length)
 {
@@ -41,3 +43,112 @@ xorr_sse2(uint8_t *region1, const uint8_t *region2, size_t length)
 	}
 }
 
+void
+xorr3_sse2(uint8_t *region1, const uint8_t *region2, const uint8_t *region3,
+								size_t length)
+{
+	uint8_t *end;
+	register __m128i in1, in2;
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16) {
+		in1 = _mm_load_si128((void *)region2);
+		in2 = _mm_load_si128((void *)region3);
+		in1 = _mm_xor_si128(in1, in2);
+		_mm_store_si128((void *)region1, in1);
+	}
+}
+
+void
+andr_sse2(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	register __m128i in, out;
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16) {
+		in  = _mm_load_si128((void *)region2);
+		out = _mm_load_si128((void *)region1);
+		out = _mm_and_si128(in, out);
+		_mm_store_si128((void *)region1, out);
+	}
+}
+
+void
+xorandr_sse2(uint8_t *region1, const uint8_t *region2,
+				const uint8_t *region3, size_t length)
+{
+	uint8_t *end;
+	register __m128i in1, in2, out;
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16) {
+		in1 = _mm_load_si128((void *)region2);
+		in2 = _mm_load_si128((void *)region3);
+		out = _mm_load_si128((void *)region1);
+		in1 = _mm_and_si128(in1, in2);
+		out = _mm_xor_si128(out, in1);
+		_mm_store_si128((void *)region1, out);
+	}
+}
+
+void
+xorr_unaligned_sse2(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+	size_t rem;
+	register __m128i in, out, tail;
+
+	if (length < 16) {
+		xorr_scalar(region1, region2, length);
+		return;
+	}
+
+	in = _mm_loadu_si128((void *)(region2+length-16));
+	tail = _mm_loadu_si128((void *)(region1+length-16));
+	tail = _mm_xor_si128(in, tail);
+	rem = length % 16;
+
+	for (end=region1+length-rem; region1<end; region1+=16, region2+=16) {
+		in  = _mm_loadu_si128((void *)region2);
+		out = _mm_loadu_si128((void *)region1);
+		out = _mm_xor_si128(in, out);
+		_mm_storeu_si128((void *)region1, out);
+	}
+
+	_mm_storeu_si128((void *)(region1+rem-16), tail);
+}
+
+void
+xorr_prefetch_sse2(uint8_t *region1, const uint8_t *region2, size_t length,
+							size_t distance)
+{
+	uint8_t *end;
+	register __m128i in[4], out[4];
+
+	for (end=region1+(length & ~(size_t)63); region1<end; region1+=64, region2+=64) {
+		_mm_prefetch((const char *)(region2+distance), _MM_HINT_T0);
+		_mm_prefetch((const char *)(region1+distance), _MM_HINT_T0);
+		in[0] = _mm_load_si128((void *)region2);
+		in[1] = _mm_load_si128((void *)(region2+16));
+		in[2] = _mm_load_si128((void *)(region2+32));
+		in[3] = _mm_load_si128((void *)(region2+48));
+		out[0] = _mm_load_si128((void *)region1);
+		out[1] = _mm_load_si128((void *)(region1+16));
+		out[2] = _mm_load_si128((void *)(region1+32));
+		out[3] = _mm_load_si128((void *)(region1+48));
+		out[0] = _mm_xor_si128(in[0], out[0]);
+		out[1] = _mm_xor_si128(in[1], out[1]);
+		out[2] = _mm_xor_si128(in[2], out[2]);
+		out[3] = _mm_xor_si128(in[3], out[3]);
+		_mm_store_si128((void *)region1, out[0]);
+		_mm_store_si128((void *)(region1+16), out[1]);
+		_mm_store_si128((void *)(region1+32), out[2]);
+		_mm_store_si128((void *)(region1+48), out[3]);
+	}
+	for (end=region1+(length & 63); region1<end; region1+=16, region2+=16) {
+		in[0] = _mm_load_si128((void *)region2);
+		out[0] = _mm_load_si128((void *)region1);
+		out[0] = _mm_xor_si128(in[0], out[0]);
+		_mm_store_si128((void *)region1, out[0]);
+	}
+}
@@ -0,0 +1,47 @@
+/*
+ * This file is part of moep80211gf.
+ *
+ * Copyright (C) 2014   Stephan M. Guenther <moepi@moepi.net>
+ * Copyright (C) 2014   Maximilian Riemensberger <riemensberger@tum.de>
+ *
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 2.1 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library. If not, see <https://www.gnu.org/licenses/>
+ *
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "vector.h"
+#include "xor.h"
+
+void
+xorr_vector(uint8_t *region1, const uint8_t *region2, size_t length)
+{
+	uint8_t *end;
+
+	for (end=region1+length; region1<end; region1+=16, region2+=16)
+		v16_store(region1, v16_load(region1) ^ v16_load(region2));
+}
+
+void
+xorr3_vector(uint8_t *region1, const uint8_t *region2, const uint8_t *region3,
+								size_t length)
+{
+	uint8_t *end;
+
+	for (end=region1+length; region1<end;
+			region1+=16, region2+=16, region3+=16)
+		v16_store(region1, v16_load(region2) ^ v16_load(region3));
+}
@@ -352,12 +352,12 @@ print_shuffle_table(struct galois_field *gf)
 		}
 	}
 
-	fprintf(stdout, "#ifdef __x86_64__\n");
+	fprintf(stdout, "#ifndef __arm__\n");
 	fprintf(stdout, "#define MOEPGF%d_SHUFFLE_LOW_TABLE { \\", gf->size);
 	print_2d_table(lt, gf->size, 16);
 	fprintf(stdout, "#define MOEPGF%d_SHUFFLE_HIGH_TABLE { \\", gf->size);
 	print_2d_table(ht, gf->size, 16);
-	fprintf(stdout, "#endif //__x86_64__\n");
+	fprintf(stdout, "#endif //!__arm__\n");
 
 	fprintf(stdout, "\n");
 